@@ -0,0 +1,210 @@
+#include "godot/math.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace godot;
+
+using math::Precision;
+
+static constexpr size_t element_count = 100000;
+
+static constexpr int iterations = 50;
+
+template<typename Function> static double nanoseconds_per_element(Function const& function) {
+	auto const start = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i += 1) function();
+
+	return (static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start
+	).count()) / (iterations * element_count));
+}
+
+static double difference(core::real_t const a, core::real_t const b) {
+	return std::fabs(static_cast<double>(a) - b);
+}
+
+static double difference(core::Vector2 const& a, core::Vector2 const& b) {
+	return std::max(difference(a.x, b.x), difference(a.y, b.y));
+}
+
+static double difference(core::Vector3 const& a, core::Vector3 const& b) {
+	return std::max({difference(a.x, b.x), difference(a.y, b.y), difference(a.z, b.z)});
+}
+
+static double difference(core::Quat const& a, core::Quat const& b) {
+	return std::max({difference(a.x, b.x), difference(a.y, b.y), difference(a.z, b.z), difference(a.w, b.w)});
+}
+
+// Runs both precisions over every element, timing each and reporting the worst and mean absolute
+// difference of the fast results from the exact ones.
+template<typename Result, typename Exact, typename Fast> static void report(
+	char const* name,
+	Exact const& exact,
+	Fast const& fast
+) {
+	std::vector<Result> exact_results(element_count), fast_results(element_count);
+	double worst = 0, total = 0;
+
+	double const exact_time = nanoseconds_per_element([&]() {
+		for (size_t i = 0; i < element_count; i += 1) exact_results[i] = exact(i);
+	});
+
+	double const fast_time = nanoseconds_per_element([&]() {
+		for (size_t i = 0; i < element_count; i += 1) fast_results[i] = fast(i);
+	});
+
+	for (size_t i = 0; i < element_count; i += 1) {
+		double const error = difference(exact_results[i], fast_results[i]);
+
+		worst = std::max(worst, error);
+		total += error;
+	}
+
+	std::printf(
+		"%-22s %10.2f %10.2f %8.2fx %12.3g %12.3g\n",
+		name,
+		exact_time,
+		fast_time,
+		(exact_time / fast_time),
+		worst,
+		(total / element_count)
+	);
+}
+
+int main() {
+	std::mt19937 generator(1);
+	std::normal_distribution<core::real_t> normal;
+	std::uniform_real_distribution<core::real_t> angle(-core::TAU, core::TAU);
+	std::uniform_real_distribution<core::real_t> weight(0, 1);
+	std::vector<core::Vector2> a2(element_count), b2(element_count);
+	std::vector<core::Vector3> a3(element_count), b3(element_count), axes(element_count);
+	std::vector<core::Vector2> unit_a2(element_count), unit_b2(element_count);
+	std::vector<core::Vector3> unit_a3(element_count), unit_b3(element_count);
+	std::vector<core::Quat> aq(element_count), bq(element_count), scaled_q(element_count);
+	std::vector<core::real_t> angles(element_count), weights(element_count);
+
+	for (size_t i = 0; i < element_count; i += 1) {
+		a2[i] = core::Vector2::of(normal(generator), normal(generator));
+		b2[i] = core::Vector2::of(normal(generator), normal(generator));
+		a3[i] = core::Vector3::of(normal(generator), normal(generator), normal(generator));
+		b3[i] = core::Vector3::of(normal(generator), normal(generator), normal(generator));
+		axes[i] = core::Vector3::of(normal(generator), normal(generator), normal(generator)).normalized();
+
+		aq[i] = core::Quat::of(
+			normal(generator),
+			normal(generator),
+			normal(generator),
+			normal(generator)
+		).normalized();
+
+		bq[i] = core::Quat::of(
+			normal(generator),
+			normal(generator),
+			normal(generator),
+			normal(generator)
+		).normalized();
+
+		unit_a2[i] = a2[i].normalized();
+		unit_b2[i] = b2[i].normalized();
+		unit_a3[i] = a3[i].normalized();
+		unit_b3[i] = b3[i].normalized();
+		scaled_q[i] = (aq[i] * 3.f);
+		angles[i] = angle(generator);
+		weights[i] = weight(generator);
+	}
+
+	std::printf(
+		"%-22s %10s %10s %9s %12s %12s\n",
+		"function",
+		"exact ns",
+		"fast ns",
+		"speedup",
+		"max error",
+		"mean error"
+	);
+
+	report<core::real_t>("Vector2::length", [&](size_t const i) {
+		return math::length<Precision::EXACT>(a2[i]);
+	}, [&](size_t const i) {
+		return math::length<Precision::FAST>(a2[i]);
+	});
+
+	report<core::real_t>("Vector3::length", [&](size_t const i) {
+		return math::length<Precision::EXACT>(a3[i]);
+	}, [&](size_t const i) {
+		return math::length<Precision::FAST>(a3[i]);
+	});
+
+	report<core::real_t>("Quat::length", [&](size_t const i) {
+		return math::length<Precision::EXACT>(scaled_q[i]);
+	}, [&](size_t const i) {
+		return math::length<Precision::FAST>(scaled_q[i]);
+	});
+
+	report<core::Vector2>("Vector2::normalized", [&](size_t const i) {
+		return math::normalized<Precision::EXACT>(a2[i]);
+	}, [&](size_t const i) {
+		return math::normalized<Precision::FAST>(a2[i]);
+	});
+
+	report<core::Vector3>("Vector3::normalized", [&](size_t const i) {
+		return math::normalized<Precision::EXACT>(a3[i]);
+	}, [&](size_t const i) {
+		return math::normalized<Precision::FAST>(a3[i]);
+	});
+
+	report<core::Quat>("Quat::normalized", [&](size_t const i) {
+		return math::normalized<Precision::EXACT>(scaled_q[i]);
+	}, [&](size_t const i) {
+		return math::normalized<Precision::FAST>(scaled_q[i]);
+	});
+
+	report<core::real_t>("Vector2::angle_to", [&](size_t const i) {
+		return math::angle_to<Precision::EXACT>(a2[i], b2[i]);
+	}, [&](size_t const i) {
+		return math::angle_to<Precision::FAST>(a2[i], b2[i]);
+	});
+
+	report<core::real_t>("Vector3::angle_to", [&](size_t const i) {
+		return math::angle_to<Precision::EXACT>(a3[i], b3[i]);
+	}, [&](size_t const i) {
+		return math::angle_to<Precision::FAST>(a3[i], b3[i]);
+	});
+
+	report<core::Vector2>("Vector2::rotated", [&](size_t const i) {
+		return math::rotated<Precision::EXACT>(unit_a2[i], angles[i]);
+	}, [&](size_t const i) {
+		return math::rotated<Precision::FAST>(unit_a2[i], angles[i]);
+	});
+
+	report<core::Vector3>("Vector3::rotated", [&](size_t const i) {
+		return math::rotated<Precision::EXACT>(unit_a3[i], axes[i], angles[i]);
+	}, [&](size_t const i) {
+		return math::rotated<Precision::FAST>(unit_a3[i], axes[i], angles[i]);
+	});
+
+	report<core::Vector2>("Vector2::slerp", [&](size_t const i) {
+		return math::slerp<Precision::EXACT>(unit_a2[i], unit_b2[i], weights[i]);
+	}, [&](size_t const i) {
+		return math::slerp<Precision::FAST>(unit_a2[i], unit_b2[i], weights[i]);
+	});
+
+	report<core::Vector3>("Vector3::slerp", [&](size_t const i) {
+		return math::slerp<Precision::EXACT>(unit_a3[i], unit_b3[i], weights[i]);
+	}, [&](size_t const i) {
+		return math::slerp<Precision::FAST>(unit_a3[i], unit_b3[i], weights[i]);
+	});
+
+	report<core::Quat>("Quat::slerp", [&](size_t const i) {
+		return math::slerp<Precision::EXACT>(aq[i], bq[i], weights[i]);
+	}, [&](size_t const i) {
+		return math::slerp<Precision::FAST>(aq[i], bq[i], weights[i]);
+	});
+
+	return 0;
+}
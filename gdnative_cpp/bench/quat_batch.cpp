@@ -0,0 +1,86 @@
+#include "godot/batch.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace godot;
+
+static constexpr size_t bone_count = (300 * 200);
+
+static constexpr int iterations = 50;
+
+template<typename Function> static double nanoseconds_per_element(Function const& function) {
+	auto const start = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i += 1) function();
+
+	return (static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start
+	).count()) / (iterations * bone_count));
+}
+
+int main() {
+	std::mt19937 generator(1);
+	std::normal_distribution<core::real_t> distribution;
+	std::vector<core::Quat> a(bone_count), b(bone_count), pre_a(bone_count), post_b(bone_count), out(bone_count);
+	std::vector<core::real_t> lanes[5][4];
+
+	auto const random_quat = [&]() {
+		return core::Quat::of(
+			distribution(generator),
+			distribution(generator),
+			distribution(generator),
+			distribution(generator)
+		).normalized();
+	};
+
+	auto const lanes_of = [&](size_t const index) {
+		return batch::QuatSpan{lanes[index][0], lanes[index][1], lanes[index][2], lanes[index][3]};
+	};
+
+	for (size_t i = 0; i < bone_count; i += 1) {
+		a[i] = random_quat();
+		b[i] = random_quat();
+		pre_a[i] = random_quat();
+		post_b[i] = random_quat();
+	}
+
+	for (auto& quat_lanes : lanes) {
+		for (auto& lane : quat_lanes) lane.resize(bone_count);
+	}
+
+	batch::gather(a, lanes_of(0));
+	batch::gather(b, lanes_of(1));
+	batch::gather(pre_a, lanes_of(2));
+	batch::gather(post_b, lanes_of(3));
+
+	std::printf("%-28s %10s\n", "kernel", "ns/quat");
+
+	std::printf("%-28s %10.2f\n", "Quat::slerp", nanoseconds_per_element([&]() {
+		for (size_t i = 0; i < bone_count; i += 1) out[i] = a[i].slerp(b[i], 0.3f);
+	}));
+
+	std::printf("%-28s %10.2f\n", "batch::slerp", nanoseconds_per_element([&]() {
+		batch::slerp(lanes_of(0), lanes_of(1), 0.3f, lanes_of(4));
+	}));
+
+	std::printf("%-28s %10.2f\n", "batch::nlerp", nanoseconds_per_element([&]() {
+		batch::nlerp(lanes_of(0), lanes_of(1), 0.3f, lanes_of(4));
+	}));
+
+	std::printf("%-28s %10.2f\n", "batch::nlerp_corrected", nanoseconds_per_element([&]() {
+		batch::nlerp_corrected(lanes_of(0), lanes_of(1), 0.3f, lanes_of(4));
+	}));
+
+	std::printf("%-28s %10.2f\n", "Quat::cubic_slerp", nanoseconds_per_element([&]() {
+		for (size_t i = 0; i < bone_count; i += 1) out[i] = a[i].cubic_slerp(b[i], pre_a[i], post_b[i], 0.3f);
+	}));
+
+	std::printf("%-28s %10.2f\n", "batch::cubic_slerp", nanoseconds_per_element([&]() {
+		batch::cubic_slerp(lanes_of(0), lanes_of(1), lanes_of(2), lanes_of(3), 0.3f, lanes_of(4));
+	}));
+
+	return 0;
+}
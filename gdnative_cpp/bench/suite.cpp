@@ -0,0 +1,651 @@
+#include "godot/batch.hpp"
+#include "godot/math.hpp"
+#include "godot/mock.hpp"
+#include "godot/serialize.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Headless microbenchmarks of the core types and the cost of going through the API table, run against the
+// in-process mock so they need no engine. Prints one row per case in nanoseconds per operation, as CSV by
+// default or JSON with `--format=json`, so runs from two commits can be diffed directly.
+//
+//     suite [--format=csv|json] [--filter=<substring>] [--samples=<count>] [--label=<text>]
+//
+// Cases of a single operation include one indirect call of harness overhead, around a nanosecond. Math
+// cases only cover operations the wrappers implement natively; declared operations that are still
+// unimplemented, such as those of `Transform2D`, are added here as they land.
+
+using namespace godot;
+
+using core::real_t;
+
+static constexpr size_t element_count = 4096;
+
+static constexpr double minimum_sample_nanoseconds = 2e6;
+
+struct Case {
+	std::string group;
+
+	std::string name;
+
+	size_t operations;
+
+	std::function<void()> run;
+};
+
+struct Result {
+	Case const* benchmark;
+
+	double fastest;
+
+	double median;
+
+	size_t repetitions;
+};
+
+static std::vector<Case> cases = {};
+
+static core::Transform const identity_transform = core::Transform::of(
+	core::Basis::of(core::Vector3::of(1, 0, 0), core::Vector3::of(0, 1, 0), core::Vector3::of(0, 0, 1)),
+	core::Vector3::zero()
+);
+
+// Stops the optimizer from discarding `value` or the work that produced it.
+template<typename Type> static void keep(Type const& value) {
+#ifdef _MSC_VER
+	static void const* volatile sink;
+
+	sink = (&value);
+
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+static void add(char const* group, char const* name, size_t const operations, std::function<void()> run) {
+	cases.push_back(Case{group, name, operations, std::move(run)});
+}
+
+// Adds a case applying `function` to every index of the shared inputs.
+template<typename Function> static void add_each(char const* group, char const* name, Function const function) {
+	add(group, name, element_count, [function]() {
+		for (size_t i = 0; i < element_count; i += 1) keep(function(i));
+	});
+}
+
+static double elapsed_nanoseconds(Case const& benchmark, size_t const repetitions) {
+	auto const start = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < repetitions; i += 1) benchmark.run();
+
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start
+	).count());
+}
+
+static Result measure(Case const& benchmark, int const samples) {
+	size_t repetitions = 1;
+
+	// Warms caches and the branch predictor, then grows the repetitions until one sample is long enough
+	// for timer resolution not to matter.
+	while ((elapsed_nanoseconds(benchmark, repetitions) < minimum_sample_nanoseconds) && (repetitions < (1 << 24))) {
+		repetitions *= 2;
+	}
+
+	std::vector<double> times(static_cast<size_t>(samples));
+
+	for (double& time : times) {
+		time = (elapsed_nanoseconds(benchmark, repetitions) / static_cast<double>(repetitions * benchmark.operations));
+	}
+
+	std::sort(times.begin(), times.end());
+
+	return Result{(&benchmark), times.front(), times[(times.size() / 2)], repetitions};
+}
+
+static void register_math(std::mt19937& generator) {
+	static std::vector<core::Vector2> a2(element_count), b2(element_count), c2(element_count), d2(element_count);
+	static std::vector<core::Vector3> a3(element_count), b3(element_count), c3(element_count), d3(element_count);
+	static std::vector<core::Vector3> axes(element_count);
+	static std::vector<core::Quat> aq(element_count), bq(element_count), cq(element_count), dq(element_count);
+	static std::vector<core::Basis> ab(element_count), bb(element_count);
+	static std::vector<core::Transform> at(element_count), bt(element_count);
+	static std::vector<core::Color> ac(element_count), bc(element_count);
+	static std::vector<real_t> weights(element_count), angles(element_count);
+	std::normal_distribution<real_t> normal;
+	std::uniform_real_distribution<real_t> unit(0, 1);
+
+	auto const random_vector2 = [&]() {
+		return core::Vector2::of(normal(generator), normal(generator));
+	};
+
+	auto const random_vector3 = [&]() {
+		return core::Vector3::of(normal(generator), normal(generator), normal(generator));
+	};
+
+	auto const random_quat = [&]() {
+		return core::Quat::of(normal(generator), normal(generator), normal(generator), normal(generator)).normalized();
+	};
+
+	for (size_t i = 0; i < element_count; i += 1) {
+		a2[i] = random_vector2();
+		b2[i] = random_vector2();
+		c2[i] = random_vector2();
+		d2[i] = random_vector2();
+		a3[i] = random_vector3();
+		b3[i] = random_vector3();
+		c3[i] = random_vector3();
+		d3[i] = random_vector3();
+		axes[i] = random_vector3().normalized();
+		aq[i] = random_quat();
+		bq[i] = random_quat();
+		cq[i] = random_quat();
+		dq[i] = random_quat();
+		ab[i] = core::Basis::from_quat(aq[i]);
+		bb[i] = core::Basis::from_quat(bq[i]);
+		at[i] = core::Transform::of(ab[i], a3[i]);
+		bt[i] = core::Transform::of(bb[i], b3[i]);
+		ac[i] = core::Color::of(unit(generator), unit(generator), unit(generator), unit(generator));
+		bc[i] = core::Color::of(unit(generator), unit(generator), unit(generator), unit(generator));
+		weights[i] = unit(generator);
+		angles[i] = (unit(generator) * core::TAU);
+	}
+
+	add_each("vector2", "add", [](size_t i) { return (a2[i] + b2[i]); });
+	add_each("vector2", "multiply", [](size_t i) { return (a2[i] * b2[i]); });
+	add_each("vector2", "dot", [](size_t i) { return a2[i].dot(b2[i]); });
+	add_each("vector2", "cross", [](size_t i) { return a2[i].cross(b2[i]); });
+	add_each("vector2", "length", [](size_t i) { return a2[i].length(); });
+	add_each("vector2", "length_squared", [](size_t i) { return a2[i].length_squared(); });
+	add_each("vector2", "normalized", [](size_t i) { return a2[i].normalized(); });
+	add_each("vector2", "normalized_fast", [](size_t i) { return math::normalized<math::Precision::FAST>(a2[i]); });
+	add_each("vector2", "angle", [](size_t i) { return a2[i].angle(); });
+	add_each("vector2", "angle_to", [](size_t i) { return a2[i].angle_to(b2[i]); });
+	add_each("vector2", "rotated", [](size_t i) { return a2[i].rotated(angles[i]); });
+	add_each("vector2", "linear_interpolate", [](size_t i) { return a2[i].linear_interpolate(b2[i], weights[i]); });
+	add_each("vector2", "slerp", [](size_t i) { return a2[i].normalized().slerp(b2[i].normalized(), weights[i]); });
+
+	add_each("vector2", "cubic_interpolate", [](size_t i) {
+		return a2[i].cubic_interpolate(b2[i], c2[i], d2[i], weights[i]);
+	});
+
+	add_each("vector3", "add", [](size_t i) { return (a3[i] + b3[i]); });
+	add_each("vector3", "multiply", [](size_t i) { return (a3[i] * b3[i]); });
+	add_each("vector3", "dot", [](size_t i) { return a3[i].dot(b3[i]); });
+	add_each("vector3", "cross", [](size_t i) { return a3[i].cross(b3[i]); });
+	add_each("vector3", "length", [](size_t i) { return a3[i].length(); });
+	add_each("vector3", "normalized", [](size_t i) { return a3[i].normalized(); });
+	add_each("vector3", "normalized_fast", [](size_t i) { return math::normalized<math::Precision::FAST>(a3[i]); });
+	add_each("vector3", "angle_to", [](size_t i) { return a3[i].angle_to(b3[i]); });
+	add_each("vector3", "rotated", [](size_t i) { return a3[i].rotated(axes[i], angles[i]); });
+	add_each("vector3", "linear_interpolate", [](size_t i) { return a3[i].linear_interpolate(b3[i], weights[i]); });
+	add_each("vector3", "slerp", [](size_t i) { return axes[i].slerp(a3[i].normalized(), weights[i]); });
+
+	add_each("vector3", "cubic_interpolate", [](size_t i) {
+		return a3[i].cubic_interpolate(b3[i], c3[i], d3[i], weights[i]);
+	});
+
+	add_each("quat", "multiply", [](size_t i) { return (aq[i] * bq[i]); });
+	add_each("quat", "dot", [](size_t i) { return aq[i].dot(bq[i]); });
+	add_each("quat", "length", [](size_t i) { return aq[i].length(); });
+	add_each("quat", "normalized", [](size_t i) { return aq[i].normalized(); });
+	add_each("quat", "normalized_fast", [](size_t i) { return math::normalized<math::Precision::FAST>(aq[i]); });
+	add_each("quat", "inverse", [](size_t i) { return aq[i].inverse(); });
+	add_each("quat", "slerp", [](size_t i) { return aq[i].slerp(bq[i], weights[i]); });
+	add_each("quat", "slerp_fast", [](size_t i) {
+		return math::slerp<math::Precision::FAST>(aq[i], bq[i], weights[i]);
+	});
+
+	add_each("quat", "slerpni", [](size_t i) { return aq[i].slerpni(bq[i], weights[i]); });
+	add_each("quat", "cubic_slerp", [](size_t i) { return aq[i].cubic_slerp(bq[i], cq[i], dq[i], weights[i]); });
+
+	add_each("basis", "multiply", [](size_t i) { return (ab[i] * bb[i]); });
+	add_each("basis", "determinant", [](size_t i) { return ab[i].determinant(); });
+	add_each("basis", "inverse", [](size_t i) { return ab[i].inverse(); });
+	add_each("basis", "transposed", [](size_t i) { return ab[i].transposed(); });
+	add_each("basis", "orthonormalized", [](size_t i) { return ab[i].orthonormalized(); });
+	add_each("basis", "from_quat", [](size_t i) { return core::Basis::from_quat(aq[i]); });
+	add_each("basis", "get_rotation_quat", [](size_t i) { return ab[i].get_rotation_quat(); });
+	add_each("basis", "xform", [](size_t i) { return ab[i].xform(a3[i]); });
+	add_each("basis", "xform_inv", [](size_t i) { return ab[i].xform_inv(a3[i]); });
+
+	add_each("transform", "multiply", [](size_t i) { return (at[i] * bt[i]); });
+	add_each("transform", "affine_inverse", [](size_t i) { return at[i].affine_inverse(); });
+
+	add_each("color", "blend", [](size_t i) { return ac[i].blend(bc[i]); });
+	add_each("color", "contrasted", [](size_t i) { return ac[i].contrasted(); });
+	add_each("color", "darkened", [](size_t i) { return ac[i].darkened(weights[i]); });
+	add_each("color", "lightened", [](size_t i) { return ac[i].lightened(weights[i]); });
+	add_each("color", "inverted", [](size_t i) { return ac[i].inverted(); });
+	add_each("color", "gray", [](size_t i) { return ac[i].gray(); });
+	add_each("color", "linear_interpolate", [](size_t i) { return ac[i].linear_interpolate(bc[i], weights[i]); });
+	add_each("color", "from_hsv", [](size_t i) { return core::Color::from_hsv(ac[i].r, ac[i].g, ac[i].b); });
+	add_each("color", "to_rgba32", [](size_t i) { return ac[i].to_rgba32(); });
+
+	static std::vector<real_t> lanes[3][4];
+	static std::vector<core::Quat> quats_out(element_count);
+	static std::vector<core::Transform> transforms_out(element_count);
+	static std::vector<core::Vector3> points_out(element_count);
+	static std::vector<core::Color> colors_out(element_count);
+	static std::vector<uint8_t> bytes_out((element_count * 4));
+
+	for (std::vector<real_t>(&quat)[4] : lanes) {
+		for (std::vector<real_t>& lane : quat) lane.resize(element_count);
+	}
+
+	auto const lanes_of = [](size_t const index) {
+		return batch::QuatSpan{lanes[index][0], lanes[index][1], lanes[index][2], lanes[index][3]};
+	};
+
+	batch::gather(aq, lanes_of(0));
+	batch::gather(bq, lanes_of(1));
+
+	add("batch", "quat_gather", element_count, [=]() { batch::gather(aq, lanes_of(2)); });
+	add("batch", "quat_scatter", element_count, [=]() { batch::scatter(lanes_of(0), quats_out); });
+	add("batch", "quat_slerp", element_count, [=]() { batch::slerp(lanes_of(0), lanes_of(1), 0.3f, lanes_of(2)); });
+	add("batch", "quat_nlerp", element_count, [=]() { batch::nlerp(lanes_of(0), lanes_of(1), 0.3f, lanes_of(2)); });
+
+	add("batch", "quat_nlerp_corrected", element_count, [=]() {
+		batch::nlerp_corrected(lanes_of(0), lanes_of(1), 0.3f, lanes_of(2));
+	});
+
+	add("batch", "transform_multiply", element_count, []() { batch::multiply(at, bt, transforms_out); });
+	add("batch", "transform_affine_inverse", element_count, []() { batch::affine_inverse(at, transforms_out); });
+	add("batch", "transform_xform", element_count, []() { batch::xform(at[0], a3, points_out); });
+	add("batch", "color_blend", element_count, []() { batch::blend(ac, bc, colors_out); });
+	add("batch", "color_contrasted", element_count, []() { batch::contrasted(ac, colors_out); });
+	add("batch", "color_darkened", element_count, []() { batch::darkened(ac, 0.25f, colors_out); });
+	add("batch", "color_inverted", element_count, []() { batch::inverted(ac, colors_out); });
+	add("batch", "color_to_srgb", element_count, []() { batch::to_srgb(ac, colors_out); });
+
+	add("batch", "color_linear_interpolate", element_count, []() {
+		batch::linear_interpolate(ac, bc, 0.3f, colors_out);
+	});
+
+	add("batch", "color_pack_rgba8", element_count, []() {
+		batch::pack_rgba8(ac, batch::ChannelOrder::RGBA, bytes_out);
+	});
+}
+
+static void register_strings() {
+	static core::String const text = core::String("player_character_name");
+	static core::String const unicode = core::String("Ünïcødé ✓ 𝄞 😀 player name");
+
+	add("string", "construct_ascii", 1, []() { keep(core::String("player_character_name")); });
+	add("string", "construct_unicode", 1, []() { keep(core::String("Ünïcødé ✓ 𝄞 😀 player name")); });
+	add("string", "copy", 1, []() { keep(core::String(text)); });
+	add("string", "length", 1, []() { keep(text.length()); });
+
+	add("string", "to_utf8", 1, []() {
+		godot_char_string utf8 = core::api_core->godot_string_utf8(unicode.handleof());
+
+		keep(utf8);
+		core::api_core->godot_char_string_destroy(&utf8);
+	});
+}
+
+// Boxing is construction plus destruction of a variant holding `value`, and unboxing reads it back out.
+template<typename Type, typename Unbox> static void add_variant(
+	char const* type,
+	Type const& value,
+	Unbox const unbox
+) {
+	static core::Variant const boxed = core::Variant(value);
+
+	add("variant_box", type, 1, [value]() { keep(core::Variant(value)); });
+	add("variant_unbox", type, 1, [unbox]() { keep(unbox(boxed.handleof())); });
+}
+
+static void register_variants() {
+	godot_gdnative_core_api_struct const& api = *core::api_core;
+
+	add_variant("int", static_cast<int64_t>(42), api.godot_variant_as_int);
+	add_variant("vector2", core::Vector2::of(1, 2), api.godot_variant_as_vector2);
+	add_variant("vector3", core::Vector3::of(1, 2, 3), api.godot_variant_as_vector3);
+	add_variant("quat", core::Quat::of(0, 0, 0, 1), api.godot_variant_as_quat);
+	add_variant("color", core::Color::of(1, 0.5f, 0.25f, 1), api.godot_variant_as_color);
+	add_variant("basis", identity_transform.basis, api.godot_variant_as_basis);
+	add_variant("transform", identity_transform, api.godot_variant_as_transform);
+
+	add_variant("string", core::String("player_character_name"), [](godot_variant const* variant) {
+		return core::String(core::api_core->godot_variant_as_string(variant));
+	});
+
+	add_variant("array", core::Array(), [](godot_variant const* variant) {
+		return core::Array(core::api_core->godot_variant_as_array(variant));
+	});
+
+	add_variant("dictionary", core::Dictionary(), [](godot_variant const* variant) {
+		return core::Dictionary(core::api_core->godot_variant_as_dictionary(variant));
+	});
+
+	static core::Variant const source = core::Variant(core::String("copied"));
+
+	add("variant", "copy_string", 1, []() { keep(core::Variant(source)); });
+	add("variant", "type_of", 1, []() { keep(source.type_of()); });
+}
+
+static void register_containers() {
+	static core::Array array;
+	static core::Dictionary dictionary;
+	static std::vector<core::Variant> keys;
+
+	keys.reserve(element_count);
+
+	for (size_t i = 0; i < element_count; i += 1) {
+		keys.emplace_back(static_cast<int64_t>(i));
+
+		core::api_core->godot_array_append(array.handleof(), keys[i].handleof());
+		core::api_core->godot_dictionary_set(dictionary.handleof(), keys[i].handleof(), keys[i].handleof());
+	}
+
+	add("array", "append", element_count, []() {
+		core::Array appended;
+
+		for (core::Variant const& key : keys) core::api_core->godot_array_append(appended.handleof(), key.handleof());
+	});
+
+	add("array", "index", element_count, []() {
+		for (size_t i = 0; i < element_count; i += 1) {
+			keep(core::api_core->godot_array_operator_index_const(array.handleof(), static_cast<godot_int>(i)));
+		}
+	});
+
+	add("array", "get_copy", element_count, []() {
+		for (size_t i = 0; i < element_count; i += 1) {
+			keep(core::Variant(core::api_core->godot_array_get(array.handleof(), static_cast<godot_int>(i))));
+		}
+	});
+
+	add("array", "iterate_unbox_int", element_count, []() {
+		int64_t total = 0;
+
+		for (godot_int i = 0, size = array.size(); i < size; i += 1) {
+			total += core::api_core->godot_variant_as_int(
+				core::api_core->godot_array_operator_index_const(array.handleof(), i)
+			);
+		}
+
+		keep(total);
+	});
+
+	add("dictionary", "set", element_count, []() {
+		core::Dictionary filled;
+
+		for (core::Variant const& key : keys) {
+			core::api_core->godot_dictionary_set(filled.handleof(), key.handleof(), key.handleof());
+		}
+	});
+
+	add("dictionary", "index", element_count, []() {
+		for (core::Variant const& key : keys) {
+			keep(core::api_core->godot_dictionary_operator_index_const(dictionary.handleof(), key.handleof()));
+		}
+	});
+
+	add("dictionary", "has", element_count, []() {
+		for (core::Variant const& key : keys) {
+			keep(core::api_core->godot_dictionary_has(dictionary.handleof(), key.handleof()));
+		}
+	});
+
+	add("dictionary", "iterate", element_count, []() {
+		godot_variant const* key = core::api_core->godot_dictionary_next(dictionary.handleof(), nullptr);
+
+		while (key != nullptr) key = core::api_core->godot_dictionary_next(dictionary.handleof(), key);
+	});
+
+	static core::PoolVector3Array points;
+
+	points.resize(element_count);
+
+	add("pool", "read_lock", 1, []() { keep(points.read().span().data()); });
+	add("pool", "write_lock", 1, []() { keep(points.write().span().data()); });
+
+	add("pool", "read_sum", element_count, []() {
+		core::Vector3 total = core::Vector3::zero();
+
+		for (core::Vector3 const& point : points.read().span()) total = (total + point);
+
+		keep(total);
+	});
+}
+
+static void register_method_binds() {
+	// The mock binds ignore the object they are called on, so any pointer stands in for one.
+	static godot_object * const object = reinterpret_cast<godot_object *>(&cases);
+
+	mock::bind_method("BenchObject", "add", mock::MethodBind{
+		[](godot_object *, void const** arguments, void * result) {
+			*static_cast<int64_t *>(result) = (
+				*static_cast<int64_t const*>(arguments[0]) +
+				*static_cast<int64_t const*>(arguments[1])
+			);
+		},
+
+		[](godot_object *, godot_variant const** arguments, int) {
+			godot_variant result;
+
+			core::api_core->godot_variant_new_int((&result), (
+				core::api_core->godot_variant_as_int(arguments[0]) +
+				core::api_core->godot_variant_as_int(arguments[1])
+			));
+
+			return result;
+		}
+	});
+
+	static godot_method_bind * const method = core::api_core->godot_method_bind_get_method("BenchObject", "add");
+
+	add("method_bind", "get_method", 1, []() {
+		keep(core::api_core->godot_method_bind_get_method("BenchObject", "add"));
+	});
+
+	add("method_bind", "ptrcall", 1, []() {
+		int64_t const a = 1, b = 2;
+		void const* arguments[] = {(&a), (&b)};
+		int64_t result;
+
+		core::api_core->godot_method_bind_ptrcall(method, object, arguments, (&result));
+		keep(result);
+	});
+
+	add("method_bind", "call", 1, []() {
+		core::Variant const a = core::Variant(static_cast<int64_t>(1)), b = core::Variant(static_cast<int64_t>(2));
+		godot_variant const* arguments[] = {a.handleof(), b.handleof()};
+		godot_variant_call_error error;
+
+		keep(core::Variant(core::api_core->godot_method_bind_call(method, object, arguments, 2, (&error))));
+	});
+
+	godot_instance_create_func const create = {
+		[](godot_object *, void *) -> void * { return nullptr; },
+		nullptr,
+		nullptr
+	};
+
+	godot_instance_destroy_func const destroy = {[](godot_object *, void *, void *) { }, nullptr, nullptr};
+
+	godot_instance_method const method_add = {
+		[](godot_object *, void *, void *, int, godot_variant ** arguments) {
+			godot_variant result;
+
+			core::api_core->godot_variant_new_int((&result), (
+				core::api_core->godot_variant_as_int(arguments[0]) +
+				core::api_core->godot_variant_as_int(arguments[1])
+			));
+
+			return result;
+		},
+
+		nullptr,
+		nullptr
+	};
+
+	core::api_nativescript->godot_nativescript_register_class(nullptr, "BenchScript", "Reference", create, destroy);
+
+	core::api_nativescript->godot_nativescript_register_method(
+		nullptr,
+		"BenchScript",
+		"add",
+		godot_method_attributes{GODOT_METHOD_RPC_MODE_DISABLED},
+		method_add
+	);
+
+	static godot_object * const instance = mock::instantiate("BenchScript");
+
+	add("nativescript", "call", 1, []() {
+		core::Variant a = core::Variant(static_cast<int64_t>(1)), b = core::Variant(static_cast<int64_t>(2));
+		godot_variant * arguments[] = {a.handleof(), b.handleof()};
+
+		keep(core::Variant(mock::call(instance, "add", arguments, 2)));
+	});
+}
+
+static void register_serialize() {
+	static constexpr size_t entity_count = 256;
+	static core::PoolByteArray encoded;
+	core::Array entities;
+
+	for (size_t i = 0; i < entity_count; i += 1) {
+		core::Dictionary entity;
+		core::Variant const id_key = core::Variant(core::String("id")), id = core::Variant(static_cast<int64_t>(i));
+		core::Variant const name_key = core::Variant(core::String("name"));
+		core::Variant const name = core::Variant(core::String("Goblin"));
+		core::Variant const at_key = core::Variant(core::String("at")), at = core::Variant(identity_transform);
+
+		core::api_core->godot_dictionary_set(entity.handleof(), id_key.handleof(), id.handleof());
+		core::api_core->godot_dictionary_set(entity.handleof(), name_key.handleof(), name.handleof());
+		core::api_core->godot_dictionary_set(entity.handleof(), at_key.handleof(), at.handleof());
+		core::api_core->godot_array_append(entities.handleof(), core::Variant(entity).handleof());
+	}
+
+	static core::Variant const world = core::Variant(entities);
+
+	serialize::encode(world, encoded);
+
+	add("serialize", "encode_entity", entity_count, []() { serialize::encode(world, encoded); });
+
+	add("serialize", "decode_entity", entity_count, []() {
+		core::Variant decoded;
+
+		serialize::decode(encoded.read().span(), decoded);
+	});
+}
+
+static void print_json_string(std::string const& text) {
+	std::putchar('"');
+
+	for (char const character : text) {
+		if ((character == '"') || (character == '\\')) std::putchar('\\');
+
+		std::putchar(character);
+	}
+
+	std::putchar('"');
+}
+
+int main(int const argument_count, char const* const* arguments) {
+	std::string format = "csv", filter, label;
+	int samples = 7;
+
+	for (int i = 1; i < argument_count; i += 1) {
+		std::string const argument = arguments[i];
+
+		if (argument.starts_with("--format=")) {
+			format = argument.substr(9);
+		} else if (argument.starts_with("--filter=")) {
+			filter = argument.substr(9);
+		} else if (argument.starts_with("--samples=")) {
+			samples = std::max(1, std::atoi(argument.c_str() + 10));
+		} else if (argument.starts_with("--label=")) {
+			label = argument.substr(8);
+		} else {
+			std::fprintf(
+				stderr,
+				"usage: %s [--format=csv|json] [--filter=text] [--samples=n] [--label=text]\n",
+				arguments[0]
+			);
+
+			return 1;
+		}
+	}
+
+	if ((format != "csv") && (format != "json")) {
+		std::fprintf(stderr, "unknown format '%s'\n", format.c_str());
+
+		return 1;
+	}
+
+	std::mt19937 generator(1);
+
+	mock::install();
+	register_math(generator);
+	register_strings();
+	register_variants();
+	register_containers();
+	register_method_binds();
+	register_serialize();
+
+	std::vector<Result> results;
+
+	for (Case const& benchmark : cases) {
+		if (filter.empty() || (benchmark.group + "/" + benchmark.name).find(filter) != std::string::npos) {
+			results.push_back(measure(benchmark, samples));
+		}
+	}
+
+	if (format == "csv") {
+		std::printf("label,group,name,operations,repetitions,ns_per_op_min,ns_per_op_median\n");
+
+		for (Result const& result : results) {
+			std::printf(
+				"%s,%s,%s,%zu,%zu,%.3f,%.3f\n",
+				label.c_str(),
+				result.benchmark->group.c_str(),
+				result.benchmark->name.c_str(),
+				result.benchmark->operations,
+				result.repetitions,
+				result.fastest,
+				result.median
+			);
+		}
+	} else {
+		std::printf("{\"label\": ");
+		print_json_string(label);
+		std::printf(", \"samples\": %d, \"results\": [", samples);
+
+		for (size_t i = 0; i < results.size(); i += 1) {
+			Result const& result = results[i];
+
+			std::printf("%s\n\t{\"group\": ", ((i == 0) ? "" : ","));
+			print_json_string(result.benchmark->group);
+			std::printf(", \"name\": ");
+			print_json_string(result.benchmark->name);
+
+			std::printf(
+				", \"operations\": %zu, \"repetitions\": %zu, \"ns_per_op_min\": %.3f, \"ns_per_op_median\": %.3f}",
+				result.benchmark->operations,
+				result.repetitions,
+				result.fastest,
+				result.median
+			);
+		}
+
+		std::printf("\n]}\n");
+	}
+
+	return 0;
+}
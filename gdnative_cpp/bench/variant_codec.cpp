@@ -0,0 +1,188 @@
+#include "godot/serialize.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+// Runs inside the engine, since the comparison needs its `var2bytes` encoder. Load the library as a GDNative
+// singleton and the timings against `StreamPeer.put_var` and `get_var` print at startup.
+
+using namespace godot;
+
+static constexpr int entity_count = 20000;
+
+static constexpr int point_count = (2 * 1024 * 1024);
+
+static constexpr int iterations = 5;
+
+static void print(char const* line) {
+	core::String const string = core::String(line);
+
+	core::api_core->godot_print(string.handleof());
+}
+
+static void report(char const* format, double const size, double const encode_time, double const decode_time) {
+	char line[128];
+
+	std::snprintf(
+		line,
+		sizeof(line),
+		"%-10s %9.2f %10.2f %10.2f",
+		format,
+		(size / (1024 * 1024)),
+		encode_time,
+		decode_time
+	);
+
+	print(line);
+}
+
+template<typename Function> static double best_milliseconds(Function const& function) {
+	double best = 0;
+
+	for (int i = 0; i < iterations; i += 1) {
+		auto const start = std::chrono::steady_clock::now();
+
+		function();
+
+		double const elapsed = std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - start
+		).count();
+
+		if ((i == 0) || (elapsed < best)) best = elapsed;
+	}
+
+	return best;
+}
+
+static core::Variant call(
+	godot_method_bind * method,
+	core::Object object,
+	std::initializer_list<core::Variant const*> const arguments
+) {
+	godot_variant_call_error error;
+
+	return core::Variant(core::api_core->godot_method_bind_call(
+		method,
+		object.handleof(),
+		reinterpret_cast<godot_variant const**>(const_cast<core::Variant const**>(arguments.begin())),
+		static_cast<int>(arguments.size()),
+		(&error)
+	));
+}
+
+static void set(core::Dictionary& dictionary, char const* key, core::Variant const& value) {
+	core::Variant const name = core::Variant(core::String(key));
+
+	core::api_core->godot_dictionary_set(dictionary.handleof(), name.handleof(), value.handleof());
+}
+
+static void append(core::Array& array, core::Variant const& value) {
+	core::api_core->godot_array_append(array.handleof(), value.handleof());
+}
+
+// A save-game shaped tree: many small entity dictionaries of mixed types, plus a few large pool arrays
+// of terrain and navigation data, around 50MB in all.
+static core::Variant world_state() {
+	std::mt19937 generator(1);
+	std::uniform_real_distribution<core::real_t> distribution(-1000, 1000);
+	core::Array entities, world;
+
+	for (int i = 0; i < entity_count; i += 1) {
+		core::Dictionary entity;
+		core::Transform transform = core::Transform{};
+		godot_variant health;
+
+		transform.origin = core::Vector3::of(
+			distribution(generator),
+			distribution(generator),
+			distribution(generator)
+		);
+
+		core::api_core->godot_variant_new_real((&health), (i * 0.5));
+
+		set(entity, "id", core::Variant(static_cast<int64_t>(i)));
+		set(entity, "name", core::Variant(core::String((i % 2) ? "Goblin" : "Villager")));
+		set(entity, "health", core::Variant(health));
+		set(entity, "transform", core::Variant(transform));
+		set(entity, "tint", core::Variant(core::Color::of(1, 0.5f, 0.25f, 1)));
+		append(entities, core::Variant(entity));
+	}
+
+	core::PoolVector3Array points;
+	core::PoolRealArray heights;
+	core::PoolByteArray flags;
+
+	points.resize(point_count);
+	heights.resize(point_count);
+	flags.resize(point_count);
+
+	{
+		core::PoolArrayWrite<core::Vector3> const written_points = points.write();
+		core::PoolArrayWrite<core::real_t> const written_heights = heights.write();
+		core::PoolArrayWrite<uint8_t> const written_flags = flags.write();
+
+		for (int i = 0; i < point_count; i += 1) {
+			written_points[i] = core::Vector3::of(distribution(generator), 0, distribution(generator));
+			written_heights[i] = distribution(generator);
+			written_flags[i] = static_cast<uint8_t>(i);
+		}
+	}
+
+	append(world, core::Variant(entities));
+	append(world, core::Variant(points));
+	append(world, core::Variant(heights));
+	append(world, core::Variant(flags));
+
+	return core::Variant(world);
+}
+
+static void run() {
+	core::Variant const world = world_state();
+	core::PoolByteArray encoded;
+	core::Variant decoded;
+
+	double const encode_time = best_milliseconds([&]() {
+		serialize::encode(world, encoded);
+	});
+
+	double const decode_time = best_milliseconds([&]() {
+		serialize::decode(encoded.read().span(), decoded);
+	});
+
+	core::Object buffer = core::Object(core::api_core->godot_get_class_constructor("StreamPeerBuffer")());
+	godot_method_bind * const clear = core::api_core->godot_method_bind_get_method("StreamPeerBuffer", "clear");
+	godot_method_bind * const seek = core::api_core->godot_method_bind_get_method("StreamPeerBuffer", "seek");
+	godot_method_bind * const get_size = core::api_core->godot_method_bind_get_method("StreamPeerBuffer", "get_size");
+	godot_method_bind * const put_var = core::api_core->godot_method_bind_get_method("StreamPeer", "put_var");
+	godot_method_bind * const get_var = core::api_core->godot_method_bind_get_method("StreamPeer", "get_var");
+	core::Variant const zero = core::Variant(static_cast<int64_t>(0));
+
+	double const engine_encode_time = best_milliseconds([&]() {
+		call(clear, buffer, {});
+		call(put_var, buffer, {(&world), (&zero)});
+	});
+
+	double const engine_decode_time = best_milliseconds([&]() {
+		call(seek, buffer, {(&zero)});
+		call(get_var, buffer, {(&zero)});
+	});
+
+	double const engine_size = static_cast<double>(core::api_core->godot_variant_as_int(
+		call(get_size, buffer, {}).handleof()
+	));
+
+	print("format       size MB  encode ms  decode ms");
+	report("serialize", static_cast<double>(encoded.size()), encode_time, decode_time);
+	report("var2bytes", engine_size, engine_encode_time, engine_decode_time);
+
+	core::api_core->godot_object_destroy(buffer.handleof());
+}
+
+extern "C" GDN_EXPORT void godot_gdnative_init(godot_gdnative_init_options * options) {
+	core::gdnative_init(options);
+}
+
+extern "C" GDN_EXPORT void godot_gdnative_singleton() {
+	run();
+}
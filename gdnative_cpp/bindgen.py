@@ -1,5 +1,9 @@
 from contextlib import contextmanager
+import argparse
 import json
+import os
+import re
+import sys
 
 class Document:
 	def __init__(self, parent: "Document", default_list):
@@ -99,7 +103,7 @@ def new_namespace(root: Root, name: str) -> Namespace:
 	try:
 		yield Namespace(root, elements)
 	finally:
-		elements.append("};\n")
+		elements.append("}\n")
 		root.elements.append(str().join(elements))
 
 core_types = [
@@ -153,60 +157,90 @@ array_type_names = [
 	"godot::core::PoolColorArray",
 ]
 
-def new_method_declaration(document: Document, method: dict) -> None:
-	def parse_type(type_name: str) -> str:
-		if (type_name in core_types):
-			return ("godot::core::" + type_name)
-		else:
-			enum_prefix = "enum."
+def parse_type(type_name: str) -> str:
+	if (type_name in core_types):
+		return ("godot::core::" + type_name)
+	else:
+		enum_prefix = "enum."
+
+		if (type_name.startswith(enum_prefix)):
+			return type_name[(type_name.find(enum_prefix) + len(enum_prefix)):]
+
+	return type_name
+
+def parse_literal(type_name: str, literal: str) -> str:
+	if (type_name == "bool"):
+		return literal.lower()
+
+	if ((type_name == "godot::core::Vector2") or (type_name == "godot::core::Vector3")):
+		return (type_name + "::of" + literal)
+
+	if (type_name == "godot::core::Color"):
+		return (type_name + "::of(" + literal + ")")
+
+	if (type_name == "godot::core::Rect2"):
+		return (type_name + "::from_bounds" + literal)
 
-			if (type_name.startswith(enum_prefix)):
-				return type_name[(type_name.find(enum_prefix) + len(enum_prefix)):]
+	if ((type_name == "godot::core::Transform2D") or (type_name == "godot::core::Transform")):
+		# TODO
+		return (type_name + "::zero()")
 
-		return type_name
+	if (type_name == "godot::core::String"):
+		return (type_name + "(\"" + literal + "\")")
 
-	def parse_literal(type_name: str, literal: str) -> str:
-		if (type_name == "bool"):
-			return literal.lower()
+	if (type_name in array_type_names):
+		return (type_name + "()")
 
-		if ((type_name == "godot::core::Vector2") or (type_name == "godot::core::Vector3")):
-			return (type_name + "::of" + literal)
+	if ((literal == "Null") or (literal == "[Object:null]")):
+		return (type_name + "()")
 
-		if (type_name == "godot::core::Color"):
-			return (type_name + "::of(" + literal + ")")
+	if (type_name == "godot::core::Variant"):
+		return ("godot::core::Variant(" + literal + ")")
 
-		if (type_name == "godot::core::Rect2"):
-			return (type_name + "::from_bounds" + literal)
+	if (literal == "[RID]"):
+		return "RID()"
 
-		if ((type_name == "godot::core::Transform2D") or (type_name == "godot::core::Transform")):
-			# TODO
-			return (type_name + "::zero()")
+	return literal
 
-		if (type_name == "godot::core::String"):
-			return (type_name + "(\"" + literal + "\")")
+def escape_keywords(text: str) -> str:
+	return (text + "_") if (text in reserved_keywords) else text
 
-		if (type_name in array_type_names):
-			return (type_name + "()")
+# How a value of an api.json type crosses ptrcall: integers and enums as `int64_t`, floats as `double`, and
+# everything else in core.hpp as the handle its wrapper holds, which for `Object` is the object pointer
+# itself. Engine classes are not passed yet.
+def ptrcall_type(type_name: str) -> str:
+	if ((type_name == "int") or (type_name == "Error") or type_name.startswith("enum.")):
+		return "int64_t"
 
-		if ((literal == "Null") or (literal == "[Object:null]")):
-			return (type_name + "()")
+	if (type_name == "float"):
+		return "double"
 
-		if (type_name == "godot::core::Variant"):
-			return ("godot::core::Variant(" + literal + ")")
+	if ((type_name == "bool") or (type_name in core_types)):
+		return parse_type(type_name)
 
-		if (literal == "[RID]"):
-			return "RID()"
+	return ""
 
-		return literal
+def is_ptrcall_method(method: dict) -> bool:
+	if ((method["return_type"] != "void") and (not ptrcall_type(method["return_type"]))):
+		return False
 
-	def escape_keywords(text: str) -> str:
-		return (text + "_") if (text in reserved_keywords) else text
+	for argument in method["arguments"]:
+		if (not ptrcall_type(argument["type"])):
+			return False
 
+	return True
+
+def method_signature(method: dict, class_name = "") -> str:
 	elements = []
 
-	document.indent(elements)
 	elements.append(parse_type(method["return_type"]))
 	elements.append(" ")
+
+	# Out-of-line definitions are qualified and leave the default arguments to the declaration.
+	if (class_name):
+		elements.append(class_name)
+		elements.append("::")
+
 	elements.append(escape_keywords(method["name"]))
 	elements.append("(")
 
@@ -220,7 +254,7 @@ def new_method_declaration(document: Document, method: dict) -> None:
 			elements.append(" ")
 			elements.append(escape_keywords(argument["name"]))
 
-			if (argument["has_default_value"]):
+			if (argument["has_default_value"] and (not class_name)):
 				elements.append(" = ")
 
 				elements.append(parse_literal(
@@ -235,46 +269,430 @@ def new_method_declaration(document: Document, method: dict) -> None:
 	elements.append(")")
 
 	if (method["is_const"]):
-		elements.append(" const;\n")
+		elements.append(" const")
+
+	return str().join(elements)
+
+def new_method_declaration(document: Document, method: dict) -> None:
+	new_line(document, (method_signature(method) + ";"))
+
+def method_bind_name(method: dict) -> str:
+	return (method["name"] + "_bind")
+
+# Defines `method` as a direct ptrcall of its method bind, which `bind_methods` looks up at library load.
+def new_ptrcall_method(document: Document, class_name: str, method: dict) -> None:
+	return_type = method["return_type"]
+	arguments = method["arguments"]
+	argument_slots = []
+
+	new_line(document, (method_signature(method, class_name) + " {"))
+
+	for argument in arguments:
+		name = escape_keywords(argument["name"])
+		passed_type = ptrcall_type(argument["type"])
+
+		# The engine reads an object argument's slot as the object pointer itself, not as its address.
+		if (argument["type"] == "Object"):
+			argument_slots.append(name + ".handleof()")
+		elif (passed_type == parse_type(argument["type"])):
+			argument_slots.append("(&" + name + ")")
+		else:
+			new_line(document, (
+				"\t" + passed_type + " const " + name + "_passed = static_cast<" + passed_type + ">(" + name + ");"
+			))
+
+			argument_slots.append("(&" + name + "_passed)")
+
+	if (len(arguments) != 0):
+		new_line(document, ("\tvoid const* arguments[] = {" + ", ".join(argument_slots) + "};"))
+
+	ptrcall = (
+		"core::api_core->godot_method_bind_ptrcall(" + method_bind_name(method) + ", this->owner, " +
+		("arguments" if (len(arguments) != 0) else "nullptr")
+	)
+
+	# Off the main thread the call is reported and skipped, and the method returns the zero value.
+	if (return_type == "void"):
+		new_line(document, ("\tif (GD_MAIN_THREAD_ONLY()) " + ptrcall + ", nullptr);"))
 	else:
-		elements.append(";\n")
+		passed_type = ptrcall_type(return_type)
 
-	document.elements.append(str().join(elements))
+		if (return_type == "Object"):
+			passed_type = "godot_object *"
 
-document = Root(None, [])
-api_file_path = "../godot_headers/api.json"
-engine_header_file_path = "./godot/engine.hpp"
+		if (passed_type in ["int64_t", "double", "bool"]):
+			new_line(document, ("\t" + passed_type + " result = 0;"))
+		elif (passed_type == "godot_object *"):
+			new_line(document, ("\t" + passed_type + " result = nullptr;"))
+		else:
+			new_line(document, ("\t" + passed_type + " result;"))
 
-with open(api_file_path, "r") as api_file:
-	api = json.load(api_file)
+		new_line(document, ("\tif (GD_MAIN_THREAD_ONLY()) " + ptrcall + ", (&result));"))
+
+		if (passed_type == parse_type(return_type)):
+			new_line(document, "\treturn result;")
+		elif (return_type == "Object"):
+			new_line(document, ("\treturn " + parse_type(return_type) + "(result);"))
+		else:
+			new_line(document, ("\treturn static_cast<" + parse_type(return_type) + ">(result);"))
+
+	new_line(document, "}")
+
+# Names of the methods of `godot_class` to define through ptrcall, and `get_<property>` and `set_<property>`
+# aliases to add where the getter or setter is named differently, such as `is_visible` for `visible`.
+def property_accessors(godot_class: dict) -> tuple:
+	methods = {method["name"]: method for method in godot_class["methods"]}
+	defined = set()
+	aliases = []
+
+	for godot_property in godot_class["properties"]:
+		index = godot_property.get("index", -1)
+		argument_count = (0 if (index == -1) else 1)
+		property_name = godot_property["name"]
+
+		if ("/" in property_name):
+			continue
+
+		for prefix, accessor_key, extra_arguments in [("get_", "getter", 0), ("set_", "setter", 1)]:
+			method = methods.get(godot_property[accessor_key])
+
+			if ((method is None) or (len(method["arguments"]) != (argument_count + extra_arguments))):
+				continue
+
+			if (not is_ptrcall_method(method)):
+				continue
+
+			defined.add(method["name"])
+
+			alias_name = (prefix + property_name)
+
+			if ((alias_name != method["name"]) and (alias_name not in methods)):
+				aliases.append((alias_name, method, index))
+
+	return (defined, aliases)
+
+def new_property_alias(document: Document, alias_name: str, method: dict, index: int) -> None:
+	arguments = method["arguments"]
+	forwarded = []
+
+	if (index != -1):
+		forwarded.append("static_cast<" + parse_type(arguments[0]["type"]) + ">(" + str(index) + ")")
+
+	if (method["return_type"] == "void"):
+		value = arguments[-1]
+		value_name = escape_keywords(value["name"])
+
+		forwarded.append(value_name)
+
+		new_line(document, (
+			"void " + alias_name + "(" + parse_type(value["type"]) + " " + value_name + ") {"
+		))
+
+		new_line(document, ("\tthis->" + escape_keywords(method["name"]) + "(" + ", ".join(forwarded) + ");"))
+	else:
+		qualifier = (" const" if method["is_const"] else "")
+
+		new_line(document, (parse_type(method["return_type"]) + " " + alias_name + "()" + qualifier + " {"))
+		new_line(document, ("\treturn this->" + escape_keywords(method["name"]) + "(" + ", ".join(forwarded) + ");"))
+
+	new_line(document, "}")
+
+def new_singleton_accessors(document: Document, class_name: str, singleton_name: str) -> None:
+	new_line(document, ("static " + class_name + " get_singleton() {"))
+	new_line(document, ("\treturn " + class_name + "::of(singleton_handle);"))
+	new_line(document, "}")
+	new_line(document)
+	new_line(document, "/// Resolves the singleton by name, which costs a string parse and a map search in the engine.")
+	new_line(document, "static void bind_singleton() {")
+
+	new_line(document, (
+		"\tsingleton_handle = godot::core::api_core->godot_global_get_singleton(const_cast<char *>(\"" +
+		singleton_name +
+		"\"));"
+	))
+
+	new_line(document, "}")
+	new_line(document)
+
+# `Node2D` to `node_2d`, `ARVRServer` to `arvr_server` and `_OS` to `os`, for generated file names.
+def file_name_of(class_name: str) -> str:
+	name = class_name.lstrip("_")
+	name = re.sub(r"([A-Z]+)([A-Z][a-z])", r"\1_\2", name)
+	name = re.sub(r"([a-z])([A-Z0-9])", r"\1_\2", name)
+
+	return name.lower()
+
+# Lines are `Class` to keep every method of a class or `Class.method` to keep only the methods listed, with
+# `#` starting a comment. Returns the kept method names by class, with `None` for every method.
+def load_manifest(manifest_path: str) -> dict:
+	kept = {}
+
+	with open(manifest_path, "r") as manifest_file:
+		for line in manifest_file:
+			entry = line.split("#")[0].strip()
+
+			if (not entry):
+				continue
+
+			class_name, _, method_name = entry.partition(".")
+
+			if (not method_name):
+				kept[class_name] = None
+			elif (kept.get(class_name, set()) is not None):
+				kept.setdefault(class_name, set()).add(method_name)
+
+	return kept
+
+# Applies the manifest to `api`. Base classes of kept classes are kept too, without methods of their own
+# unless listed, so that every generated header can include its base.
+def strip_api(api: list, kept: dict) -> list:
+	classes = {godot_class["name"]: godot_class for godot_class in api}
+	methods_by_class = dict(kept)
+
+	for class_name in kept:
+		if (class_name not in classes):
+			print("warning: " + class_name + " in the manifest is not in api.json")
+
+			continue
+
+		base_name = classes[class_name]["base_class"]
+
+		while (base_name and (base_name not in methods_by_class)):
+			methods_by_class[base_name] = set()
+			base_name = classes[base_name]["base_class"]
+
+	stripped = []
+
+	for godot_class in api:
+		if (godot_class["name"] not in methods_by_class):
+			continue
+
+		method_names = methods_by_class[godot_class["name"]]
+
+		if (method_names is not None):
+			godot_class = dict(godot_class)
+
+			godot_class["methods"] = [
+				method for method in godot_class["methods"] if (method["name"] in method_names)
+			]
+
+		stripped.append(godot_class)
+
+	return stripped
+
+# Engine classes named in the signatures of `godot_class`, which its header declares ahead of use.
+def referenced_classes(godot_class: dict, class_names: set) -> list:
+	referenced = set()
+
+	for method in godot_class["methods"]:
+		for type_name in ([method["return_type"]] + [argument["type"] for argument in method["arguments"]]):
+			if ((type_name in class_names) and (type_name != godot_class["name"])):
+				referenced.add(type_name)
+
+	return sorted(referenced)
+
+def write_document(path: str, document: Root) -> None:
+	with open(path, "w") as output_file:
+		output_file.write(str(document))
+
+def new_class_header(godot_class: dict, class_names: set) -> Root:
+	document = Root(None, [])
+	class_name = godot_class["name"]
+	base_name = godot_class["base_class"]
+	guard = ("GODOT_ENGINE_" + file_name_of(class_name).upper() + "_H")
+	is_singleton = godot_class.get("singleton", False)
+	ptrcall_methods, property_aliases = property_accessors(godot_class)
+
+	new_pragma(document, ("ifndef " + guard))
+	new_pragma(document, ("define " + guard))
+	new_line(document)
+
+	if (base_name):
+		new_pragma(document, ("include \"godot/engine/" + file_name_of(base_name) + ".hpp\""))
+	else:
+		new_pragma(document, "include \"godot/core.hpp\"")
+
+	new_line(document)
+
+	with new_namespace(document, "godot::engine") as namespace:
+		forward_declarations = referenced_classes(godot_class, class_names)
+
+		for referenced in forward_declarations:
+			new_line(namespace, ("class " + referenced + ";"))
+
+		if (len(forward_declarations) != 0):
+			new_line(namespace)
+
+		with new_class(namespace, class_name, base_name) as class_:
+			if (is_singleton):
+				new_line(class_, "static inline godot_object * singleton_handle = nullptr;")
+				new_line(class_)
+
+			# The root class holds the object every generated call is made on.
+			if (not base_name):
+				new_line(class_, "protected:")
+				new_line(class_, "godot_object * owner = nullptr;")
+				new_line(class_)
+
+			new_line(class_, "public:")
+			new_line(class_, ("static " + class_name + " of(godot_object * owner) {"))
+			new_line(class_, ("\t" + class_name + " object;"))
+			new_line(class_)
+			new_line(class_, "\tobject.owner = owner;")
+			new_line(class_)
+			new_line(class_, "\treturn object;")
+			new_line(class_, "}")
+			new_line(class_)
+
+			if (not base_name):
+				new_line(class_, "constexpr godot_object * handleof() const {")
+				new_line(class_, "\treturn this->owner;")
+				new_line(class_, "}")
+				new_line(class_)
+
+			if (is_singleton):
+				new_singleton_accessors(class_, class_name, godot_class.get("singleton_name", class_name))
+
+			if (len(ptrcall_methods) != 0):
+				new_line(class_, "/// Looks up the method binds the definitions call. Called by `engine::bind`.")
+				new_line(class_, "static void bind_methods();")
+				new_line(class_)
+
+			constants = godot_class["constants"]
+
+			if (len(constants) != 0):
+				new_enum(class_, "", godot_class["constants"])
+
+			for enum in godot_class["enums"]:
+				new_enum(class_, enum["name"], enum["values"])
+
+			for method in godot_class["methods"]:
+				new_method_declaration(class_, method)
+
+			for alias_name, method, index in property_aliases:
+				new_line(class_)
+				new_property_alias(class_, alias_name, method, index)
+
+	new_line(document)
+	new_pragma(document, "endif")
+
+	return document
+
+def new_class_source(godot_class: dict) -> Root:
+	document = Root(None, [])
+	class_name = godot_class["name"]
+	ptrcall_methods, _ = property_accessors(godot_class)
+	methods = [method for method in godot_class["methods"] if (method["name"] in ptrcall_methods)]
+
+	new_pragma(document, ("include \"godot/engine/" + file_name_of(class_name) + ".hpp\""))
+	new_line(document)
+
+	with new_namespace(document, "godot::engine") as namespace:
+		for method in methods:
+			new_line(namespace, ("static godot_method_bind * " + method_bind_name(method) + " = nullptr;"))
+			new_line(namespace)
+
+		new_line(namespace, ("void " + class_name + "::bind_methods() {"))
+
+		for method in methods:
+			new_line(namespace, (
+				"\t" + method_bind_name(method) + " = core::api_core->godot_method_bind_get_method(\"" +
+				class_name + "\", \"" + method["name"] + "\");"
+			))
+
+		new_line(namespace, "}")
+
+		for method in methods:
+			new_line(namespace)
+			new_ptrcall_method(namespace, class_name, method)
+
+	return document
+
+def new_engine_header(api: list) -> Root:
+	document = Root(None, [])
 
 	new_pragma(document, "ifndef GODOT_ENGINE_H")
 	new_pragma(document, "define GODOT_ENGINE_H")
 	new_line(document)
-	new_pragma(document, "include \"godot/core.hpp\"")
+
+	for godot_class in api:
+		new_pragma(document, ("include \"godot/engine/" + file_name_of(godot_class["name"]) + ".hpp\""))
+
 	new_line(document)
 
 	with new_namespace(document, "godot::engine") as namespace:
+		new_line(namespace, "/// Resolves the singletons and method binds of every generated class once, so calls")
+		new_line(namespace, "/// through them skip the lookups by name. Call after `core::gdnative_init`.")
+		new_line(namespace, "void bind();")
+
+	new_line(document)
+	new_pragma(document, "endif")
+
+	return document
+
+def new_engine_source(api: list) -> Root:
+	document = Root(None, [])
+
+	new_pragma(document, "include \"godot/engine.hpp\"")
+	new_line(document)
+
+	with new_namespace(document, "godot::engine") as namespace:
+		new_line(namespace, "void bind() {")
+
 		for godot_class in api:
-			with new_class(namespace, godot_class["name"], godot_class["base_class"]) as class_:
-				new_line(class_, "public:")
+			if (godot_class.get("singleton", False)):
+				new_line(namespace, ("\t" + godot_class["name"] + "::bind_singleton();"))
 
-				constants = godot_class["constants"]
+		for godot_class in api:
+			if (len(property_accessors(godot_class)[0]) != 0):
+				new_line(namespace, ("\t" + godot_class["name"] + "::bind_methods();"))
 
-				if (len(constants) != 0):
-					new_enum(class_, "", godot_class["constants"])
+		new_line(namespace, "}")
 
-				for enum in godot_class["enums"]:
-					new_enum(class_, enum["name"], enum["values"])
+	return document
 
-				for method in godot_class["methods"]:
-					new_method_declaration(class_, method)
+arguments_parser = argparse.ArgumentParser(description = "Generates the engine class bindings from api.json.")
 
+arguments_parser.add_argument("--api", default = "../godot_headers/api.json")
+arguments_parser.add_argument(
+	"--output",
+	default = "./godot",
+	help = "directory to write engine.hpp and engine.cpp into"
+)
+arguments_parser.add_argument("--manifest", help = "classes and methods to generate, all when omitted")
 
-			new_line(namespace)
+arguments = arguments_parser.parse_args()
 
-	new_line(document)
-	new_pragma(document, "endif GODOT_ENGINE_H")
+with open(arguments.api, "r") as api_file:
+	api = json.load(api_file)
+
+# Taken before stripping, so that kept methods naming a stripped class still get it declared.
+class_names = {godot_class["name"] for godot_class in api}
+class_directory_path = os.path.join(arguments.output, "engine")
+
+if (arguments.manifest):
+	api = strip_api(api, load_manifest(arguments.manifest))
+
+# Classes such as `_OS` and `OS` would share a file and overwrite each other's bindings.
+class_names_by_file = {}
+
+for godot_class in api:
+	class_names_by_file.setdefault(file_name_of(godot_class["name"]), []).append(godot_class["name"])
+
+for file_name, names in sorted(class_names_by_file.items()):
+	if (len(names) > 1):
+		sys.exit("error: classes " + ", ".join(names) + " would all be written to engine/" + file_name + ".*")
+
+os.makedirs(class_directory_path, exist_ok = True)
+
+for godot_class in api:
+	file_path = os.path.join(class_directory_path, file_name_of(godot_class["name"]))
+
+	write_document((file_path + ".hpp"), new_class_header(godot_class, class_names))
+
+	if (len(property_accessors(godot_class)[0]) != 0):
+		write_document((file_path + ".cpp"), new_class_source(godot_class))
 
-	with open(engine_header_file_path, "w") as engine_header_file:
-		engine_header_file.write(str(document))
+write_document(os.path.join(arguments.output, "engine.hpp"), new_engine_header(api))
+# Beside `engine.hpp` rather than in `engine/`, where the `_Engine` class has its files.
+write_document(os.path.join(arguments.output, "engine.cpp"), new_engine_source(api))
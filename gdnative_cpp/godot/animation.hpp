@@ -0,0 +1,213 @@
+#ifndef GODOT_ANIMATION_H
+#define GODOT_ANIMATION_H
+
+#include "godot/core.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace godot::animation {
+	using core::real_t;
+
+	enum class Interpolation {
+		NEAREST,
+		LINEAR,
+		CUBIC
+	};
+
+	core::Vector2 interpolate_linear(core::Vector2 const& a, core::Vector2 const& b, real_t t);
+
+	core::Vector3 interpolate_linear(core::Vector3 const& a, core::Vector3 const& b, real_t t);
+
+	core::Quat interpolate_linear(core::Quat const& a, core::Quat const& b, real_t t);
+
+	core::Color interpolate_linear(core::Color const& a, core::Color const& b, real_t t);
+
+	core::Vector2 interpolate_cubic(
+		core::Vector2 const& pre_a,
+		core::Vector2 const& a,
+		core::Vector2 const& b,
+		core::Vector2 const& post_b,
+		real_t t
+	);
+
+	core::Vector3 interpolate_cubic(
+		core::Vector3 const& pre_a,
+		core::Vector3 const& a,
+		core::Vector3 const& b,
+		core::Vector3 const& post_b,
+		real_t t
+	);
+
+	core::Quat interpolate_cubic(
+		core::Quat const& pre_a,
+		core::Quat const& a,
+		core::Quat const& b,
+		core::Quat const& post_b,
+		real_t t
+	);
+
+	core::Color interpolate_cubic(
+		core::Color const& pre_a,
+		core::Color const& a,
+		core::Color const& b,
+		core::Color const& post_b,
+		real_t t
+	);
+
+	/// Keyframes held in two contiguous arrays, sorted by time. Sampling remembers the last segment it
+	/// landed in, so playback that moves forward by less than a key per step finds its segment in constant
+	/// time and only seeks fall back to a binary search. Because of that cache a track must not be sampled
+	/// from more than one thread at once.
+	template<typename Type> class Track final {
+		std::vector<real_t> times;
+
+		std::vector<Type> values;
+
+		Interpolation interpolation;
+
+		size_t cursor;
+
+		public:
+		Track(Interpolation const interpolation = Interpolation::LINEAR) :
+			interpolation(interpolation),
+			cursor(0) { }
+
+		void clear() {
+			this->times.clear();
+			this->values.clear();
+
+			this->cursor = 0;
+		}
+
+		/// Finds the index of the last key at or before `time`, clamped to the first key.
+		size_t find_segment(real_t const time) {
+			size_t const count = this->times.size();
+
+			if (count < 2) return 0;
+
+			if (this->cursor >= count) this->cursor = 0;
+
+			if (time >= this->times[this->cursor]) {
+				// Forward playback: stay in the cached segment or step into the next one.
+				if (((this->cursor + 1) == count) || (time < this->times[(this->cursor + 1)])) return this->cursor;
+
+				if (((this->cursor + 2) == count) || (time < this->times[(this->cursor + 2)])) {
+					this->cursor += 1;
+
+					return this->cursor;
+				}
+			}
+
+			auto const upper = std::upper_bound(this->times.begin(), this->times.end(), time);
+
+			this->cursor = ((upper == this->times.begin()) ? 0 : static_cast<size_t>(
+				(upper - this->times.begin()) - 1
+			));
+
+			return this->cursor;
+		}
+
+		constexpr Interpolation get_interpolation() const {
+			return this->interpolation;
+		}
+
+		/// Inserts a key, replacing any key at exactly the same time. Appending keys in time order is
+		/// amortized constant time.
+		void insert(real_t const time, Type const& value) {
+			if (this->times.empty() || (time > this->times.back())) {
+				this->times.push_back(time);
+				this->values.push_back(value);
+
+				return;
+			}
+
+			auto const position = std::lower_bound(this->times.begin(), this->times.end(), time);
+			size_t const index = static_cast<size_t>(position - this->times.begin());
+
+			if (*position == time) {
+				this->values[index] = value;
+			} else {
+				this->times.insert(position, time);
+				this->values.insert((this->values.begin() + index), value);
+			}
+		}
+
+		/// Reserves storage for `count` keys ahead of a bulk build.
+		void reserve(size_t const count) {
+			this->times.reserve(count);
+			this->values.reserve(count);
+		}
+
+		Type sample(real_t const time) {
+			size_t const count = this->times.size();
+
+			if (count == 0) return Type{};
+
+			size_t const index = this->find_segment(time);
+
+			if ((time <= this->times[index]) || ((index + 1) == count)) return this->values[index];
+
+			real_t const start = this->times[index];
+			real_t const weight = ((time - start) / (this->times[(index + 1)] - start));
+
+			switch (this->interpolation) {
+				case Interpolation::NEAREST: {
+					return this->values[((weight < 0.5f) ? index : (index + 1))];
+				}
+
+				case Interpolation::LINEAR: {
+					return interpolate_linear(this->values[index], this->values[(index + 1)], weight);
+				}
+
+				case Interpolation::CUBIC: {
+					return interpolate_cubic(
+						this->values[((index == 0) ? 0 : (index - 1))],
+						this->values[index],
+						this->values[(index + 1)],
+						this->values[(((index + 2) == count) ? (index + 1) : (index + 2))],
+						weight
+					);
+				}
+			}
+
+			return this->values[index];
+		}
+
+		void set_interpolation(Interpolation const interpolation) {
+			this->interpolation = interpolation;
+		}
+
+		constexpr size_t size() const {
+			return this->times.size();
+		}
+
+		constexpr real_t time_at(size_t const index) const {
+			return this->times[index];
+		}
+
+		constexpr Type const& value_at(size_t const index) const {
+			return this->values[index];
+		}
+	};
+
+	using Vector2Track = Track<core::Vector2>;
+
+	using Vector3Track = Track<core::Vector3>;
+
+	using QuatTrack = Track<core::Quat>;
+
+	using ColorTrack = Track<core::Color>;
+
+	/// Samples every track at the same `time` into `out`, which must be at least as long as `tracks`.
+	/// Disjoint chunks of `tracks` can be sampled concurrently through `jobs::parallel_for`.
+	template<typename Type> void sample_all(
+		std::span<Track<Type>> const tracks,
+		real_t const time,
+		std::span<Type> const out
+	) {
+		for (size_t i = 0; i < tracks.size(); i += 1) out[i] = tracks[i].sample(time);
+	}
+}
+
+#endif
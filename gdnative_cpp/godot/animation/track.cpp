@@ -0,0 +1,60 @@
+#include "godot/animation.hpp"
+
+namespace godot::animation {
+	core::Vector2 interpolate_linear(core::Vector2 const& a, core::Vector2 const& b, real_t t) {
+		return a.linear_interpolate(b, t);
+	}
+
+	core::Vector3 interpolate_linear(core::Vector3 const& a, core::Vector3 const& b, real_t t) {
+		return a.linear_interpolate(b, t);
+	}
+
+	core::Quat interpolate_linear(core::Quat const& a, core::Quat const& b, real_t t) {
+		return a.slerp(b, t);
+	}
+
+	core::Color interpolate_linear(core::Color const& a, core::Color const& b, real_t t) {
+		return a.linear_interpolate(b, t);
+	}
+
+	core::Vector2 interpolate_cubic(
+		core::Vector2 const& pre_a,
+		core::Vector2 const& a,
+		core::Vector2 const& b,
+		core::Vector2 const& post_b,
+		real_t t
+	) {
+		return a.cubic_interpolate(b, pre_a, post_b, t);
+	}
+
+	core::Vector3 interpolate_cubic(
+		core::Vector3 const& pre_a,
+		core::Vector3 const& a,
+		core::Vector3 const& b,
+		core::Vector3 const& post_b,
+		real_t t
+	) {
+		return a.cubic_interpolate(b, pre_a, post_b, t);
+	}
+
+	core::Quat interpolate_cubic(
+		core::Quat const& pre_a,
+		core::Quat const& a,
+		core::Quat const& b,
+		core::Quat const& post_b,
+		real_t t
+	) {
+		return a.cubic_slerp(b, pre_a, post_b, t);
+	}
+
+	core::Color interpolate_cubic(
+		core::Color const&,
+		core::Color const& a,
+		core::Color const& b,
+		core::Color const&,
+		real_t t
+	) {
+		// Colors have no cubic form in the engine, so cubic tracks blend them linearly.
+		return a.linear_interpolate(b, t);
+	}
+}
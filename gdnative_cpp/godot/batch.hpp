@@ -0,0 +1,508 @@
+#ifndef GODOT_BATCH_H
+#define GODOT_BATCH_H
+
+#include "godot/core.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace godot::batch {
+	using core::real_t;
+
+	/// Byte order of packed 8-bit colors in memory. `RGBA` matches `Image::FORMAT_RGBA8`.
+	enum class ChannelOrder {
+		RGBA,
+		ARGB,
+		ABGR,
+		BGRA
+	};
+
+	/// Structure-of-arrays view over quaternions, one span per component. Kernels taking several views stop
+	/// at the shortest span among them and leave the rest of the output untouched. Views can be split with
+	/// `subspan` to hand chunks to `jobs::parallel_for`.
+	template<typename Type> struct QuatLanes {
+		std::span<Type> x, y, z, w;
+
+		constexpr QuatLanes subspan(size_t const offset, size_t const count) const {
+			return QuatLanes{
+				this->x.subspan(offset, count),
+				this->y.subspan(offset, count),
+				this->z.subspan(offset, count),
+				this->w.subspan(offset, count)
+			};
+		}
+
+		constexpr size_t size() const {
+			return this->x.size();
+		}
+
+		constexpr operator QuatLanes<Type const>() const {
+			return QuatLanes<Type const>{this->x, this->y, this->z, this->w};
+		}
+	};
+
+	using QuatSpan = QuatLanes<real_t>;
+
+	using QuatConstSpan = QuatLanes<real_t const>;
+
+	/// Structure-of-arrays storage for a math type made only of `real_t` fields, such as `Vector3`, `Quat`,
+	/// `Color` or `Transform`. Each field is kept in its own lane, and every lane starts on a cache line so
+	/// the SIMD kernels can load whole blocks from it. Elements are read and written in their usual form
+	/// through `get`, `set` and the proxies `operator[]` returns.
+	template<typename Type> class SoA final {
+		static_assert(
+			std::is_trivially_copyable_v<Type> && ((sizeof(Type) % sizeof(real_t)) == 0),
+			"SoA only stores types made of real_t fields"
+		);
+
+		static constexpr size_t alignment = 64;
+
+		static constexpr size_t lane_alignment = (alignment / sizeof(real_t));
+
+		using Fields = std::array<real_t, (sizeof(Type) / sizeof(real_t))>;
+
+		struct Deleter {
+			void operator()(real_t * lanes) const {
+				::operator delete[](lanes, std::align_val_t(alignment));
+			}
+		};
+
+		std::unique_ptr<real_t[], Deleter> storage;
+
+		size_t count;
+
+		size_t stride;
+
+		public:
+		static constexpr size_t lane_count = std::tuple_size_v<Fields>;
+
+		/// Assignable view of one element, which reads and writes its lanes.
+		class Element final {
+			SoA * soa;
+
+			size_t index;
+
+			public:
+			constexpr Element(SoA * soa, size_t const index) : soa(soa), index(index) { }
+
+			operator Type() const {
+				return this->soa->get(this->index);
+			}
+
+			Element& operator=(Type const& value) {
+				this->soa->set(this->index, value);
+
+				return *this;
+			}
+		};
+
+		SoA() : storage(), count(0), stride(0) { }
+
+		SoA(SoA const& that) = delete;
+
+		SoA(SoA&& that) noexcept : storage(std::move(that.storage)), count(that.count), stride(that.stride) {
+			that.count = 0;
+			that.stride = 0;
+		}
+
+		SoA& operator=(SoA&& that) noexcept {
+			if (this != (&that)) {
+				this->storage = std::move(that.storage);
+				this->count = that.count;
+				this->stride = that.stride;
+				that.count = 0;
+				that.stride = 0;
+			}
+
+			return *this;
+		}
+
+		/// Transposes `elements` into lanes in one pass.
+		static SoA of(std::span<Type const> const elements) {
+			SoA soa;
+
+			soa.resize(elements.size());
+
+			for (size_t i = 0; i < elements.size(); i += 1) soa.set(i, elements[i]);
+
+			return soa;
+		}
+
+		/// Reads a pool array of `Type`, such as `PoolVector3Array` for `SoA<Vector3>`, under one read lock.
+		template<typename Pool> static SoA of_pool(Pool const& pool) {
+			return of(pool.read().span());
+		}
+
+		Element operator[](size_t const index) {
+			return Element(this, index);
+		}
+
+		Type operator[](size_t const index) const {
+			return this->get(index);
+		}
+
+		constexpr size_t capacity() const {
+			return this->stride;
+		}
+
+		void clear() {
+			this->count = 0;
+		}
+
+		Type get(size_t const index) const {
+			Fields fields;
+
+			for (size_t field = 0; field < lane_count; field += 1) fields[field] = this->lane(field)[index];
+
+			return std::bit_cast<Type>(fields);
+		}
+
+		/// Field `index` of every element, in declaration order; for `Transform` that is the basis rows
+		/// followed by the origin.
+		std::span<real_t> lane(size_t const index) {
+			return std::span<real_t>((this->storage.get() + (index * this->stride)), this->count);
+		}
+
+		std::span<real_t const> lane(size_t const index) const {
+			return std::span<real_t const>((this->storage.get() + (index * this->stride)), this->count);
+		}
+
+		void push_back(Type const& value) {
+			if (this->count == this->stride) this->reserve(std::max<size_t>((this->stride * 2), lane_alignment));
+
+			this->count += 1;
+			this->set((this->count - 1), value);
+		}
+
+		/// The lanes of a `SoA<Quat>` as the view the quaternion kernels take.
+		QuatSpan quat_lanes() {
+			static_assert(std::is_same_v<Type, core::Quat>, "Only quaternion storage has quaternion lanes");
+
+			return QuatSpan{this->lane(0), this->lane(1), this->lane(2), this->lane(3)};
+		}
+
+		QuatConstSpan quat_lanes() const {
+			static_assert(std::is_same_v<Type, core::Quat>, "Only quaternion storage has quaternion lanes");
+
+			return QuatConstSpan{this->lane(0), this->lane(1), this->lane(2), this->lane(3)};
+		}
+
+		/// Grows every lane to hold at least `capacity` elements, rounded up to a whole number of cache lines.
+		void reserve(size_t const capacity) {
+			if (capacity <= this->stride) return;
+
+			size_t const stride = (((capacity + lane_alignment - 1) / lane_alignment) * lane_alignment);
+
+			std::unique_ptr<real_t[], Deleter> storage = std::unique_ptr<real_t[], Deleter>(static_cast<real_t *>(
+				::operator new[]((lane_count * stride * sizeof(real_t)), std::align_val_t(alignment))
+			));
+
+			for (size_t field = 0; (field < lane_count) && (this->count != 0); field += 1) {
+				std::memcpy(
+					(storage.get() + (field * stride)),
+					this->lane(field).data(),
+					(this->count * sizeof(real_t))
+				);
+			}
+
+			this->storage = std::move(storage);
+			this->stride = stride;
+		}
+
+		/// New elements have every field zeroed.
+		void resize(size_t const size) {
+			this->reserve(size);
+
+			for (size_t field = 0; (field < lane_count) && (size > this->count); field += 1) {
+				real_t * const lane = (this->storage.get() + (field * this->stride));
+
+				std::fill((lane + this->count), (lane + size), real_t(0));
+			}
+
+			this->count = size;
+		}
+
+		/// Copies elements back out to structures in one pass, as many as both sides hold.
+		void scatter(std::span<Type> const to) const {
+			size_t const count = std::min(to.size(), this->count);
+
+			for (size_t i = 0; i < count; i += 1) to[i] = this->get(i);
+		}
+
+		void set(size_t const index, Type const& value) {
+			Fields const fields = std::bit_cast<Fields>(value);
+
+			for (size_t field = 0; field < lane_count; field += 1) this->lane(field)[index] = fields[field];
+		}
+
+		constexpr size_t size() const {
+			return this->count;
+		}
+
+		/// Resizes `pool` to match and fills it under one write lock.
+		template<typename Pool> void to_pool(Pool& pool) const {
+			pool.resize(static_cast<int>(this->count));
+			this->scatter(pool.write().span());
+		}
+	};
+
+	/// Color at `offset` along a gradient running from 0 to 1.
+	struct GradientStop {
+		real_t offset;
+
+		core::Color color;
+
+		static constexpr GradientStop of(real_t const offset, core::Color const& color) {
+			return GradientStop{offset, color};
+		}
+	};
+
+	/// Fixed-size color lookup table for `map_colors`. Tables sampled from constant gradient stops can be
+	/// built at compile time, so heatmap and overlay palettes cost nothing at startup.
+	template<size_t Size> struct ColorTable {
+		static_assert(Size >= 2, "Color tables need at least two entries");
+
+		core::Color colors[Size];
+
+		/// Samples `stops`, sorted by offset, at `Size` evenly spaced points. Points before the first stop or
+		/// after the last one take that stop's color.
+		static constexpr ColorTable of_gradient(std::span<GradientStop const> const stops) {
+			ColorTable table = {};
+
+			if (stops.empty()) return table;
+
+			size_t stop = 0;
+
+			for (size_t i = 0; i < Size; i += 1) {
+				real_t const offset = (static_cast<real_t>(i) / (Size - 1));
+
+				while (((stop + 1) < stops.size()) && (stops[(stop + 1)].offset <= offset)) stop += 1;
+
+				GradientStop const& from = stops[stop];
+
+				if ((offset <= from.offset) || ((stop + 1) == stops.size())) {
+					table.colors[i] = from.color;
+				} else {
+					GradientStop const& to = stops[(stop + 1)];
+					real_t const t = ((offset - from.offset) / (to.offset - from.offset));
+
+					table.colors[i] = core::Color{
+						(from.color.r + (t * (to.color.r - from.color.r))),
+						(from.color.g + (t * (to.color.g - from.color.g))),
+						(from.color.b + (t * (to.color.b - from.color.b))),
+						(from.color.a + (t * (to.color.a - from.color.a)))
+					};
+				}
+			}
+
+			return table;
+		}
+
+		constexpr size_t size() const {
+			return Size;
+		}
+
+		constexpr std::span<core::Color const> span() const {
+			return std::span<core::Color const>{this->colors};
+		}
+	};
+
+	/// Inverts every transform in `from` into `to` the same way as `Transform::affine_inverse`. Four
+	/// transforms are inverted per step in SIMD lanes. Singular bases produce a zero basis. Stops at the
+	/// shorter of the two spans.
+	void affine_inverse(std::span<core::Transform const> from, std::span<core::Transform> to);
+
+	/// Composites `over` onto `under` per element, with the same results as `Color::blend`.
+	void blend(
+		std::span<core::Color const> under,
+		std::span<core::Color const> over,
+		std::span<core::Color> out
+	);
+
+	/// Same results as `Color::contrasted` applied per element.
+	void contrasted(std::span<core::Color const> from, std::span<core::Color> to);
+
+	core::PoolColorArray contrasted(core::PoolColorArray const& from);
+
+	/// Cubic interpolation between `a` and `b` using the same construction as `Quat::cubic_slerp`. Its
+	/// inner `slerpni` steps are ill-conditioned as their inputs approach opposite rotations, for the engine
+	/// too, so results there can differ from the engine's by about 3e-4 per component.
+	void cubic_slerp(
+		QuatConstSpan a,
+		QuatConstSpan b,
+		QuatConstSpan pre_a,
+		QuatConstSpan post_b,
+		real_t t,
+		QuatSpan out
+	);
+
+	/// Same results as `Color::darkened` applied per element.
+	void darkened(std::span<core::Color const> from, real_t amount, std::span<core::Color> to);
+
+	core::PoolColorArray darkened(core::PoolColorArray const& from, real_t amount);
+
+	/// Builds colors from separate hue, saturation and value spans with the same results as
+	/// `Color::from_hsv`. Hues in [0, 2) are converted four at a time; others are wrapped per element.
+	void from_hsv(
+		std::span<real_t const> h,
+		std::span<real_t const> s,
+		std::span<real_t const> v,
+		real_t alpha,
+		std::span<core::Color> out
+	);
+
+	core::PoolColorArray from_hsv(
+		core::PoolRealArray const& h,
+		core::PoolRealArray const& s,
+		core::PoolRealArray const& v,
+		real_t alpha
+	);
+
+	/// Copies array-of-structures quaternions into `to`.
+	void gather(std::span<core::Quat const> from, QuatSpan to);
+
+	/// Same results as `Color::inverted` applied per element.
+	void inverted(std::span<core::Color const> from, std::span<core::Color> to);
+
+	core::PoolColorArray inverted(core::PoolColorArray const& from);
+
+	/// Same results as `Color::lightened` applied per element.
+	void lightened(std::span<core::Color const> from, real_t amount, std::span<core::Color> to);
+
+	core::PoolColorArray lightened(core::PoolColorArray const& from, real_t amount);
+
+	/// Same results as `Color::linear_interpolate` applied per element.
+	void linear_interpolate(
+		std::span<core::Color const> a,
+		std::span<core::Color const> b,
+		real_t t,
+		std::span<core::Color> out
+	);
+
+	/// Maps each value from [`minimum`, `maximum`] onto the nearest entry of `table`, such as the span of a
+	/// `ColorTable`. Values outside the range, and NaN, clamp to the end entries. `maximum` must be greater
+	/// than `minimum`.
+	void map_colors(
+		std::span<real_t const> values,
+		real_t minimum,
+		real_t maximum,
+		std::span<core::Color const> table,
+		std::span<core::Color> out
+	);
+
+	core::PoolColorArray map_colors(
+		core::PoolRealArray const& values,
+		real_t minimum,
+		real_t maximum,
+		std::span<core::Color const> table
+	);
+
+	/// Looks every index up in `palette`. Indices past the end of the palette produce transparent black.
+	void map_colors(
+		std::span<uint8_t const> indices,
+		std::span<core::Color const> palette,
+		std::span<core::Color> out
+	);
+
+	core::PoolColorArray map_colors(core::PoolByteArray const& indices, std::span<core::Color const> palette);
+
+	/// `out[i] = a[i] * b[i]`, treating each transform as a 3x4 matrix with SIMD rows, up to the shortest
+	/// of the three spans.
+	void multiply(
+		std::span<core::Transform const> a,
+		std::span<core::Transform const> b,
+		std::span<core::Transform> out
+	);
+
+	/// Shortest-path linear interpolation followed by renormalization. Cheap, but the angular velocity is
+	/// not constant across `t`.
+	void nlerp(QuatConstSpan a, QuatConstSpan b, real_t t, QuatSpan out);
+
+	/// Fast slerp approximation: `t` is first remapped by a polynomial in `t` and the cosine between the
+	/// inputs, then the result is nlerp'ed. Measured against `slerp` over random unit inputs and `t` in
+	/// [0, 1], the worst-case angular error is about 8e-4 radians (0.05 degrees) and the mean about 1e-4
+	/// radians, compared with 0.14 radians worst case for plain `nlerp`.
+	void nlerp_corrected(QuatConstSpan a, QuatConstSpan b, real_t t, QuatSpan out);
+
+	/// Quantizes colors to four bytes each in `order`. Channels are clamped to [0, 1] and rounded to the
+	/// nearest step, so values `Color::to_rgba32` would wrap saturate instead. Stops at the last color
+	/// that fits whole in `to`.
+	void pack_rgba8(std::span<core::Color const> from, ChannelOrder order, std::span<uint8_t> to);
+
+	core::PoolByteArray pack_rgba8(core::PoolColorArray const& from, ChannelOrder order);
+
+	/// Like `pack_rgba8`, but encodes linear color channels to sRGB through a 4096-entry table, which is
+	/// within one step of the exact curve. Alpha stays linear.
+	void pack_srgb8(std::span<core::Color const> from, ChannelOrder order, std::span<uint8_t> to);
+
+	/// Flattens a hierarchy stored in topological order: `globals[i] = globals[parents[i]] * locals[i]`,
+	/// where every parent index is less than its child's. Negative or out-of-order parents mark roots,
+	/// whose global transform is their local one. Stops at the shortest of the three spans.
+	void propagate_hierarchy(
+		std::span<godot_int const> parents,
+		std::span<core::Transform const> locals,
+		std::span<core::Transform> globals
+	);
+
+	/// Copies structure-of-arrays quaternions back into `to`.
+	void scatter(QuatConstSpan from, std::span<core::Quat> to);
+
+	/// Linear blend skinning of positions. Each vertex reads four bone indices and four weights, laid
+	/// out like the engine's `ARRAY_BONES` and `ARRAY_WEIGHTS` mesh arrays, so both can come straight
+	/// from `PoolIntArray`/`PoolRealArray` read spans. Indices outside `bones` contribute nothing. Only
+	/// vertices with a full set of four indices and four weights are skinned.
+	void skin(
+		std::span<core::Transform const> bones,
+		std::span<core::Vector3 const> vertices,
+		std::span<godot_int const> bone_indices,
+		std::span<real_t const> bone_weights,
+		std::span<core::Vector3> out
+	);
+
+	/// Skins normals by the blended bone bases and renormalizes them. Assumes bones carry no
+	/// non-uniform scale.
+	void skin_normals(
+		std::span<core::Transform const> bones,
+		std::span<core::Vector3 const> normals,
+		std::span<godot_int const> bone_indices,
+		std::span<real_t const> bone_weights,
+		std::span<core::Vector3> out
+	);
+
+	/// Spherical interpolation within 4e-7 per component of `Quat::slerp` applied per element. The angle and
+	/// weights come from the `simd::acos` and `simd::sin` polynomials, four lanes at a time.
+	void slerp(QuatConstSpan a, QuatConstSpan b, real_t t, QuatSpan out);
+
+	/// sRGB to linear conversion of the color channels through an interpolated table, within 5e-7 of the
+	/// exact curve on [0, 1]. Channels outside that range use the exact curve. Alpha is left unchanged.
+	void to_linear(std::span<core::Color const> from, std::span<core::Color> to);
+
+	/// Linear to sRGB conversion of the color channels through a table indexed by the square root of the
+	/// channel, within 5e-6 of the exact curve on [0, 1]. Channels outside that range use the exact
+	/// curve. Alpha is left unchanged.
+	void to_srgb(std::span<core::Color const> from, std::span<core::Color> to);
+
+	/// Expands four bytes per color in `order` back to colors, with the same results as
+	/// `Color::from_rgba` on the equivalent packed integer. A trailing partial color in `from` is ignored.
+	void unpack_rgba8(std::span<uint8_t const> from, ChannelOrder order, std::span<core::Color> to);
+
+	core::PoolColorArray unpack_rgba8(core::PoolByteArray const& from, ChannelOrder order);
+
+	/// Like `unpack_rgba8`, but decodes sRGB-encoded color channels to linear through an exact 256-entry
+	/// table. Alpha stays linear.
+	void unpack_srgb8(std::span<uint8_t const> from, ChannelOrder order, std::span<core::Color> to);
+
+	/// Transforms every point in `points` by `transform`, up to the shorter of `points` and `out`.
+	void xform(
+		core::Transform const& transform,
+		std::span<core::Vector3 const> points,
+		std::span<core::Vector3> out
+	);
+}
+
+#endif
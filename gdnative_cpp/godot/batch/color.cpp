@@ -0,0 +1,564 @@
+#include "godot/batch.hpp"
+#include "godot/profile.hpp"
+#include "godot/simd.hpp"
+
+#include <algorithm>
+
+namespace godot::batch {
+	using core::Color;
+	using simd::Float4;
+
+	static_assert(sizeof(Color) == (sizeof(real_t) * 4), "Color must be four packed reals");
+
+	// Channel index (r, g, b, a) stored at each byte position for every order.
+	static constexpr uint8_t channel_of_byte[4][4] = {
+		{0, 1, 2, 3},
+		{3, 0, 1, 2},
+		{3, 2, 1, 0},
+		{2, 1, 0, 3}
+	};
+
+	struct SrgbTables {
+		static constexpr size_t curve_steps = 1024;
+
+		static constexpr size_t encode_steps = 4096;
+
+		real_t decode_byte[256];
+
+		real_t to_linear[(curve_steps + 1)];
+
+		real_t to_srgb[(curve_steps + 1)];
+
+		uint8_t encode_byte[encode_steps];
+	};
+
+	static real_t exact_to_linear(real_t const channel) {
+		return ((channel < 0.04045f) ?
+			(channel * (1.f / 12.92f)) :
+			std::pow(((channel + 0.055f) * (1.f / (1.f + 0.055f))), 2.4f));
+	}
+
+	static real_t exact_to_srgb(real_t const channel) {
+		return ((channel < 0.0031308f) ?
+			(12.92f * channel) :
+			(((1.f + 0.055f) * std::pow(channel, (1.f / 2.4f))) - 0.055f));
+	}
+
+	static SrgbTables const& srgb_tables() {
+		static SrgbTables const tables = []() {
+			SrgbTables built = {};
+
+			for (size_t i = 0; i < 256; i += 1) {
+				built.decode_byte[i] = exact_to_linear(i / 255.f);
+			}
+
+			for (size_t i = 0; i <= SrgbTables::curve_steps; i += 1) {
+				real_t const u = (static_cast<real_t>(i) / SrgbTables::curve_steps);
+
+				built.to_linear[i] = exact_to_linear(u);
+				built.to_srgb[i] = exact_to_srgb(u * u);
+			}
+
+			for (size_t i = 0; i < SrgbTables::encode_steps; i += 1) {
+				real_t const encoded = exact_to_srgb(static_cast<real_t>(i) / (SrgbTables::encode_steps - 1));
+
+				built.encode_byte[i] = static_cast<uint8_t>(std::clamp(((encoded * 255.f) + 0.5f), 0.f, 255.f));
+			}
+
+			return built;
+		}();
+
+		return tables;
+	}
+
+	// Written so NaN lands on `low`, matching `_mm_max_ps` in the SIMD paths. `std::clamp` passes NaN through,
+	// and converting that to an integer is undefined.
+	static real_t bounded(real_t const value, real_t const low, real_t const high) {
+		return ((value > low) ? ((value < high) ? value : high) : low);
+	}
+
+	static real_t lookup(real_t const* table, real_t const position) {
+		real_t const scaled = (position * SrgbTables::curve_steps);
+		size_t const index = static_cast<size_t>(bounded(scaled, 0, (SrgbTables::curve_steps - 1)));
+		real_t const fraction = (scaled - static_cast<real_t>(index));
+
+		return (table[index] + ((table[(index + 1)] - table[index]) * fraction));
+	}
+
+	static uint8_t quantize(real_t const channel) {
+		return static_cast<uint8_t>(bounded(((channel * 255.f) + 0.5f), 0, 255.f));
+	}
+
+	template<typename Operation> static core::PoolColorArray recolor(
+		core::PoolColorArray const& from,
+		Operation const& operation
+	) {
+		core::PoolColorArray to;
+		core::PoolArrayRead<Color> const colors = from.read();
+
+		to.resize(static_cast<int>(colors.size()));
+		operation(colors.span(), to.write().span());
+
+		return to;
+	}
+
+#ifdef GODOT_SIMD_SSE2
+	// Moves a color's (r, g, b, a) lanes into the byte order of `order`.
+	static __m128 reorder(__m128 const color, ChannelOrder const order) {
+		switch (order) {
+			case ChannelOrder::ARGB: return _mm_shuffle_ps(color, color, _MM_SHUFFLE(2, 1, 0, 3));
+			case ChannelOrder::ABGR: return _mm_shuffle_ps(color, color, _MM_SHUFFLE(0, 1, 2, 3));
+			case ChannelOrder::BGRA: return _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 0, 1, 2));
+			default: return color;
+		}
+	}
+
+	// Inverse of `reorder`.
+	static __m128 restore(__m128 const color, ChannelOrder const order) {
+		switch (order) {
+			case ChannelOrder::ARGB: return _mm_shuffle_ps(color, color, _MM_SHUFFLE(0, 3, 2, 1));
+			case ChannelOrder::ABGR: return _mm_shuffle_ps(color, color, _MM_SHUFFLE(0, 1, 2, 3));
+			case ChannelOrder::BGRA: return _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 0, 1, 2));
+			default: return color;
+		}
+	}
+
+	static __m128 alpha_lane() {
+		return _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+	}
+
+	// Picks `a` in lanes where `mask` is set and `b` elsewhere.
+	static __m128 pick(__m128 const mask, __m128 const a, __m128 const b) {
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	// `fmod(channel + 0.5, 1.0)` in double precision, as the engine computes it, for channels small
+	// enough to truncate through 32-bit integers.
+	static __m128d contrast(__m128d const channels) {
+		__m128d const shifted = _mm_add_pd(channels, _mm_set1_pd(0.5));
+
+		return _mm_sub_pd(shifted, _mm_cvtepi32_pd(_mm_cvttpd_epi32(shifted)));
+	}
+
+	static __m128i quantize(__m128 const color) {
+		__m128 const scaled = _mm_add_ps(_mm_mul_ps(color, _mm_set1_ps(255.f)), _mm_set1_ps(0.5f));
+
+		return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(scaled, _mm_setzero_ps()), _mm_set1_ps(255.f)));
+	}
+#endif
+
+	void blend(std::span<Color const> const under, std::span<Color const> const over, std::span<Color> const out) {
+		GD_PROFILE_SCOPE("batch::blend");
+
+		size_t const count = std::min({under.size(), over.size(), out.size()});
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128 const one = _mm_set1_ps(1.f);
+		__m128 const zero = _mm_setzero_ps();
+
+		for (; i < count; i += 1) {
+			__m128 const bottom = _mm_loadu_ps(&under[i].r);
+			__m128 const top = _mm_loadu_ps(&over[i].r);
+			__m128 const bottom_alpha = _mm_shuffle_ps(bottom, bottom, _MM_SHUFFLE(3, 3, 3, 3));
+			__m128 const top_alpha = _mm_shuffle_ps(top, top, _MM_SHUFFLE(3, 3, 3, 3));
+			__m128 const sa = _mm_sub_ps(one, top_alpha);
+			__m128 const alpha = _mm_add_ps(_mm_mul_ps(bottom_alpha, sa), top_alpha);
+
+			__m128 const channels = _mm_div_ps(_mm_add_ps(
+				_mm_mul_ps(_mm_mul_ps(bottom, bottom_alpha), sa),
+				_mm_mul_ps(top, top_alpha)
+			), alpha);
+
+			__m128 const result = pick(alpha_lane(), alpha, channels);
+
+			// A fully transparent result is transparent black rather than a division by zero.
+			_mm_storeu_ps(&out[i].r, _mm_andnot_ps(_mm_cmpeq_ps(alpha, zero), result));
+		}
+#endif
+
+		for (; i < count; i += 1) out[i] = under[i].blend(over[i]);
+	}
+
+	void contrasted(std::span<Color const> const from, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::contrasted");
+
+		size_t const count = std::min(from.size(), to.size());
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128 const limit = _mm_set1_ps(1073741824.f);
+
+		for (; i < count; i += 1) {
+			__m128 const color = _mm_loadu_ps(&from[i].r);
+
+			if (_mm_movemask_ps(_mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), color), limit)) != 0) {
+				to[i] = from[i].contrasted();
+
+				continue;
+			}
+
+			__m128 const wrapped = _mm_movelh_ps(
+				_mm_cvtpd_ps(contrast(_mm_cvtps_pd(color))),
+				_mm_cvtpd_ps(contrast(_mm_cvtps_pd(_mm_movehl_ps(color, color))))
+			);
+
+			_mm_storeu_ps(&to[i].r, pick(alpha_lane(), color, wrapped));
+		}
+#endif
+
+		for (; i < count; i += 1) to[i] = from[i].contrasted();
+	}
+
+	core::PoolColorArray contrasted(core::PoolColorArray const& from) {
+		return recolor(from, [](std::span<Color const> const colors, std::span<Color> const to) {
+			contrasted(colors, to);
+		});
+	}
+
+	void darkened(std::span<Color const> const from, real_t const amount, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::darkened");
+
+		size_t const count = std::min(from.size(), to.size());
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128 const factor = _mm_set1_ps(1.f - amount);
+
+		for (; i < count; i += 1) {
+			__m128 const color = _mm_loadu_ps(&from[i].r);
+
+			_mm_storeu_ps(&to[i].r, pick(alpha_lane(), color, _mm_mul_ps(color, factor)));
+		}
+#endif
+
+		for (; i < count; i += 1) to[i] = from[i].darkened(amount);
+	}
+
+	core::PoolColorArray darkened(core::PoolColorArray const& from, real_t const amount) {
+		return recolor(from, [amount](std::span<Color const> const colors, std::span<Color> const to) {
+			darkened(colors, amount, to);
+		});
+	}
+
+	void from_hsv(
+		std::span<real_t const> const h,
+		std::span<real_t const> const s,
+		std::span<real_t const> const v,
+		real_t const alpha,
+		std::span<Color> const out
+	) {
+		GD_PROFILE_SCOPE("batch::from_hsv");
+
+		size_t const count = std::min({h.size(), s.size(), v.size(), out.size()});
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128 const zero = _mm_setzero_ps();
+		__m128 const one = _mm_set1_ps(1.f);
+		__m128 const six = _mm_set1_ps(6.f);
+		__m128 const twelve = _mm_set1_ps(12.f);
+
+		for (; (i + 4) <= count; i += 4) {
+			__m128 const hue = _mm_mul_ps(_mm_loadu_ps(&h[i]), six);
+
+			// Anything outside [0, 12) after scaling, NaN included, needs the full `fmod` wrap.
+			if (_mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(hue, zero), _mm_cmplt_ps(hue, twelve))) != 15) {
+				for (size_t k = i; k < (i + 4); k += 1) out[k] = Color::from_hsv(h[k], s[k], v[k], alpha);
+
+				continue;
+			}
+
+			__m128 const wrapped = pick(_mm_cmplt_ps(hue, six), hue, _mm_sub_ps(hue, six));
+			__m128i const sector = _mm_cvttps_epi32(wrapped);
+			__m128 const f = _mm_sub_ps(wrapped, _mm_cvtepi32_ps(sector));
+			__m128 const saturation = _mm_loadu_ps(&s[i]);
+			__m128 const value = _mm_loadu_ps(&v[i]);
+			__m128 const p = _mm_mul_ps(value, _mm_sub_ps(one, saturation));
+			__m128 const q = _mm_mul_ps(value, _mm_sub_ps(one, _mm_mul_ps(saturation, f)));
+			__m128 const t = _mm_mul_ps(value, _mm_sub_ps(one, _mm_mul_ps(saturation, _mm_sub_ps(one, f))));
+			__m128 sectors[6];
+
+			for (int k = 0; k < 6; k += 1) {
+				sectors[k] = _mm_castsi128_ps(_mm_cmpeq_epi32(sector, _mm_set1_epi32(k)));
+			}
+
+			__m128 r = pick(_mm_or_ps(sectors[0], sectors[5]), value, pick(sectors[1], q, pick(sectors[4], t, p)));
+			__m128 g = pick(_mm_or_ps(sectors[1], sectors[2]), value, pick(sectors[0], t, pick(sectors[3], q, p)));
+			__m128 b = pick(_mm_or_ps(sectors[3], sectors[4]), value, pick(sectors[2], t, pick(sectors[5], q, p)));
+			__m128 a = _mm_set1_ps(alpha);
+
+			_MM_TRANSPOSE4_PS(r, g, b, a);
+			_mm_storeu_ps(&out[i].r, r);
+			_mm_storeu_ps(&out[(i + 1)].r, g);
+			_mm_storeu_ps(&out[(i + 2)].r, b);
+			_mm_storeu_ps(&out[(i + 3)].r, a);
+		}
+#endif
+
+		for (; i < count; i += 1) out[i] = Color::from_hsv(h[i], s[i], v[i], alpha);
+	}
+
+	core::PoolColorArray from_hsv(
+		core::PoolRealArray const& h,
+		core::PoolRealArray const& s,
+		core::PoolRealArray const& v,
+		real_t const alpha
+	) {
+		core::PoolColorArray out;
+		core::PoolArrayRead<real_t> const hues = h.read();
+		core::PoolArrayRead<real_t> const saturations = s.read();
+		core::PoolArrayRead<real_t> const values = v.read();
+		size_t const count = std::min({hues.size(), saturations.size(), values.size()});
+		out.resize(static_cast<int>(count));
+
+		from_hsv(
+			hues.span().first(count),
+			saturations.span().first(count),
+			values.span().first(count),
+			alpha,
+			out.write().span()
+		);
+
+		return out;
+	}
+
+	void inverted(std::span<Color const> const from, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::inverted");
+
+		size_t const count = std::min(from.size(), to.size());
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128 const one = _mm_set1_ps(1.f);
+
+		for (; i < count; i += 1) {
+			__m128 const color = _mm_loadu_ps(&from[i].r);
+
+			_mm_storeu_ps(&to[i].r, pick(alpha_lane(), color, _mm_sub_ps(one, color)));
+		}
+#endif
+
+		for (; i < count; i += 1) to[i] = from[i].inverted();
+	}
+
+	core::PoolColorArray inverted(core::PoolColorArray const& from) {
+		return recolor(from, [](std::span<Color const> const colors, std::span<Color> const to) {
+			inverted(colors, to);
+		});
+	}
+
+	void lightened(std::span<Color const> const from, real_t const amount, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::lightened");
+
+		size_t const count = std::min(from.size(), to.size());
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128 const one = _mm_set1_ps(1.f);
+		__m128 const weight = _mm_set1_ps(amount);
+
+		for (; i < count; i += 1) {
+			__m128 const color = _mm_loadu_ps(&from[i].r);
+			__m128 const result = _mm_add_ps(color, _mm_mul_ps(_mm_sub_ps(one, color), weight));
+
+			_mm_storeu_ps(&to[i].r, pick(alpha_lane(), color, result));
+		}
+#endif
+
+		for (; i < count; i += 1) to[i] = from[i].lightened(amount);
+	}
+
+	core::PoolColorArray lightened(core::PoolColorArray const& from, real_t const amount) {
+		return recolor(from, [amount](std::span<Color const> const colors, std::span<Color> const to) {
+			lightened(colors, amount, to);
+		});
+	}
+
+	void linear_interpolate(
+		std::span<Color const> const a,
+		std::span<Color const> const b,
+		real_t const t,
+		std::span<Color> const out
+	) {
+		GD_PROFILE_SCOPE("batch::linear_interpolate");
+
+		size_t const count = std::min({a.size(), b.size(), out.size()});
+		Float4 const weight = simd::splat(t);
+
+		for (size_t i = 0; i < count; i += 1) {
+			Float4 const from = simd::load(&a[i].r);
+
+			simd::store(&out[i].r, (from + (weight * (simd::load(&b[i].r) - from))));
+		}
+	}
+
+	void pack_rgba8(std::span<Color const> const from, ChannelOrder const order, std::span<uint8_t> const to) {
+		GD_PROFILE_SCOPE("batch::pack_rgba8");
+
+		size_t const count = std::min(from.size(), (to.size() / 4));
+		uint8_t const* channels = channel_of_byte[static_cast<size_t>(order)];
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		for (; (i + 4) <= count; i += 4) {
+			__m128i const q0 = quantize(reorder(_mm_loadu_ps(&from[i].r), order));
+			__m128i const q1 = quantize(reorder(_mm_loadu_ps(&from[(i + 1)].r), order));
+			__m128i const q2 = quantize(reorder(_mm_loadu_ps(&from[(i + 2)].r), order));
+			__m128i const q3 = quantize(reorder(_mm_loadu_ps(&from[(i + 3)].r), order));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(&to[(i * 4)]), _mm_packus_epi16(
+				_mm_packs_epi32(q0, q1),
+				_mm_packs_epi32(q2, q3)
+			));
+		}
+#endif
+
+		for (; i < count; i += 1) {
+			real_t const* color = (&from[i].r);
+
+			for (size_t k = 0; k < 4; k += 1) to[((i * 4) + k)] = quantize(color[channels[k]]);
+		}
+	}
+
+	core::PoolByteArray pack_rgba8(core::PoolColorArray const& from, ChannelOrder const order) {
+		core::PoolByteArray to;
+		core::PoolArrayRead<Color> const colors = from.read();
+
+		to.resize(static_cast<int>(colors.size() * 4));
+		pack_rgba8(colors.span(), order, to.write().span());
+
+		return to;
+	}
+
+	void pack_srgb8(std::span<Color const> const from, ChannelOrder const order, std::span<uint8_t> const to) {
+		GD_PROFILE_SCOPE("batch::pack_srgb8");
+
+		size_t const count = std::min(from.size(), (to.size() / 4));
+		SrgbTables const& tables = srgb_tables();
+		uint8_t const* channels = channel_of_byte[static_cast<size_t>(order)];
+
+		for (size_t i = 0; i < count; i += 1) {
+			real_t const* color = (&from[i].r);
+			uint8_t encoded[4];
+
+			for (size_t c = 0; c < 3; c += 1) {
+				real_t const position = (bounded(color[c], 0, 1.f) * (SrgbTables::encode_steps - 1));
+
+				encoded[c] = tables.encode_byte[static_cast<size_t>(position + 0.5f)];
+			}
+
+			encoded[3] = quantize(color[3]);
+
+			for (size_t k = 0; k < 4; k += 1) to[((i * 4) + k)] = encoded[channels[k]];
+		}
+	}
+
+	void to_linear(std::span<Color const> const from, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::to_linear");
+
+		size_t const count = std::min(from.size(), to.size());
+		SrgbTables const& tables = srgb_tables();
+
+		for (size_t i = 0; i < count; i += 1) {
+			real_t const* color = (&from[i].r);
+			real_t converted[3];
+
+			for (size_t c = 0; c < 3; c += 1) {
+				real_t const channel = color[c];
+
+				converted[c] = (((channel >= 0) && (channel <= 1.f)) ?
+					lookup(tables.to_linear, channel) :
+					exact_to_linear(channel));
+			}
+
+			to[i] = Color{converted[0], converted[1], converted[2], color[3]};
+		}
+	}
+
+	void to_srgb(std::span<Color const> const from, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::to_srgb");
+
+		size_t const count = std::min(from.size(), to.size());
+		SrgbTables const& tables = srgb_tables();
+
+		for (size_t i = 0; i < count; i += 1) {
+			real_t const* color = (&from[i].r);
+			real_t converted[3];
+
+			for (size_t c = 0; c < 3; c += 1) {
+				real_t const channel = color[c];
+
+				converted[c] = (((channel >= 0) && (channel <= 1.f)) ?
+					lookup(tables.to_srgb, std::sqrt(channel)) :
+					exact_to_srgb(channel));
+			}
+
+			to[i] = Color{converted[0], converted[1], converted[2], color[3]};
+		}
+	}
+
+	void unpack_rgba8(std::span<uint8_t const> const from, ChannelOrder const order, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::unpack_rgba8");
+
+		size_t const count = std::min((from.size() / 4), to.size());
+		uint8_t const* channels = channel_of_byte[static_cast<size_t>(order)];
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128i const zero = _mm_setzero_si128();
+		__m128 const scale = _mm_set1_ps(255.f);
+
+		for (; (i + 4) <= count; i += 4) {
+			__m128i const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&from[(i * 4)]));
+			__m128i const low = _mm_unpacklo_epi8(bytes, zero);
+			__m128i const high = _mm_unpackhi_epi8(bytes, zero);
+			__m128i const words[4] = {
+				_mm_unpacklo_epi16(low, zero),
+				_mm_unpackhi_epi16(low, zero),
+				_mm_unpacklo_epi16(high, zero),
+				_mm_unpackhi_epi16(high, zero)
+			};
+
+			for (size_t k = 0; k < 4; k += 1) {
+				_mm_storeu_ps(&to[(i + k)].r, restore(_mm_div_ps(_mm_cvtepi32_ps(words[k]), scale), order));
+			}
+		}
+#endif
+
+		for (; i < count; i += 1) {
+			real_t * color = (&to[i].r);
+
+			for (size_t k = 0; k < 4; k += 1) color[channels[k]] = (from[((i * 4) + k)] / 255.f);
+		}
+	}
+
+	core::PoolColorArray unpack_rgba8(core::PoolByteArray const& from, ChannelOrder const order) {
+		core::PoolColorArray to;
+		core::PoolArrayRead<uint8_t> const bytes = from.read();
+
+		to.resize(static_cast<int>(bytes.size() / 4));
+		unpack_rgba8(bytes.span(), order, to.write().span());
+
+		return to;
+	}
+
+	void unpack_srgb8(std::span<uint8_t const> const from, ChannelOrder const order, std::span<Color> const to) {
+		GD_PROFILE_SCOPE("batch::unpack_srgb8");
+
+		size_t const count = std::min((from.size() / 4), to.size());
+		SrgbTables const& tables = srgb_tables();
+		uint8_t const* channels = channel_of_byte[static_cast<size_t>(order)];
+
+		for (size_t i = 0; i < count; i += 1) {
+			real_t * color = (&to[i].r);
+
+			for (size_t k = 0; k < 4; k += 1) {
+				uint8_t const byte = from[((i * 4) + k)];
+				uint8_t const channel = channels[k];
+
+				color[channel] = ((channel == 3) ? (byte / 255.f) : tables.decode_byte[byte]);
+			}
+		}
+	}
+}
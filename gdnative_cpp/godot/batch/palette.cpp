@@ -0,0 +1,98 @@
+#include "godot/batch.hpp"
+#include "godot/profile.hpp"
+#include "godot/simd.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace godot::batch {
+	using core::Color;
+
+	// Written so NaN lands on the first entry, matching `_mm_max_ps` in the SIMD path.
+	static size_t entry_of(real_t const position, real_t const last) {
+		real_t const clamped = ((position > 0) ? position : 0);
+
+		return static_cast<size_t>((((clamped < last) ? clamped : last) + 0.5f));
+	}
+
+	void map_colors(
+		std::span<real_t const> const values,
+		real_t const minimum,
+		real_t const maximum,
+		std::span<Color const> const table,
+		std::span<Color> const out
+	) {
+		GD_PROFILE_SCOPE("batch::map_colors");
+
+		if (table.empty()) return;
+
+		real_t const last = static_cast<real_t>(table.size() - 1);
+		real_t const scale = (last / (maximum - minimum));
+		size_t const count = std::min(values.size(), out.size());
+		size_t i = 0;
+
+#ifdef GODOT_SIMD_SSE2
+		__m128 const offset = _mm_set1_ps(minimum);
+		__m128 const factor = _mm_set1_ps(scale);
+		__m128 const upper = _mm_set1_ps(last);
+		__m128 const half = _mm_set1_ps(0.5f);
+
+		for (; (i + 4) <= count; i += 4) {
+			__m128 const position = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&values[i]), offset), factor);
+			__m128 const clamped = _mm_min_ps(_mm_max_ps(position, _mm_setzero_ps()), upper);
+			alignas(16) int32_t entries[4];
+
+			_mm_store_si128(reinterpret_cast<__m128i *>(entries), _mm_cvttps_epi32(_mm_add_ps(clamped, half)));
+
+			out[i] = table[entries[0]];
+			out[(i + 1)] = table[entries[1]];
+			out[(i + 2)] = table[entries[2]];
+			out[(i + 3)] = table[entries[3]];
+		}
+#endif
+
+		for (; i < count; i += 1) out[i] = table[entry_of(((values[i] - minimum) * scale), last)];
+	}
+
+	core::PoolColorArray map_colors(
+		core::PoolRealArray const& values,
+		real_t const minimum,
+		real_t const maximum,
+		std::span<Color const> const table
+	) {
+		core::PoolColorArray out;
+		core::PoolArrayRead<real_t> const scalars = values.read();
+
+		out.resize(static_cast<int>(scalars.size()));
+		map_colors(scalars.span(), minimum, maximum, table, out.write().span());
+
+		return out;
+	}
+
+	void map_colors(
+		std::span<uint8_t const> const indices,
+		std::span<Color const> const palette,
+		std::span<Color> const out
+	) {
+		GD_PROFILE_SCOPE("batch::map_colors");
+
+		// Padding the palette to all 256 byte values keeps the bounds check out of the loop.
+		Color padded[256] = {};
+
+		std::copy_n(palette.begin(), std::min(palette.size(), std::size(padded)), padded);
+
+		size_t const count = std::min(indices.size(), out.size());
+
+		for (size_t i = 0; i < count; i += 1) out[i] = padded[indices[i]];
+	}
+
+	core::PoolColorArray map_colors(core::PoolByteArray const& indices, std::span<Color const> const palette) {
+		core::PoolColorArray out;
+		core::PoolArrayRead<uint8_t> const bytes = indices.read();
+
+		out.resize(static_cast<int>(bytes.size()));
+		map_colors(bytes.span(), palette, out.write().span());
+
+		return out;
+	}
+}
@@ -0,0 +1,257 @@
+#include "godot/batch.hpp"
+#include "godot/profile.hpp"
+#include "godot/simd.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+
+namespace godot::batch {
+	using simd::Float4;
+
+	struct Quat4 {
+		Float4 x, y, z, w;
+	};
+
+	// Elements every lane of every view holds. Kernels stop there rather than trusting the views to match.
+	static size_t shortest(std::initializer_list<QuatConstSpan> const views) {
+		size_t count = SIZE_MAX;
+
+		for (QuatConstSpan const& view : views) {
+			count = std::min({count, view.x.size(), view.y.size(), view.z.size(), view.w.size()});
+		}
+
+		return count;
+	}
+
+	static Quat4 load(QuatConstSpan const& from, size_t const index, size_t const count) {
+		size_t const remaining = (count - index);
+
+		if (remaining >= 4) {
+			return Quat4{
+				simd::load(&from.x[index]),
+				simd::load(&from.y[index]),
+				simd::load(&from.z[index]),
+				simd::load(&from.w[index])
+			};
+		}
+
+		// Pad the tail with identity rotations so it can take the same path as full blocks.
+		real_t x[4] = {0, 0, 0, 0}, y[4] = {0, 0, 0, 0}, z[4] = {0, 0, 0, 0}, w[4] = {1, 1, 1, 1};
+
+		for (size_t i = 0; i < remaining; i += 1) {
+			x[i] = from.x[(index + i)];
+			y[i] = from.y[(index + i)];
+			z[i] = from.z[(index + i)];
+			w[i] = from.w[(index + i)];
+		}
+
+		return Quat4{simd::load(x), simd::load(y), simd::load(z), simd::load(w)};
+	}
+
+	static void store(QuatSpan const& to, size_t const index, size_t const count, Quat4 const& value) {
+		size_t const remaining = (count - index);
+
+		if (remaining >= 4) {
+			simd::store(&to.x[index], value.x);
+			simd::store(&to.y[index], value.y);
+			simd::store(&to.z[index], value.z);
+			simd::store(&to.w[index], value.w);
+
+			return;
+		}
+
+		real_t x[4], y[4], z[4], w[4];
+
+		simd::store(x, value.x);
+		simd::store(y, value.y);
+		simd::store(z, value.z);
+		simd::store(w, value.w);
+
+		for (size_t i = 0; i < remaining; i += 1) {
+			to.x[(index + i)] = x[i];
+			to.y[(index + i)] = y[i];
+			to.z[(index + i)] = z[i];
+			to.w[(index + i)] = w[i];
+		}
+	}
+
+	static Float4 dot(Quat4 const& a, Quat4 const& b) {
+		return ((a.x * b.x) + (a.y * b.y) + (a.z * b.z) + (a.w * b.w));
+	}
+
+	static Quat4 combine(Float4 const scale_a, Quat4 const& a, Float4 const scale_b, Quat4 const& b) {
+		return Quat4{
+			((scale_a * a.x) + (scale_b * b.x)),
+			((scale_a * a.y) + (scale_b * b.y)),
+			((scale_a * a.z) + (scale_b * b.z)),
+			((scale_a * a.w) + (scale_b * b.w))
+		};
+	}
+
+	static Quat4 normalize(Quat4 const& q) {
+		Float4 const inverse_length = simd::rsqrt(dot(q, q));
+
+		return Quat4{(q.x * inverse_length), (q.y * inverse_length), (q.z * inverse_length), (q.w * inverse_length)};
+	}
+
+	static Quat4 flip_to_shortest(Quat4 const& b, Float4 const cosine) {
+		return Quat4{
+			simd::xor_sign(b.x, cosine),
+			simd::xor_sign(b.y, cosine),
+			simd::xor_sign(b.z, cosine),
+			simd::xor_sign(b.w, cosine)
+		};
+	}
+
+	static Quat4 nlerp(Quat4 const& a, Quat4 const& b, Float4 const t) {
+		Quat4 const to = flip_to_shortest(b, dot(a, b));
+
+		return normalize(Quat4{
+			simd::multiply_add((to.x - a.x), t, a.x),
+			simd::multiply_add((to.y - a.y), t, a.y),
+			simd::multiply_add((to.z - a.z), t, a.z),
+			simd::multiply_add((to.w - a.w), t, a.w)
+		});
+	}
+
+	static Quat4 nlerp_corrected(Quat4 const& a, Quat4 const& b, Float4 const t) {
+		Float4 const d = simd::abs(dot(a, b));
+		Float4 const half = simd::splat(0.5f);
+		Float4 const t_centered = (t - half);
+
+		Float4 const k_a = simd::multiply_add(d, simd::multiply_add(d, simd::multiply_add(d,
+			simd::splat(-1.43519f),
+			simd::splat(3.55645f)
+		), simd::splat(-3.2452f)), simd::splat(1.0904f));
+
+		Float4 const k_b = simd::multiply_add(d, simd::multiply_add(d,
+			simd::splat(0.215638f),
+			simd::splat(-1.06021f)
+		), simd::splat(0.848013f));
+
+		Float4 const k = simd::multiply_add((k_a * t_centered), t_centered, k_b);
+		Float4 const corrected_t = simd::multiply_add((t * t_centered * (t - simd::splat(1.f))), k, t);
+
+		return nlerp(a, b, corrected_t);
+	}
+
+	// Factoring 1 - c² keeps the sine accurate near parallel inputs, where (1 - c) is exact.
+	static Float4 sine_from_cosine(Float4 const cosine) {
+		Float4 const one = simd::splat(1.f);
+
+		return simd::sqrt(simd::max(simd::splat(0), ((one - cosine) * (one + cosine))));
+	}
+
+	static Quat4 slerp(Quat4 const& a, Quat4 const& b, Float4 const t) {
+		Float4 const signed_cosine = dot(a, b);
+		Float4 const negative = simd::less(signed_cosine, simd::splat(0));
+		Quat4 const to = flip_to_shortest(b, simd::select(negative, simd::splat(-1.f), simd::splat(1.f)));
+		Float4 const one = simd::splat(1.f);
+		Float4 const cosine = simd::abs(signed_cosine);
+		Float4 const sinom = sine_from_cosine(cosine);
+		Float4 const omega = simd::acos(cosine);
+		Float4 const spherical = simd::less(simd::splat(core::CMP_EPSILON), (one - cosine));
+
+		// Lanes too close to parallel for the division fall back to linear weights, as `Quat::slerp` does.
+		return combine(
+			simd::select(spherical, (simd::sin((one - t) * omega) / sinom), (one - t)),
+			a,
+			simd::select(spherical, (simd::sin(t * omega) / sinom), t),
+			to
+		);
+	}
+
+	static Quat4 slerpni(Quat4 const& a, Quat4 const& b, Float4 const t) {
+		Float4 const one = simd::splat(1.f);
+		Float4 const cosine = dot(a, b);
+		Float4 const sine = sine_from_cosine(cosine);
+		Float4 const theta = simd::acos(cosine);
+		Float4 const sin_t = (one / sine);
+		Float4 const parallel = simd::less(simd::splat(0.9999f), simd::abs(cosine));
+
+		return combine(
+			simd::select(parallel, one, (simd::sin((one - t) * theta) * sin_t)),
+			a,
+			simd::select(parallel, simd::splat(0), (simd::sin(t * theta) * sin_t)),
+			b
+		);
+	}
+
+	void cubic_slerp(
+		QuatConstSpan const a,
+		QuatConstSpan const b,
+		QuatConstSpan const pre_a,
+		QuatConstSpan const post_b,
+		real_t const t,
+		QuatSpan const out
+	) {
+		GD_PROFILE_SCOPE("batch::cubic_slerp");
+
+		Float4 const weight = simd::splat(t);
+		Float4 const inner_weight = simd::splat((1.f - t) * t * 2.f);
+		size_t const count = shortest({a, b, pre_a, post_b, out});
+
+		for (size_t i = 0; i < count; i += 4) {
+			Quat4 const sp = slerp(load(a, i, count), load(b, i, count), weight);
+			Quat4 const sq = slerpni(load(pre_a, i, count), load(post_b, i, count), weight);
+
+			store(out, i, count, slerpni(sp, sq, inner_weight));
+		}
+	}
+
+	void gather(std::span<core::Quat const> const from, QuatSpan const to) {
+		GD_PROFILE_SCOPE("batch::gather");
+
+		size_t const count = std::min(from.size(), shortest({to}));
+
+		for (size_t i = 0; i < count; i += 1) {
+			to.x[i] = from[i].x;
+			to.y[i] = from[i].y;
+			to.z[i] = from[i].z;
+			to.w[i] = from[i].w;
+		}
+	}
+
+	void nlerp(QuatConstSpan const a, QuatConstSpan const b, real_t const t, QuatSpan const out) {
+		GD_PROFILE_SCOPE("batch::nlerp");
+
+		Float4 const weight = simd::splat(t);
+		size_t const count = shortest({a, b, out});
+
+		for (size_t i = 0; i < count; i += 4) {
+			store(out, i, count, nlerp(load(a, i, count), load(b, i, count), weight));
+		}
+	}
+
+	void nlerp_corrected(QuatConstSpan const a, QuatConstSpan const b, real_t const t, QuatSpan const out) {
+		GD_PROFILE_SCOPE("batch::nlerp_corrected");
+
+		Float4 const weight = simd::splat(t);
+		size_t const count = shortest({a, b, out});
+
+		for (size_t i = 0; i < count; i += 4) {
+			store(out, i, count, nlerp_corrected(load(a, i, count), load(b, i, count), weight));
+		}
+	}
+
+	void scatter(QuatConstSpan const from, std::span<core::Quat> const to) {
+		GD_PROFILE_SCOPE("batch::scatter");
+
+		size_t const count = std::min(shortest({from}), to.size());
+
+		for (size_t i = 0; i < count; i += 1) {
+			to[i] = core::Quat{from.x[i], from.y[i], from.z[i], from.w[i]};
+		}
+	}
+
+	void slerp(QuatConstSpan const a, QuatConstSpan const b, real_t const t, QuatSpan const out) {
+		GD_PROFILE_SCOPE("batch::slerp");
+
+		Float4 const weight = simd::splat(t);
+		size_t const count = shortest({a, b, out});
+
+		for (size_t i = 0; i < count; i += 4) {
+			store(out, i, count, slerp(load(a, i, count), load(b, i, count), weight));
+		}
+	}
+}
@@ -0,0 +1,319 @@
+#include "godot/batch.hpp"
+#include "godot/profile.hpp"
+#include "godot/simd.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace godot::batch {
+	using core::Basis;
+	using core::Transform;
+	using core::Vector3;
+	using simd::Float4;
+
+	// A transform is a 3x4 matrix whose rows are the basis rows with the origin component appended, so
+	// `a * b` row `r` is `a[r][0] * b0 + a[r][1] * b1 + a[r][2] * b2 + (0, 0, 0, a[r][3])`.
+	static Float4 row_of(Vector3 const& basis_row, real_t const origin) {
+		return simd::set(basis_row.x, basis_row.y, basis_row.z, origin);
+	}
+
+	static void multiply(Transform const& a, Transform const& b, Transform& out) {
+		Float4 const b0 = row_of(b.basis.x, b.origin.x);
+		Float4 const b1 = row_of(b.basis.y, b.origin.y);
+		Float4 const b2 = row_of(b.basis.z, b.origin.z);
+		real_t rows[3][4];
+
+		Vector3 const* a_rows[3] = {(&a.basis.x), (&a.basis.y), (&a.basis.z)};
+		real_t const a_origin[3] = {a.origin.x, a.origin.y, a.origin.z};
+
+		for (int r = 0; r < 3; r += 1) {
+			simd::store(rows[r], (
+				(simd::splat(a_rows[r]->x) * b0) +
+				(simd::splat(a_rows[r]->y) * b1) +
+				(simd::splat(a_rows[r]->z) * b2) +
+				simd::set(0, 0, 0, a_origin[r])
+			));
+		}
+
+		out = Transform{
+			Basis{
+				Vector3{rows[0][0], rows[0][1], rows[0][2]},
+				Vector3{rows[1][0], rows[1][1], rows[1][2]},
+				Vector3{rows[2][0], rows[2][1], rows[2][2]}
+			},
+			Vector3{rows[0][3], rows[1][3], rows[2][3]}
+		};
+	}
+
+	// Transforms as twelve lanes of four, for kernels that work on four transforms at a time.
+	struct Transform4 {
+		Float4 xx, xy, xz, yx, yy, yz, zx, zy, zz, ox, oy, oz;
+	};
+
+	static Transform4 load(std::span<Transform const> const from, size_t const index) {
+		real_t lanes[12][4];
+
+		for (size_t i = 0; i < 4; i += 1) {
+			// Pad the tail with identity transforms.
+			Transform const transform = (((index + i) < from.size()) ? from[(index + i)] : Transform::of(
+				Basis::of(Vector3::right(), Vector3::up(), Vector3::back()),
+				Vector3::zero()
+			));
+
+			real_t const* components = (&transform.basis.x.x);
+
+			for (size_t component = 0; component < 12; component += 1) {
+				lanes[component][i] = components[component];
+			}
+		}
+
+		return Transform4{
+			simd::load(lanes[0]), simd::load(lanes[1]), simd::load(lanes[2]),
+			simd::load(lanes[3]), simd::load(lanes[4]), simd::load(lanes[5]),
+			simd::load(lanes[6]), simd::load(lanes[7]), simd::load(lanes[8]),
+			simd::load(lanes[9]), simd::load(lanes[10]), simd::load(lanes[11])
+		};
+	}
+
+	static void store(std::span<Transform> const to, size_t const index, Transform4 const& value) {
+		real_t lanes[12][4];
+		Float4 const* components = (&value.xx);
+
+		for (size_t component = 0; component < 12; component += 1) simd::store(lanes[component], components[component]);
+
+		for (size_t i = 0; ((i < 4) && ((index + i) < to.size())); i += 1) {
+			real_t * transform = (&to[(index + i)].basis.x.x);
+
+			for (size_t component = 0; component < 12; component += 1) {
+				transform[component] = lanes[component][i];
+			}
+		}
+	}
+
+	static_assert(sizeof(Transform) == (sizeof(real_t) * 12), "Transform must be twelve packed reals");
+
+	static_assert(sizeof(Transform4) == (sizeof(Float4) * 12), "Transform4 must be twelve packed lanes");
+
+	void affine_inverse(std::span<Transform const> const from, std::span<Transform> const to) {
+		GD_PROFILE_SCOPE("batch::affine_inverse");
+
+		Float4 const zero = simd::splat(0);
+		Float4 const one = simd::splat(1.f);
+		size_t const count = std::min(from.size(), to.size());
+
+		for (size_t i = 0; i < count; i += 4) {
+			Transform4 const t = load(from.first(count), i);
+			Float4 const co0 = ((t.yy * t.zz) - (t.yz * t.zy));
+			Float4 const co1 = ((t.yz * t.zx) - (t.yx * t.zz));
+			Float4 const co2 = ((t.yx * t.zy) - (t.yy * t.zx));
+			Float4 const det = ((t.xx * co0) + (t.xy * co1) + (t.xz * co2));
+			Float4 const singular = simd::equal(det, zero);
+			Float4 const s = simd::select(singular, zero, (one / simd::select(singular, one, det)));
+			Transform4 inverse;
+
+			inverse.xx = (co0 * s);
+			inverse.xy = (((t.xz * t.zy) - (t.xy * t.zz)) * s);
+			inverse.xz = (((t.xy * t.yz) - (t.xz * t.yy)) * s);
+			inverse.yx = (co1 * s);
+			inverse.yy = (((t.xx * t.zz) - (t.xz * t.zx)) * s);
+			inverse.yz = (((t.xz * t.yx) - (t.xx * t.yz)) * s);
+			inverse.zx = (co2 * s);
+			inverse.zy = (((t.xy * t.zx) - (t.xx * t.zy)) * s);
+			inverse.zz = (((t.xx * t.yy) - (t.xy * t.yx)) * s);
+
+			Float4 const ox = (zero - t.ox);
+			Float4 const oy = (zero - t.oy);
+			Float4 const oz = (zero - t.oz);
+
+			inverse.ox = ((inverse.xx * ox) + (inverse.xy * oy) + (inverse.xz * oz));
+			inverse.oy = ((inverse.yx * ox) + (inverse.yy * oy) + (inverse.yz * oz));
+			inverse.oz = ((inverse.zx * ox) + (inverse.zy * oy) + (inverse.zz * oz));
+
+			store(to.first(count), i, inverse);
+		}
+	}
+
+	void multiply(
+		std::span<Transform const> const a,
+		std::span<Transform const> const b,
+		std::span<Transform> const out
+	) {
+		GD_PROFILE_SCOPE("batch::multiply");
+
+		size_t const count = std::min({a.size(), b.size(), out.size()});
+
+		for (size_t i = 0; i < count; i += 1) multiply(a[i], b[i], out[i]);
+	}
+
+	void propagate_hierarchy(
+		std::span<godot_int const> const parents,
+		std::span<Transform const> const locals,
+		std::span<Transform> const globals
+	) {
+		GD_PROFILE_SCOPE("batch::propagate_hierarchy");
+
+		size_t const count = std::min({parents.size(), locals.size(), globals.size()});
+
+		for (size_t i = 0; i < count; i += 1) {
+			godot_int const parent = parents[i];
+
+			if ((parent < 0) || (static_cast<size_t>(parent) >= i)) {
+				globals[i] = locals[i];
+			} else {
+				multiply(globals[static_cast<size_t>(parent)], locals[i], globals[i]);
+			}
+		}
+	}
+
+	// Bones as columns (basis columns, then origin) so a vertex is skinned with four multiply-adds.
+	struct BoneColumns {
+		Float4 columns[4];
+	};
+
+	static BoneColumns columns_of(Transform const& transform) {
+		Basis const& basis = transform.basis;
+		Vector3 const& origin = transform.origin;
+
+		return BoneColumns{{
+			simd::set(basis.x.x, basis.y.x, basis.z.x, 0),
+			simd::set(basis.x.y, basis.y.y, basis.z.y, 0),
+			simd::set(basis.x.z, basis.y.z, basis.z.z, 0),
+			simd::set(origin.x, origin.y, origin.z, 0)
+		}};
+	}
+
+	static std::vector<BoneColumns> palette_of(std::span<Transform const> const bones) {
+		std::vector<BoneColumns> palette(bones.size());
+
+		for (size_t i = 0; i < bones.size(); i += 1) palette[i] = columns_of(bones[i]);
+
+		return palette;
+	}
+
+	static BoneColumns blend(
+		std::vector<BoneColumns> const& palette,
+		godot_int const* indices,
+		real_t const* weights
+	) {
+		Float4 const zero = simd::splat(0);
+		BoneColumns blended = {{zero, zero, zero, zero}};
+
+		for (size_t k = 0; k < 4; k += 1) {
+			size_t const bone = static_cast<size_t>(indices[k]);
+
+			if ((indices[k] < 0) || (bone >= palette.size()) || (weights[k] == 0)) continue;
+
+			Float4 const weight = simd::splat(weights[k]);
+
+			for (size_t c = 0; c < 4; c += 1) {
+				blended.columns[c] = simd::multiply_add(palette[bone].columns[c], weight, blended.columns[c]);
+			}
+		}
+
+		return blended;
+	}
+
+	// Vertices that have an input, four bone indices, four weights and an output to write to.
+	static size_t skinned_count(
+		std::span<Vector3 const> const inputs,
+		std::span<godot_int const> const bone_indices,
+		std::span<real_t const> const bone_weights,
+		std::span<Vector3> const out
+	) {
+		return std::min({inputs.size(), (bone_indices.size() / 4), (bone_weights.size() / 4), out.size()});
+	}
+
+	void skin(
+		std::span<Transform const> const bones,
+		std::span<Vector3 const> const vertices,
+		std::span<godot_int const> const bone_indices,
+		std::span<real_t const> const bone_weights,
+		std::span<Vector3> const out
+	) {
+		GD_PROFILE_SCOPE("batch::skin");
+
+		std::vector<BoneColumns> const palette = palette_of(bones);
+		size_t const count = skinned_count(vertices, bone_indices, bone_weights, out);
+		real_t result[4];
+
+		for (size_t i = 0; i < count; i += 1) {
+			BoneColumns const m = blend(palette, (&bone_indices[(i * 4)]), (&bone_weights[(i * 4)]));
+			Vector3 const& v = vertices[i];
+
+			simd::store(result, (
+				(m.columns[0] * simd::splat(v.x)) +
+				(m.columns[1] * simd::splat(v.y)) +
+				(m.columns[2] * simd::splat(v.z)) +
+				m.columns[3]
+			));
+
+			out[i] = Vector3{result[0], result[1], result[2]};
+		}
+	}
+
+	void skin_normals(
+		std::span<Transform const> const bones,
+		std::span<Vector3 const> const normals,
+		std::span<godot_int const> const bone_indices,
+		std::span<real_t const> const bone_weights,
+		std::span<Vector3> const out
+	) {
+		GD_PROFILE_SCOPE("batch::skin_normals");
+
+		std::vector<BoneColumns> const palette = palette_of(bones);
+		size_t const count = skinned_count(normals, bone_indices, bone_weights, out);
+		real_t result[4];
+
+		for (size_t i = 0; i < count; i += 1) {
+			BoneColumns const m = blend(palette, (&bone_indices[(i * 4)]), (&bone_weights[(i * 4)]));
+			Vector3 const& n = normals[i];
+
+			simd::store(result, (
+				(m.columns[0] * simd::splat(n.x)) +
+				(m.columns[1] * simd::splat(n.y)) +
+				(m.columns[2] * simd::splat(n.z))
+			));
+
+			real_t const length_squared = (
+				(result[0] * result[0]) + (result[1] * result[1]) + (result[2] * result[2])
+			);
+
+			if (length_squared == 0) {
+				out[i] = Vector3::zero();
+			} else {
+				real_t const inverse_length = (1.f / std::sqrt(length_squared));
+
+				out[i] = Vector3{
+					(result[0] * inverse_length),
+					(result[1] * inverse_length),
+					(result[2] * inverse_length)
+				};
+			}
+		}
+	}
+
+	void xform(
+		Transform const& transform,
+		std::span<Vector3 const> const points,
+		std::span<Vector3> const out
+	) {
+		GD_PROFILE_SCOPE("batch::xform");
+
+		BoneColumns const m = columns_of(transform);
+		size_t const count = std::min(points.size(), out.size());
+		real_t result[4];
+
+		for (size_t i = 0; i < count; i += 1) {
+			Vector3 const& v = points[i];
+
+			simd::store(result, (
+				(m.columns[0] * simd::splat(v.x)) +
+				(m.columns[1] * simd::splat(v.y)) +
+				(m.columns[2] * simd::splat(v.z)) +
+				m.columns[3]
+			));
+
+			out[i] = Vector3{result[0], result[1], result[2]};
+		}
+	}
+}
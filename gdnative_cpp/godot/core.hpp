@@ -5,17 +5,27 @@
 #include <cstdlib>
 #include <cstdint>
 #include <cmath>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// `core::main_thread_only` for the enclosing function and line.
+#define GD_MAIN_THREAD_ONLY() ::godot::core::main_thread_only(__func__, __FILE__, __LINE__)
 
 namespace godot::core {
-	extern "C" static godot_gdnative_core_api_struct * api_core;
+	extern godot_gdnative_core_api_struct * api_core;
+
+	extern godot_gdnative_core_1_1_api_struct * api_core11;
 
-	extern "C" static godot_gdnative_core_1_1_api_struct * api_core11;
+	extern godot_gdnative_core_1_2_api_struct * api_core12;
 
-	extern "C" static godot_gdnative_core_1_2_api_struct * api_core12;
+	extern godot_gdnative_ext_nativescript_api_struct * api_nativescript;
 
-	extern "C" static godot_gdnative_ext_nativescript_api_struct * api_nativescript;
+	extern godot_gdnative_ext_nativescript_1_1_api_struct * api_nativescript11;
 
-	extern "C" static godot_gdnative_ext_nativescript_1_1_api_struct * api_nativescript11;
+	/// Library handle given to `nativescript_init`, which the NativeScript registration functions take.
+	extern void * nativescript_handle;
 
 	using real_t = float;
 
@@ -25,6 +35,10 @@ namespace godot::core {
 
 	static constexpr real_t INF = INFINITY;
 
+	static constexpr real_t CMP_EPSILON = 0.00001;
+
+	static constexpr real_t UNIT_EPSILON = 0.001;
+
 	enum class Error {
 		OK = 0,
 		FAILED = 1,
@@ -79,10 +93,46 @@ namespace godot::core {
 
 	real_t stepify(real_t s, real_t step);
 
+	void bind_main_thread();
+
+	bool is_main_thread();
+
+	/// Reports an error at the given call site through the engine and returns `false` when called off the
+	/// main thread. Generated ptrcall methods check this before crossing into the engine, as do the
+	/// library's entry points that must run there. `Ref` counting is exempt, since the engine's count is
+	/// atomic. Call it through `GD_MAIN_THREAD_ONLY` so the report names the caller.
+	bool main_thread_only(char const* function, char const* file, int line);
+
+	/// API revisions past 1.0 that the running engine provides. Wrappers that have a faster path through a
+	/// newer table check these and fall back to 1.0 calls when it is missing.
+	struct Capabilities {
+		bool core11;
+
+		bool core12;
+
+		bool nativescript;
+
+		bool nativescript11;
+	};
+
+	Capabilities const& capabilities();
+
+	/// Fills every API table from the options passed to `godot_gdnative_init` by walking the core `next`
+	/// chain and the extension list once, then binds the calling thread as the main thread.
+	void gdnative_init(godot_gdnative_init_options const* options);
+
+	/// Clears the API tables, for `godot_gdnative_terminate`.
+	void gdnative_terminate();
+
+	/// Stores the handle passed to `godot_nativescript_init` for class registration.
+	void nativescript_init(void * handle);
+
 	struct Basis;
 
 	class String;
 
+	class Variant;
+
 	struct Vector2 {
 		real_t x, y;
 
@@ -529,12 +579,12 @@ namespace godot::core {
 
 		real_t d;
 
-		static constexpr Plane from_points(
+		static Plane from_points(
 			Vector3 const& v1,
 			Vector3 const& v2,
 			Vector3 const& v3
 		) {
-			Vector3 const normal = (v1 - v2).cross(v1 - v2).normalized();
+			Vector3 const normal = (v1 - v3).cross(v1 - v2).normalized();
 
 			return Plane{normal, normal.dot(v1)};
 		}
@@ -684,7 +734,7 @@ namespace godot::core {
 	struct Color {
 		real_t r, g, b, a;
 
-		static inline Color from_hsv(real_t h, real_t s, real_t v, real_t a);
+		static Color from_hsv(real_t h, real_t s, real_t v, real_t a = 1.f);
 
 		static constexpr Color from_rgba(uint32_t const from) {
 			return Color{
@@ -768,6 +818,10 @@ namespace godot::core {
 			return Basis{Vector3::zero(), Vector3::zero(), Vector3::zero()};
 		}
 
+		static Basis from_quat(Quat const& rotation);
+
+		Basis operator*(Basis const& that) const;
+
 		real_t determinant() const;
 
 		Vector3 get_euler() const;
@@ -814,6 +868,8 @@ namespace godot::core {
 			return Transform{Basis::zero(), Vector3::zero()};
 		}
 
+		Transform operator*(Transform const& that) const;
+
 		Transform affine_inverse() const;
 
 		Transform interpolate_with(Transform const& transform, real_t const weight) const;
@@ -913,6 +969,10 @@ namespace godot::core {
 
 		constexpr Object(void * obj) : handle(static_cast<godot_object *>(obj)) { }
 
+		static constexpr Object of(godot_object * handle) {
+			return Object(handle);
+		}
+
 		constexpr godot_object * handleof() {
 			return this->handle;
 		}
@@ -922,6 +982,189 @@ namespace godot::core {
 		}
 	};
 
+	/// Takes a reference on a `Reference`, consuming the initial count of one that was just created. Returns
+	/// `false` if the object is already being freed.
+	bool init_ref(godot_object * object);
+
+	void reference(godot_object * object);
+
+	/// Drops a reference, destroying the object when it was the last one.
+	void unreference(godot_object * object);
+
+	/// Owning handle to a `Reference`-derived object, counting through the engine's `Reference` method binds
+	/// directly rather than through a `Variant`. `Type` is `Object` or a generated engine class. Moves hand the
+	/// reference over without touching the count.
+	template<typename Type> class Ref final {
+		Type object;
+
+		godot_object * raw() const {
+			return const_cast<godot_object *>(this->object.handleof());
+		}
+
+		public:
+		constexpr Ref() : object() { }
+
+		/// `object` must derive from `Reference`.
+		Ref(Type const& object) : object(object) {
+			if ((this->raw() != nullptr) && (!init_ref(this->raw()))) this->object = Type();
+		}
+
+		Ref(Ref const& that) : object(that.object) {
+			if (this->raw() != nullptr) reference(this->raw());
+		}
+
+		Ref(Ref&& that) noexcept : object(that.object) {
+			that.object = Type();
+		}
+
+		~Ref() {
+			if (this->raw() != nullptr) unreference(this->raw());
+		}
+
+		/// Wraps a reference the caller already owns without taking another, such as the object a ptrcall
+		/// writes for a method returning a `Reference`.
+		static Ref adopt(godot_object * handle) {
+			Ref ref;
+
+			ref.object = Type::of(handle);
+
+			return ref;
+		}
+
+		Ref& operator=(Ref const& that) {
+			if (this->raw() != that.raw()) {
+				if (that.raw() != nullptr) reference(that.raw());
+
+				if (this->raw() != nullptr) unreference(this->raw());
+
+				this->object = that.object;
+			}
+
+			return *this;
+		}
+
+		Ref& operator=(Ref&& that) noexcept {
+			if (this != (&that)) {
+				if (this->raw() != nullptr) unreference(this->raw());
+
+				this->object = that.object;
+				that.object = Type();
+			}
+
+			return *this;
+		}
+
+		Type * operator->() {
+			return (&this->object);
+		}
+
+		Type const* operator->() const {
+			return (&this->object);
+		}
+
+		bool operator==(Ref const& that) const {
+			return (this->raw() == that.raw());
+		}
+
+		explicit operator bool() const {
+			return (this->raw() != nullptr);
+		}
+
+		Type const& get() const {
+			return this->object;
+		}
+
+		godot_object * handleof() const {
+			return this->raw();
+		}
+
+		bool is_valid() const {
+			return (this->raw() != nullptr);
+		}
+
+		/// Gives up ownership without dropping the reference, such as to hand it back to the engine.
+		godot_object * release() {
+			godot_object * const handle = this->raw();
+
+			this->object = Type();
+
+			return handle;
+		}
+
+		void unref() {
+			if (this->raw() != nullptr) unreference(this->raw());
+
+			this->object = Type();
+		}
+	};
+
+	static constexpr char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+	/// Decodes one code point from the engine's wide strings, joining surrogate pairs where `wchar_t` is
+	/// 16 bits wide and replacing unpaired surrogates.
+	inline char32_t next_code_point(wchar_t const*& cursor, wchar_t const* end) {
+		char32_t const unit = static_cast<char32_t>(*cursor);
+
+		cursor += 1;
+
+		if constexpr (sizeof(wchar_t) == 2) {
+			if ((unit >= 0xD800) && (unit < 0xDC00)) {
+				if ((cursor == end) || (*cursor < 0xDC00) || (*cursor >= 0xE000)) return REPLACEMENT_CHARACTER;
+
+				char32_t const low = static_cast<char32_t>(*cursor);
+
+				cursor += 1;
+
+				return (0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00));
+			}
+		}
+
+		if (((unit >= 0xD800) && (unit < 0xE000)) || (unit > 0x10FFFF)) return REPLACEMENT_CHARACTER;
+
+		return unit;
+	}
+
+	constexpr size_t utf8_size(char32_t const code_point) {
+		if (code_point < 0x80) return 1;
+
+		if (code_point < 0x800) return 2;
+
+		if (code_point < 0x10000) return 3;
+
+		return 4;
+	}
+
+	/// Writes the UTF-8 encoding of `code_point`, `utf8_size(code_point)` bytes, and returns the end.
+	inline uint8_t * put_utf8(uint8_t * out, char32_t const code_point) {
+		if (code_point < 0x80) {
+			out[0] = static_cast<uint8_t>(code_point);
+
+			return (out + 1);
+		}
+
+		if (code_point < 0x800) {
+			out[0] = static_cast<uint8_t>(0xC0 | (code_point >> 6));
+			out[1] = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+
+			return (out + 2);
+		}
+
+		if (code_point < 0x10000) {
+			out[0] = static_cast<uint8_t>(0xE0 | (code_point >> 12));
+			out[1] = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+			out[2] = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+
+			return (out + 3);
+		}
+
+		out[0] = static_cast<uint8_t>(0xF0 | (code_point >> 18));
+		out[1] = static_cast<uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+		out[2] = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+		out[3] = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+
+		return (out + 4);
+	}
+
 	class String final {
 		godot_string handle;
 
@@ -932,6 +1175,8 @@ namespace godot::core {
 
 		String(char const* pointer);
 
+		constexpr String(godot_string const& raw) : handle(raw) { }
+
 		~String();
 
 		constexpr godot_string * handleof() {
@@ -947,32 +1192,325 @@ namespace godot::core {
 		int length() const;
 	};
 
+	template<typename Type> class PoolArrayRead final {
+		void * access;
+
+		void (*release)(void * access);
+
+		std::span<Type const> elements;
+
+		public:
+		constexpr PoolArrayRead(
+			void * access,
+			void (*release)(void * access),
+			std::span<Type const> const elements
+		) : access(access), release(release), elements(elements) { }
+
+		PoolArrayRead(PoolArrayRead const& that) = delete;
+
+		constexpr PoolArrayRead(PoolArrayRead&& that) :
+			access(that.access),
+			release(that.release),
+			elements(that.elements) {
+
+			that.access = nullptr;
+		}
+
+		~PoolArrayRead() {
+			if (this->access) this->release(this->access);
+		}
+
+		constexpr Type const& operator[](size_t const index) const {
+			return this->elements[index];
+		}
+
+		constexpr Type const* begin() const {
+			return this->elements.data();
+		}
+
+		constexpr Type const* data() const {
+			return this->elements.data();
+		}
+
+		constexpr Type const* end() const {
+			return (this->elements.data() + this->elements.size());
+		}
+
+		constexpr size_t size() const {
+			return this->elements.size();
+		}
+
+		constexpr std::span<Type const> span() const {
+			return this->elements;
+		}
+	};
+
+	template<typename Type> class PoolArrayWrite final {
+		void * access;
+
+		void (*release)(void * access);
+
+		std::span<Type> elements;
+
+		public:
+		constexpr PoolArrayWrite(
+			void * access,
+			void (*release)(void * access),
+			std::span<Type> const elements
+		) : access(access), release(release), elements(elements) { }
+
+		PoolArrayWrite(PoolArrayWrite const& that) = delete;
+
+		constexpr PoolArrayWrite(PoolArrayWrite&& that) :
+			access(that.access),
+			release(that.release),
+			elements(that.elements) {
+
+			that.access = nullptr;
+		}
+
+		~PoolArrayWrite() {
+			if (this->access) this->release(this->access);
+		}
+
+		constexpr Type& operator[](size_t const index) const {
+			return this->elements[index];
+		}
+
+		constexpr Type* begin() const {
+			return this->elements.data();
+		}
+
+		constexpr Type* data() const {
+			return this->elements.data();
+		}
+
+		constexpr Type* end() const {
+			return (this->elements.data() + this->elements.size());
+		}
+
+		constexpr size_t size() const {
+			return this->elements.size();
+		}
+
+		constexpr std::span<Type> span() const {
+			return this->elements;
+		}
+	};
+
 	class PoolByteArray final {
 		godot_pool_byte_array handle;
+
+		public:
+		PoolByteArray();
+
+		PoolByteArray(PoolByteArray const& that);
+
+		constexpr PoolByteArray(godot_pool_byte_array const& raw) : handle(raw) { }
+
+		~PoolByteArray();
+
+		constexpr godot_pool_byte_array * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_pool_byte_array const* handleof() const {
+			return (&this->handle);
+		}
+
+		PoolArrayRead<uint8_t> read() const;
+
+		void resize(int size);
+
+		int size() const;
+
+		PoolArrayWrite<uint8_t> write();
 	};
 
 	class PoolIntArray final {
 		godot_pool_int_array handle;
+
+		public:
+		PoolIntArray();
+
+		PoolIntArray(PoolIntArray const& that);
+
+		constexpr PoolIntArray(godot_pool_int_array const& raw) : handle(raw) { }
+
+		~PoolIntArray();
+
+		constexpr godot_pool_int_array * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_pool_int_array const* handleof() const {
+			return (&this->handle);
+		}
+
+		PoolArrayRead<godot_int> read() const;
+
+		void resize(int size);
+
+		int size() const;
+
+		PoolArrayWrite<godot_int> write();
 	};
 
 	class PoolRealArray final {
 		godot_pool_real_array handle;
+
+		public:
+		PoolRealArray();
+
+		PoolRealArray(PoolRealArray const& that);
+
+		constexpr PoolRealArray(godot_pool_real_array const& raw) : handle(raw) { }
+
+		~PoolRealArray();
+
+		constexpr godot_pool_real_array * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_pool_real_array const* handleof() const {
+			return (&this->handle);
+		}
+
+		PoolArrayRead<real_t> read() const;
+
+		void resize(int size);
+
+		int size() const;
+
+		PoolArrayWrite<real_t> write();
 	};
 
 	class PoolStringArray final {
 		godot_pool_string_array handle;
+
+		public:
+		PoolStringArray();
+
+		PoolStringArray(PoolStringArray const& that);
+
+		constexpr PoolStringArray(godot_pool_string_array const& raw) : handle(raw) { }
+
+		~PoolStringArray();
+
+		/// Builds an array from UTF-8 strings, sized once and filled under a single write lock with each string
+		/// decoded straight into its element.
+		static PoolStringArray of(std::span<std::string const> strings);
+
+		static PoolStringArray of(std::span<std::string_view const> strings);
+
+		constexpr godot_pool_string_array * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_pool_string_array const* handleof() const {
+			return (&this->handle);
+		}
+
+		PoolArrayRead<String> read() const;
+
+		void resize(int size);
+
+		int size() const;
+
+		/// Replaces the contents of `destination` with the elements encoded as UTF-8 under a single read lock,
+		/// reusing the storage of strings already in it.
+		void to_utf8(std::vector<std::string>& destination) const;
+
+		std::vector<std::string> to_utf8() const;
+
+		PoolArrayWrite<String> write();
 	};
 
 	class PoolVector2Array final {
 		godot_pool_vector2_array handle;
+
+		public:
+		PoolVector2Array();
+
+		PoolVector2Array(PoolVector2Array const& that);
+
+		constexpr PoolVector2Array(godot_pool_vector2_array const& raw) : handle(raw) { }
+
+		~PoolVector2Array();
+
+		constexpr godot_pool_vector2_array * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_pool_vector2_array const* handleof() const {
+			return (&this->handle);
+		}
+
+		PoolArrayRead<Vector2> read() const;
+
+		void resize(int size);
+
+		int size() const;
+
+		PoolArrayWrite<Vector2> write();
 	};
 
 	class PoolVector3Array final {
 		godot_pool_vector3_array handle;
+
+		public:
+		PoolVector3Array();
+
+		PoolVector3Array(PoolVector3Array const& that);
+
+		constexpr PoolVector3Array(godot_pool_vector3_array const& raw) : handle(raw) { }
+
+		~PoolVector3Array();
+
+		constexpr godot_pool_vector3_array * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_pool_vector3_array const* handleof() const {
+			return (&this->handle);
+		}
+
+		PoolArrayRead<Vector3> read() const;
+
+		void resize(int size);
+
+		int size() const;
+
+		PoolArrayWrite<Vector3> write();
 	};
 
 	class PoolColorArray final {
 		godot_pool_color_array handle;
+
+		public:
+		PoolColorArray();
+
+		PoolColorArray(PoolColorArray const& that);
+
+		constexpr PoolColorArray(godot_pool_color_array const& raw) : handle(raw) { }
+
+		~PoolColorArray();
+
+		constexpr godot_pool_color_array * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_pool_color_array const* handleof() const {
+			return (&this->handle);
+		}
+
+		PoolArrayRead<Color> read() const;
+
+		void resize(int size);
+
+		int size() const;
+
+		PoolArrayWrite<Color> write();
 	};
 
 	class Array final {
@@ -990,8 +1528,8 @@ namespace godot::core {
 		};
 
 		enum SliceFlags {
-			DUPLICATE_NONE = 0,
-			DUPLICATE_DEEP = 0x1
+			SLICE_NONE = 0,
+			SLICE_DEEP = 0x1
 		};
 
 		Array();
@@ -1130,6 +1668,8 @@ namespace godot::core {
 
 		NodePath(NodePath const& that);
 
+		constexpr NodePath(godot_node_path const& raw) : handle(raw) { }
+
 		~NodePath();
 
 		NodePath get_as_property_path() const;
@@ -1140,6 +1680,14 @@ namespace godot::core {
 
 		int get_subname_count() const;
 
+		constexpr godot_node_path * handleof() {
+			return (&this->handle);
+		}
+
+		constexpr godot_node_path const* handleof() const {
+			return (&this->handle);
+		}
+
 		bool is_absolute() const;
 
 		bool is_empty() const;
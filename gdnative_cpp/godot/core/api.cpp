@@ -0,0 +1,86 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	godot_gdnative_core_api_struct * api_core = nullptr;
+
+	godot_gdnative_core_1_1_api_struct * api_core11 = nullptr;
+
+	godot_gdnative_core_1_2_api_struct * api_core12 = nullptr;
+
+	godot_gdnative_ext_nativescript_api_struct * api_nativescript = nullptr;
+
+	godot_gdnative_ext_nativescript_1_1_api_struct * api_nativescript11 = nullptr;
+
+	void * nativescript_handle = nullptr;
+
+	static Capabilities supported = Capabilities{false, false, false, false};
+
+	static bool is_version(godot_gdnative_api_struct const* api, unsigned int const major, unsigned int const minor) {
+		return ((api->version.major == major) && (api->version.minor == minor));
+	}
+
+	Capabilities const& capabilities() {
+		return supported;
+	}
+
+	void gdnative_init(godot_gdnative_init_options const* options) {
+		gdnative_terminate();
+
+		api_core = const_cast<godot_gdnative_core_api_struct *>(options->api_struct);
+
+		// Each table links to the next revision of the same API, which only adds functions, so a revision is
+		// usable whenever it appears anywhere in the chain.
+		for (godot_gdnative_api_struct const* api = api_core->next; api != nullptr; api = api->next) {
+			if (is_version(api, 1, 1)) {
+				api_core11 = reinterpret_cast<godot_gdnative_core_1_1_api_struct *>(
+					const_cast<godot_gdnative_api_struct *>(api)
+				);
+			} else if (is_version(api, 1, 2)) {
+				api_core12 = reinterpret_cast<godot_gdnative_core_1_2_api_struct *>(
+					const_cast<godot_gdnative_api_struct *>(api)
+				);
+			}
+		}
+
+		for (unsigned int i = 0; i < api_core->num_extensions; i += 1) {
+			godot_gdnative_api_struct const* extension = api_core->extensions[i];
+
+			if (extension->type != GDNATIVE_EXT_NATIVESCRIPT) continue;
+
+			api_nativescript = reinterpret_cast<godot_gdnative_ext_nativescript_api_struct *>(
+				const_cast<godot_gdnative_api_struct *>(extension)
+			);
+
+			for (godot_gdnative_api_struct const* api = extension->next; api != nullptr; api = api->next) {
+				if (is_version(api, 1, 1)) {
+					api_nativescript11 = reinterpret_cast<godot_gdnative_ext_nativescript_1_1_api_struct *>(
+						const_cast<godot_gdnative_api_struct *>(api)
+					);
+				}
+			}
+		}
+
+		supported = Capabilities{
+			(api_core11 != nullptr),
+			(api_core12 != nullptr),
+			(api_nativescript != nullptr),
+			(api_nativescript11 != nullptr)
+		};
+
+		bind_main_thread();
+	}
+
+	void gdnative_terminate() {
+		api_core = nullptr;
+		api_core11 = nullptr;
+		api_core12 = nullptr;
+		api_nativescript = nullptr;
+		api_nativescript11 = nullptr;
+		nativescript_handle = nullptr;
+		supported = Capabilities{false, false, false, false};
+	}
+
+	void nativescript_init(void * handle) {
+		nativescript_handle = handle;
+	}
+}
@@ -0,0 +1,31 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	Array::Array() {
+		api_core->godot_array_new(&this->handle);
+	}
+
+	Array::Array(Array const& that) {
+		api_core->godot_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	Array::~Array() {
+		api_core->godot_array_destroy(&this->handle);
+	}
+
+	void Array::clear() {
+		api_core->godot_array_clear(&this->handle);
+	}
+
+	bool Array::is_empty() const {
+		return api_core->godot_array_empty(&this->handle);
+	}
+
+	void Array::resize(int size) {
+		api_core->godot_array_resize((&this->handle), size);
+	}
+
+	int Array::size() const {
+		return api_core->godot_array_size(&this->handle);
+	}
+}
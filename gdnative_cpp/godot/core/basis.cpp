@@ -0,0 +1,148 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	// Rows are stored in `x`, `y` and `z`, matching the memory layout of `godot_basis`.
+
+	Basis Basis::operator*(Basis const& that) const {
+		return Basis{
+			Vector3{that.tdotx(this->x), that.tdoty(this->x), that.tdotz(this->x)},
+			Vector3{that.tdotx(this->y), that.tdoty(this->y), that.tdotz(this->y)},
+			Vector3{that.tdotx(this->z), that.tdoty(this->z), that.tdotz(this->z)}
+		};
+	}
+
+	real_t Basis::determinant() const {
+		return (
+			(this->x.x * ((this->y.y * this->z.z) - (this->z.y * this->y.z))) -
+			(this->y.x * ((this->x.y * this->z.z) - (this->z.y * this->x.z))) +
+			(this->z.x * ((this->x.y * this->y.z) - (this->y.y * this->x.z)))
+		);
+	}
+
+	Basis Basis::from_quat(Quat const& rotation) {
+		real_t const s = (2.f / rotation.length_squared());
+		real_t const xs = (rotation.x * s), ys = (rotation.y * s), zs = (rotation.z * s);
+		real_t const wx = (rotation.w * xs), wy = (rotation.w * ys), wz = (rotation.w * zs);
+		real_t const xx = (rotation.x * xs), xy = (rotation.x * ys), xz = (rotation.x * zs);
+		real_t const yy = (rotation.y * ys), yz = (rotation.y * zs), zz = (rotation.z * zs);
+
+		return Basis{
+			Vector3{(1.f - (yy + zz)), (xy - wz), (xz + wy)},
+			Vector3{(xy + wz), (1.f - (xx + zz)), (yz - wx)},
+			Vector3{(xz - wy), (yz + wx), (1.f - (xx + yy))}
+		};
+	}
+
+	Quat Basis::get_rotation_quat() const {
+		Basis m = this->orthonormalized();
+
+		if (m.determinant() < 0) m = Basis{-m.x, -m.y, -m.z};
+
+		real_t const* rows[3] = {(&m.x.x), (&m.y.x), (&m.z.x)};
+		real_t const trace = (rows[0][0] + rows[1][1] + rows[2][2]);
+		real_t components[4];
+
+		if (trace > 0) {
+			real_t s = std::sqrt(trace + 1.f);
+
+			components[3] = (s * 0.5f);
+			s = (0.5f / s);
+			components[0] = ((rows[2][1] - rows[1][2]) * s);
+			components[1] = ((rows[0][2] - rows[2][0]) * s);
+			components[2] = ((rows[1][0] - rows[0][1]) * s);
+		} else {
+			int const i = ((rows[0][0] < rows[1][1]) ?
+				((rows[1][1] < rows[2][2]) ? 2 : 1) :
+				((rows[0][0] < rows[2][2]) ? 2 : 0));
+
+			int const j = ((i + 1) % 3);
+			int const k = ((i + 2) % 3);
+			real_t s = std::sqrt(rows[i][i] - rows[j][j] - rows[k][k] + 1.f);
+
+			components[i] = (s * 0.5f);
+			s = (0.5f / s);
+			components[3] = ((rows[k][j] - rows[j][k]) * s);
+			components[j] = ((rows[j][i] + rows[i][j]) * s);
+			components[k] = ((rows[k][i] + rows[i][k]) * s);
+		}
+
+		return Quat{components[0], components[1], components[2], components[3]};
+	}
+
+	Basis Basis::inverse() const {
+		real_t const co0 = ((this->y.y * this->z.z) - (this->y.z * this->z.y));
+		real_t const co1 = ((this->y.z * this->z.x) - (this->y.x * this->z.z));
+		real_t const co2 = ((this->y.x * this->z.y) - (this->y.y * this->z.x));
+		real_t const det = ((this->x.x * co0) + (this->x.y * co1) + (this->x.z * co2));
+
+		if (det == 0) return Basis::zero();
+
+		real_t const s = (1.f / det);
+
+		return Basis{
+			Vector3{
+				(co0 * s),
+				(((this->x.z * this->z.y) - (this->x.y * this->z.z)) * s),
+				(((this->x.y * this->y.z) - (this->x.z * this->y.y)) * s)
+			},
+			Vector3{
+				(co1 * s),
+				(((this->x.x * this->z.z) - (this->x.z * this->z.x)) * s),
+				(((this->x.z * this->y.x) - (this->x.x * this->y.z)) * s)
+			},
+			Vector3{
+				(co2 * s),
+				(((this->x.y * this->z.x) - (this->x.x * this->z.y)) * s),
+				(((this->x.x * this->y.y) - (this->x.y * this->y.x)) * s)
+			}
+		};
+	}
+
+	Basis Basis::orthonormalized() const {
+		// Gram-Schmidt over the columns, like the engine.
+		Vector3 const x_axis = Vector3{this->x.x, this->y.x, this->z.x}.normalized();
+		Vector3 y_axis = Vector3{this->x.y, this->y.y, this->z.y};
+		Vector3 z_axis = Vector3{this->x.z, this->y.z, this->z.z};
+
+		y_axis = (y_axis - (x_axis * x_axis.dot(y_axis))).normalized();
+		z_axis = (z_axis - (x_axis * x_axis.dot(z_axis)) - (y_axis * y_axis.dot(z_axis))).normalized();
+
+		return Basis{
+			Vector3{x_axis.x, y_axis.x, z_axis.x},
+			Vector3{x_axis.y, y_axis.y, z_axis.y},
+			Vector3{x_axis.z, y_axis.z, z_axis.z}
+		};
+	}
+
+	real_t Basis::tdotx(Vector3 const& with) const {
+		return ((this->x.x * with.x) + (this->y.x * with.y) + (this->z.x * with.z));
+	}
+
+	real_t Basis::tdoty(Vector3 const& with) const {
+		return ((this->x.y * with.x) + (this->y.y * with.y) + (this->z.y * with.z));
+	}
+
+	real_t Basis::tdotz(Vector3 const& with) const {
+		return ((this->x.z * with.x) + (this->y.z * with.y) + (this->z.z * with.z));
+	}
+
+	Basis Basis::transposed() const {
+		return Basis{
+			Vector3{this->x.x, this->y.x, this->z.x},
+			Vector3{this->x.y, this->y.y, this->z.y},
+			Vector3{this->x.z, this->y.z, this->z.z}
+		};
+	}
+
+	Vector3 Basis::xform(Vector3 const& v) const {
+		return Vector3{
+			((this->x.x * v.x) + (this->x.y * v.y) + (this->x.z * v.z)),
+			((this->y.x * v.x) + (this->y.y * v.y) + (this->y.z * v.z)),
+			((this->z.x * v.x) + (this->z.y * v.y) + (this->z.z * v.z))
+		};
+	}
+
+	Vector3 Basis::xform_inv(Vector3 const& v) const {
+		return Vector3{this->tdotx(v), this->tdoty(v), this->tdotz(v)};
+	}
+}
@@ -0,0 +1,98 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	static uint32_t to_byte(real_t const channel) {
+		return static_cast<uint8_t>(std::round(channel * 255.f));
+	}
+
+	Color Color::blend(Color const& over) const {
+		real_t const sa = (1.f - over.a);
+		real_t const a = ((this->a * sa) + over.a);
+
+		if (a == 0) return Color{0, 0, 0, 0};
+
+		return Color{
+			((((this->r * this->a) * sa) + (over.r * over.a)) / a),
+			((((this->g * this->a) * sa) + (over.g * over.a)) / a),
+			((((this->b * this->a) * sa) + (over.b * over.a)) / a),
+			a
+		};
+	}
+
+	Color Color::contrasted() const {
+		return Color{
+			static_cast<real_t>(std::fmod((this->r + 0.5), 1.0)),
+			static_cast<real_t>(std::fmod((this->g + 0.5), 1.0)),
+			static_cast<real_t>(std::fmod((this->b + 0.5), 1.0)),
+			this->a
+		};
+	}
+
+	Color Color::darkened(real_t const amount) const {
+		return Color{
+			(this->r * (1.f - amount)),
+			(this->g * (1.f - amount)),
+			(this->b * (1.f - amount)),
+			this->a
+		};
+	}
+
+	Color Color::from_hsv(real_t h, real_t const s, real_t const v, real_t const a) {
+		if (s == 0) return Color{v, v, v, a};
+
+		h = std::fmod((h * 6.f), 6.f);
+
+		int const sector = static_cast<int>(std::floor(h));
+		real_t const f = (h - sector);
+		real_t const p = (v * (1.f - s));
+		real_t const q = (v * (1.f - (s * f)));
+		real_t const t = (v * (1.f - (s * (1.f - f))));
+
+		switch (sector) {
+			case 0: return Color{v, t, p, a};
+			case 1: return Color{q, v, p, a};
+			case 2: return Color{p, v, t, a};
+			case 3: return Color{p, q, v, a};
+			case 4: return Color{t, p, v, a};
+			default: return Color{v, p, q, a};
+		}
+	}
+
+	real_t Color::gray() const {
+		return static_cast<real_t>((this->r + this->g + this->b) / 3.0);
+	}
+
+	Color Color::inverted() const {
+		return Color{(1.f - this->r), (1.f - this->g), (1.f - this->b), this->a};
+	}
+
+	Color Color::lightened(real_t const amount) const {
+		return Color{
+			(this->r + ((1.f - this->r) * amount)),
+			(this->g + ((1.f - this->g) * amount)),
+			(this->b + ((1.f - this->b) * amount)),
+			this->a
+		};
+	}
+
+	Color Color::linear_interpolate(Color const& b, real_t t) const {
+		return Color{
+			(this->r + (t * (b.r - this->r))),
+			(this->g + (t * (b.g - this->g))),
+			(this->b + (t * (b.b - this->b))),
+			(this->a + (t * (b.a - this->a)))
+		};
+	}
+
+	uint32_t Color::to_abgr32() const {
+		return ((to_byte(this->a) << 24) | (to_byte(this->b) << 16) | (to_byte(this->g) << 8) | to_byte(this->r));
+	}
+
+	uint32_t Color::to_argb32() const {
+		return ((to_byte(this->a) << 24) | (to_byte(this->r) << 16) | (to_byte(this->g) << 8) | to_byte(this->b));
+	}
+
+	uint32_t Color::to_rgba32() const {
+		return ((to_byte(this->r) << 24) | (to_byte(this->g) << 16) | (to_byte(this->b) << 8) | to_byte(this->a));
+	}
+}
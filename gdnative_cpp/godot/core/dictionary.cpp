@@ -0,0 +1,90 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	static godot_dictionary duplicate_dictionary(godot_dictionary const* source, bool deep);
+
+	// Copies `value` into `destination` the way the engine's `duplicate` does: when `deep`, nested arrays and
+	// dictionaries are duplicated too, otherwise they are shared.
+	static void duplicate_value(godot_variant * destination, godot_variant const* value, bool const deep) {
+		godot_variant_type const type = (deep ? api_core->godot_variant_get_type(value) : GODOT_VARIANT_TYPE_NIL);
+
+		if (type == GODOT_VARIANT_TYPE_DICTIONARY) {
+			godot_dictionary inner = api_core->godot_variant_as_dictionary(value);
+			godot_dictionary copy = duplicate_dictionary((&inner), true);
+
+			api_core->godot_variant_new_dictionary(destination, (&copy));
+			api_core->godot_dictionary_destroy(&copy);
+			api_core->godot_dictionary_destroy(&inner);
+		} else if (type == GODOT_VARIANT_TYPE_ARRAY) {
+			godot_array inner = api_core->godot_variant_as_array(value);
+			godot_int const size = api_core->godot_array_size(&inner);
+			godot_array copy;
+
+			api_core->godot_array_new(&copy);
+			api_core->godot_array_resize((&copy), size);
+
+			for (godot_int i = 0; i < size; i += 1) {
+				godot_variant element;
+
+				duplicate_value((&element), api_core->godot_array_operator_index_const((&inner), i), true);
+				api_core->godot_array_set((&copy), i, (&element));
+				api_core->godot_variant_destroy(&element);
+			}
+
+			api_core->godot_variant_new_array(destination, (&copy));
+			api_core->godot_array_destroy(&copy);
+			api_core->godot_array_destroy(&inner);
+		} else {
+			api_core->godot_variant_new_copy(destination, value);
+		}
+	}
+
+	// Fallback for engines without `godot_dictionary_duplicate`, which core 1.2 added.
+	static godot_dictionary duplicate_dictionary(godot_dictionary const* source, bool const deep) {
+		godot_dictionary result;
+
+		api_core->godot_dictionary_new(&result);
+
+		for (
+			godot_variant const* key = api_core->godot_dictionary_next(source, nullptr);
+			key != nullptr;
+			key = api_core->godot_dictionary_next(source, key)
+		) {
+			godot_variant value;
+
+			duplicate_value((&value), api_core->godot_dictionary_operator_index_const(source, key), deep);
+			api_core->godot_dictionary_set((&result), key, (&value));
+			api_core->godot_variant_destroy(&value);
+		}
+
+		return result;
+	}
+
+	Dictionary::Dictionary() {
+		api_core->godot_dictionary_new(&this->handle);
+	}
+
+	Dictionary::Dictionary(Dictionary const& from) {
+		api_core->godot_dictionary_new_copy((&this->handle), (&from.handle));
+	}
+
+	Dictionary::~Dictionary() {
+		api_core->godot_dictionary_destroy(&this->handle);
+	}
+
+	void Dictionary::clear() {
+		api_core->godot_dictionary_clear(&this->handle);
+	}
+
+	Dictionary Dictionary::duplicate(DuplicateFlags const flags) const {
+		bool const deep = ((flags & DUPLICATE_DEEP) != 0);
+
+		if (capabilities().core12) return Dictionary(api_core12->godot_dictionary_duplicate((&this->handle), deep));
+
+		return Dictionary(duplicate_dictionary((&this->handle), deep));
+	}
+
+	int Dictionary::size() const {
+		return api_core->godot_dictionary_size(&this->handle);
+	}
+}
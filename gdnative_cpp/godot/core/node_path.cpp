@@ -0,0 +1,31 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	NodePath::NodePath() {
+		godot_string empty;
+
+		api_core->godot_string_new(&empty);
+		api_core->godot_node_path_new((&this->handle), (&empty));
+		api_core->godot_string_destroy(&empty);
+	}
+
+	NodePath::NodePath(String const& from) {
+		api_core->godot_node_path_new((&this->handle), from.handleof());
+	}
+
+	NodePath::NodePath(NodePath const& that) {
+		api_core->godot_node_path_new_copy((&this->handle), (&that.handle));
+	}
+
+	NodePath::~NodePath() {
+		api_core->godot_node_path_destroy(&this->handle);
+	}
+
+	bool NodePath::is_absolute() const {
+		return api_core->godot_node_path_is_absolute(&this->handle);
+	}
+
+	bool NodePath::is_empty() const {
+		return api_core->godot_node_path_is_empty(&this->handle);
+	}
+}
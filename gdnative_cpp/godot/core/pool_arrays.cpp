@@ -0,0 +1,356 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	PoolByteArray::PoolByteArray() {
+		api_core->godot_pool_byte_array_new(&this->handle);
+	}
+
+	PoolByteArray::PoolByteArray(PoolByteArray const& that) {
+		api_core->godot_pool_byte_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	PoolByteArray::~PoolByteArray() {
+		api_core->godot_pool_byte_array_destroy(&this->handle);
+	}
+
+	PoolArrayRead<uint8_t> PoolByteArray::read() const {
+		godot_pool_byte_array_read_access * access = api_core->godot_pool_byte_array_read(&this->handle);
+
+		return PoolArrayRead<uint8_t>(access, [](void * access) {
+			api_core->godot_pool_byte_array_read_access_destroy(static_cast<godot_pool_byte_array_read_access *>(access));
+		}, std::span<uint8_t const>(
+			api_core->godot_pool_byte_array_read_access_ptr(access),
+			static_cast<size_t>(api_core->godot_pool_byte_array_size(&this->handle))
+		));
+	}
+
+	void PoolByteArray::resize(int size) {
+		api_core->godot_pool_byte_array_resize((&this->handle), size);
+	}
+
+	int PoolByteArray::size() const {
+		return api_core->godot_pool_byte_array_size(&this->handle);
+	}
+
+	PoolArrayWrite<uint8_t> PoolByteArray::write() {
+		godot_pool_byte_array_write_access * access = api_core->godot_pool_byte_array_write(&this->handle);
+
+		return PoolArrayWrite<uint8_t>(access, [](void * access) {
+			api_core->godot_pool_byte_array_write_access_destroy(static_cast<godot_pool_byte_array_write_access *>(access));
+		}, std::span<uint8_t>(
+			api_core->godot_pool_byte_array_write_access_ptr(access),
+			static_cast<size_t>(api_core->godot_pool_byte_array_size(&this->handle))
+		));
+	}
+
+	PoolIntArray::PoolIntArray() {
+		api_core->godot_pool_int_array_new(&this->handle);
+	}
+
+	PoolIntArray::PoolIntArray(PoolIntArray const& that) {
+		api_core->godot_pool_int_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	PoolIntArray::~PoolIntArray() {
+		api_core->godot_pool_int_array_destroy(&this->handle);
+	}
+
+	PoolArrayRead<godot_int> PoolIntArray::read() const {
+		godot_pool_int_array_read_access * access = api_core->godot_pool_int_array_read(&this->handle);
+
+		return PoolArrayRead<godot_int>(access, [](void * access) {
+			api_core->godot_pool_int_array_read_access_destroy(static_cast<godot_pool_int_array_read_access *>(access));
+		}, std::span<godot_int const>(
+			api_core->godot_pool_int_array_read_access_ptr(access),
+			static_cast<size_t>(api_core->godot_pool_int_array_size(&this->handle))
+		));
+	}
+
+	void PoolIntArray::resize(int size) {
+		api_core->godot_pool_int_array_resize((&this->handle), size);
+	}
+
+	int PoolIntArray::size() const {
+		return api_core->godot_pool_int_array_size(&this->handle);
+	}
+
+	PoolArrayWrite<godot_int> PoolIntArray::write() {
+		godot_pool_int_array_write_access * access = api_core->godot_pool_int_array_write(&this->handle);
+
+		return PoolArrayWrite<godot_int>(access, [](void * access) {
+			api_core->godot_pool_int_array_write_access_destroy(static_cast<godot_pool_int_array_write_access *>(access));
+		}, std::span<godot_int>(
+			api_core->godot_pool_int_array_write_access_ptr(access),
+			static_cast<size_t>(api_core->godot_pool_int_array_size(&this->handle))
+		));
+	}
+
+	PoolRealArray::PoolRealArray() {
+		api_core->godot_pool_real_array_new(&this->handle);
+	}
+
+	PoolRealArray::PoolRealArray(PoolRealArray const& that) {
+		api_core->godot_pool_real_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	PoolRealArray::~PoolRealArray() {
+		api_core->godot_pool_real_array_destroy(&this->handle);
+	}
+
+	PoolArrayRead<real_t> PoolRealArray::read() const {
+		godot_pool_real_array_read_access * access = api_core->godot_pool_real_array_read(&this->handle);
+
+		return PoolArrayRead<real_t>(access, [](void * access) {
+			api_core->godot_pool_real_array_read_access_destroy(static_cast<godot_pool_real_array_read_access *>(access));
+		}, std::span<real_t const>(
+			api_core->godot_pool_real_array_read_access_ptr(access),
+			static_cast<size_t>(api_core->godot_pool_real_array_size(&this->handle))
+		));
+	}
+
+	void PoolRealArray::resize(int size) {
+		api_core->godot_pool_real_array_resize((&this->handle), size);
+	}
+
+	int PoolRealArray::size() const {
+		return api_core->godot_pool_real_array_size(&this->handle);
+	}
+
+	PoolArrayWrite<real_t> PoolRealArray::write() {
+		godot_pool_real_array_write_access * access = api_core->godot_pool_real_array_write(&this->handle);
+
+		return PoolArrayWrite<real_t>(access, [](void * access) {
+			api_core->godot_pool_real_array_write_access_destroy(static_cast<godot_pool_real_array_write_access *>(access));
+		}, std::span<real_t>(
+			api_core->godot_pool_real_array_write_access_ptr(access),
+			static_cast<size_t>(api_core->godot_pool_real_array_size(&this->handle))
+		));
+	}
+
+	PoolStringArray::PoolStringArray() {
+		api_core->godot_pool_string_array_new(&this->handle);
+	}
+
+	PoolStringArray::PoolStringArray(PoolStringArray const& that) {
+		api_core->godot_pool_string_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	PoolStringArray::~PoolStringArray() {
+		api_core->godot_pool_string_array_destroy(&this->handle);
+	}
+
+	template<typename Type> static PoolStringArray pool_string_array_of(std::span<Type const> const strings) {
+		PoolStringArray array;
+
+		array.resize(static_cast<int>(strings.size()));
+
+		// Scoped so the lock is released before the array is returned.
+		{
+			PoolArrayWrite<String> elements = array.write();
+
+			for (size_t i = 0; i < strings.size(); i += 1) {
+				api_core->godot_string_parse_utf8_with_len(
+					elements[i].handleof(),
+					strings[i].data(),
+					static_cast<godot_int>(strings[i].size())
+				);
+			}
+		}
+
+		return array;
+	}
+
+	PoolStringArray PoolStringArray::of(std::span<std::string const> const strings) {
+		return pool_string_array_of(strings);
+	}
+
+	PoolStringArray PoolStringArray::of(std::span<std::string_view const> const strings) {
+		return pool_string_array_of(strings);
+	}
+
+	PoolArrayRead<String> PoolStringArray::read() const {
+		godot_pool_string_array_read_access * access = api_core->godot_pool_string_array_read(&this->handle);
+
+		return PoolArrayRead<String>(access, [](void * access) {
+			api_core->godot_pool_string_array_read_access_destroy(static_cast<godot_pool_string_array_read_access *>(access));
+		}, std::span<String const>(
+			reinterpret_cast<String const*>(api_core->godot_pool_string_array_read_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_string_array_size(&this->handle))
+		));
+	}
+
+	void PoolStringArray::resize(int size) {
+		api_core->godot_pool_string_array_resize((&this->handle), size);
+	}
+
+	int PoolStringArray::size() const {
+		return api_core->godot_pool_string_array_size(&this->handle);
+	}
+
+	void PoolStringArray::to_utf8(std::vector<std::string>& destination) const {
+		PoolArrayRead<String> const elements = this->read();
+
+		destination.resize(elements.size());
+
+		for (size_t i = 0; i < elements.size(); i += 1) {
+			godot_string const* element = elements[i].handleof();
+			wchar_t const* const begin = api_core->godot_string_wide_str(element);
+			wchar_t const* const end = (begin + api_core->godot_string_length(element));
+			std::string& utf8 = destination[i];
+			size_t size = 0;
+
+			for (wchar_t const* cursor = begin; cursor != end;) size += utf8_size(next_code_point(cursor, end));
+
+			utf8.resize(size);
+
+			uint8_t * out = reinterpret_cast<uint8_t *>(utf8.data());
+
+			for (wchar_t const* cursor = begin; cursor != end;) out = put_utf8(out, next_code_point(cursor, end));
+		}
+	}
+
+	std::vector<std::string> PoolStringArray::to_utf8() const {
+		std::vector<std::string> strings;
+
+		this->to_utf8(strings);
+
+		return strings;
+	}
+
+	PoolArrayWrite<String> PoolStringArray::write() {
+		godot_pool_string_array_write_access * access = api_core->godot_pool_string_array_write(&this->handle);
+
+		return PoolArrayWrite<String>(access, [](void * access) {
+			api_core->godot_pool_string_array_write_access_destroy(static_cast<godot_pool_string_array_write_access *>(access));
+		}, std::span<String>(
+			reinterpret_cast<String*>(api_core->godot_pool_string_array_write_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_string_array_size(&this->handle))
+		));
+	}
+
+	PoolVector2Array::PoolVector2Array() {
+		api_core->godot_pool_vector2_array_new(&this->handle);
+	}
+
+	PoolVector2Array::PoolVector2Array(PoolVector2Array const& that) {
+		api_core->godot_pool_vector2_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	PoolVector2Array::~PoolVector2Array() {
+		api_core->godot_pool_vector2_array_destroy(&this->handle);
+	}
+
+	PoolArrayRead<Vector2> PoolVector2Array::read() const {
+		godot_pool_vector2_array_read_access * access = api_core->godot_pool_vector2_array_read(&this->handle);
+
+		return PoolArrayRead<Vector2>(access, [](void * access) {
+			api_core->godot_pool_vector2_array_read_access_destroy(static_cast<godot_pool_vector2_array_read_access *>(access));
+		}, std::span<Vector2 const>(
+			reinterpret_cast<Vector2 const*>(api_core->godot_pool_vector2_array_read_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_vector2_array_size(&this->handle))
+		));
+	}
+
+	void PoolVector2Array::resize(int size) {
+		api_core->godot_pool_vector2_array_resize((&this->handle), size);
+	}
+
+	int PoolVector2Array::size() const {
+		return api_core->godot_pool_vector2_array_size(&this->handle);
+	}
+
+	PoolArrayWrite<Vector2> PoolVector2Array::write() {
+		godot_pool_vector2_array_write_access * access = api_core->godot_pool_vector2_array_write(&this->handle);
+
+		return PoolArrayWrite<Vector2>(access, [](void * access) {
+			api_core->godot_pool_vector2_array_write_access_destroy(static_cast<godot_pool_vector2_array_write_access *>(access));
+		}, std::span<Vector2>(
+			reinterpret_cast<Vector2*>(api_core->godot_pool_vector2_array_write_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_vector2_array_size(&this->handle))
+		));
+	}
+
+	PoolVector3Array::PoolVector3Array() {
+		api_core->godot_pool_vector3_array_new(&this->handle);
+	}
+
+	PoolVector3Array::PoolVector3Array(PoolVector3Array const& that) {
+		api_core->godot_pool_vector3_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	PoolVector3Array::~PoolVector3Array() {
+		api_core->godot_pool_vector3_array_destroy(&this->handle);
+	}
+
+	PoolArrayRead<Vector3> PoolVector3Array::read() const {
+		godot_pool_vector3_array_read_access * access = api_core->godot_pool_vector3_array_read(&this->handle);
+
+		return PoolArrayRead<Vector3>(access, [](void * access) {
+			api_core->godot_pool_vector3_array_read_access_destroy(static_cast<godot_pool_vector3_array_read_access *>(access));
+		}, std::span<Vector3 const>(
+			reinterpret_cast<Vector3 const*>(api_core->godot_pool_vector3_array_read_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_vector3_array_size(&this->handle))
+		));
+	}
+
+	void PoolVector3Array::resize(int size) {
+		api_core->godot_pool_vector3_array_resize((&this->handle), size);
+	}
+
+	int PoolVector3Array::size() const {
+		return api_core->godot_pool_vector3_array_size(&this->handle);
+	}
+
+	PoolArrayWrite<Vector3> PoolVector3Array::write() {
+		godot_pool_vector3_array_write_access * access = api_core->godot_pool_vector3_array_write(&this->handle);
+
+		return PoolArrayWrite<Vector3>(access, [](void * access) {
+			api_core->godot_pool_vector3_array_write_access_destroy(static_cast<godot_pool_vector3_array_write_access *>(access));
+		}, std::span<Vector3>(
+			reinterpret_cast<Vector3*>(api_core->godot_pool_vector3_array_write_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_vector3_array_size(&this->handle))
+		));
+	}
+
+	PoolColorArray::PoolColorArray() {
+		api_core->godot_pool_color_array_new(&this->handle);
+	}
+
+	PoolColorArray::PoolColorArray(PoolColorArray const& that) {
+		api_core->godot_pool_color_array_new_copy((&this->handle), (&that.handle));
+	}
+
+	PoolColorArray::~PoolColorArray() {
+		api_core->godot_pool_color_array_destroy(&this->handle);
+	}
+
+	PoolArrayRead<Color> PoolColorArray::read() const {
+		godot_pool_color_array_read_access * access = api_core->godot_pool_color_array_read(&this->handle);
+
+		return PoolArrayRead<Color>(access, [](void * access) {
+			api_core->godot_pool_color_array_read_access_destroy(static_cast<godot_pool_color_array_read_access *>(access));
+		}, std::span<Color const>(
+			reinterpret_cast<Color const*>(api_core->godot_pool_color_array_read_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_color_array_size(&this->handle))
+		));
+	}
+
+	void PoolColorArray::resize(int size) {
+		api_core->godot_pool_color_array_resize((&this->handle), size);
+	}
+
+	int PoolColorArray::size() const {
+		return api_core->godot_pool_color_array_size(&this->handle);
+	}
+
+	PoolArrayWrite<Color> PoolColorArray::write() {
+		godot_pool_color_array_write_access * access = api_core->godot_pool_color_array_write(&this->handle);
+
+		return PoolArrayWrite<Color>(access, [](void * access) {
+			api_core->godot_pool_color_array_write_access_destroy(static_cast<godot_pool_color_array_write_access *>(access));
+		}, std::span<Color>(
+			reinterpret_cast<Color*>(api_core->godot_pool_color_array_write_access_ptr(access)),
+			static_cast<size_t>(api_core->godot_pool_color_array_size(&this->handle))
+		));
+	}
+}
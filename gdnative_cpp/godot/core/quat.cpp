@@ -0,0 +1,83 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	Quat Quat::cubic_slerp(Quat const& b, Quat const& pre_a, Quat const& post_b, real_t t) const {
+		real_t const t2 = ((1.f - t) * t * 2.f);
+		Quat const sp = this->slerp(b, t);
+		Quat const sq = pre_a.slerpni(post_b, t);
+
+		return sp.slerpni(sq, t2);
+	}
+
+	real_t Quat::dot(Quat const& b) const {
+		return ((this->x * b.x) + (this->y * b.y) + (this->z * b.z) + (this->w * b.w));
+	}
+
+	Quat Quat::inverse() const {
+		return Quat{(-this->x), (-this->y), (-this->z), this->w};
+	}
+
+	bool Quat::is_normalized() const {
+		return (std::fabs(this->length_squared() - 1.f) < UNIT_EPSILON);
+	}
+
+	real_t Quat::length() const {
+		return std::sqrt(this->length_squared());
+	}
+
+	real_t Quat::length_squared() const {
+		return this->dot(*this);
+	}
+
+	Quat Quat::normalized() const {
+		return ((*this) / this->length());
+	}
+
+	Quat Quat::slerp(Quat const& b, real_t t) const {
+		real_t cosom = this->dot(b);
+		Quat to = b;
+		real_t scale0, scale1;
+
+		if (cosom < 0) {
+			cosom = -cosom;
+			to = -b;
+		}
+
+		if ((1.f - cosom) > CMP_EPSILON) {
+			real_t const omega = std::acos(cosom);
+			real_t const sinom = std::sin(omega);
+
+			scale0 = (std::sin((1.f - t) * omega) / sinom);
+			scale1 = (std::sin(t * omega) / sinom);
+		} else {
+			// Close enough to interpolate linearly.
+			scale0 = (1.f - t);
+			scale1 = t;
+		}
+
+		return Quat{
+			((scale0 * this->x) + (scale1 * to.x)),
+			((scale0 * this->y) + (scale1 * to.y)),
+			((scale0 * this->z) + (scale1 * to.z)),
+			((scale0 * this->w) + (scale1 * to.w))
+		};
+	}
+
+	Quat Quat::slerpni(Quat const& b, real_t t) const {
+		real_t const dot = this->dot(b);
+
+		if (std::fabs(dot) > 0.9999f) return *this;
+
+		real_t const theta = std::acos(dot);
+		real_t const sin_t = (1.f / std::sin(theta));
+		real_t const new_factor = (std::sin(t * theta) * sin_t);
+		real_t const inv_factor = (std::sin((1.f - t) * theta) * sin_t);
+
+		return Quat{
+			((inv_factor * this->x) + (new_factor * b.x)),
+			((inv_factor * this->y) + (new_factor * b.y)),
+			((inv_factor * this->z) + (new_factor * b.z)),
+			((inv_factor * this->w) + (new_factor * b.w))
+		};
+	}
+}
@@ -0,0 +1,35 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	static godot_method_bind * reference_bind(char const* method_name) {
+		return api_core->godot_method_bind_get_method("Reference", method_name);
+	}
+
+	static bool call_bool(godot_method_bind * bind, godot_object * object) {
+		bool result = false;
+
+		api_core->godot_method_bind_ptrcall(bind, object, nullptr, (&result));
+
+		return result;
+	}
+
+	// Each bind is looked up once, on first use; `Ref` may count from any thread, which the engine's atomic
+	// reference count allows.
+	bool init_ref(godot_object * object) {
+		static godot_method_bind * const bind = reference_bind("init_ref");
+
+		return call_bool(bind, object);
+	}
+
+	void reference(godot_object * object) {
+		static godot_method_bind * const bind = reference_bind("reference");
+
+		call_bool(bind, object);
+	}
+
+	void unreference(godot_object * object) {
+		static godot_method_bind * const bind = reference_bind("unreference");
+
+		if (call_bool(bind, object)) api_core->godot_object_destroy(object);
+	}
+}
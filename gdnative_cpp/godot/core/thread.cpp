@@ -0,0 +1,24 @@
+#include "godot/core.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace godot::core {
+	static std::atomic<std::thread::id> main_thread_id;
+
+	void bind_main_thread() {
+		main_thread_id.store(std::this_thread::get_id(), std::memory_order_release);
+	}
+
+	bool is_main_thread() {
+		return (main_thread_id.load(std::memory_order_acquire) == std::this_thread::get_id());
+	}
+
+	bool main_thread_only(char const* function, char const* file, int const line) {
+		if (is_main_thread()) return true;
+
+		api_core->godot_print_error("Engine call made from outside of the main thread", function, file, line);
+
+		return false;
+	}
+}
@@ -0,0 +1,13 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	Transform Transform::operator*(Transform const& that) const {
+		return Transform{(this->basis * that.basis), (this->basis.xform(that.origin) + this->origin)};
+	}
+
+	Transform Transform::affine_inverse() const {
+		Basis const inverse = this->basis.inverse();
+
+		return Transform{inverse, inverse.xform(-this->origin)};
+	}
+}
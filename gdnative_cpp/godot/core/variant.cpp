@@ -0,0 +1,131 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	Variant::Variant() {
+		api_core->godot_variant_new_nil(&this->handle);
+	}
+
+	Variant::Variant(Variant const& that) {
+		api_core->godot_variant_new_copy((&this->handle), (&that.handle));
+	}
+
+	Variant::Variant(int64_t value) {
+		api_core->godot_variant_new_int((&this->handle), value);
+	}
+
+	Variant::Variant(String const& value) {
+		api_core->godot_variant_new_string((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(Vector2 const& value) {
+		api_core->godot_variant_new_vector2((&this->handle), reinterpret_cast<godot_vector2 const*>(&value));
+	}
+
+	Variant::Variant(Rect2 const& value) {
+		api_core->godot_variant_new_rect2((&this->handle), reinterpret_cast<godot_rect2 const*>(&value));
+	}
+
+	Variant::Variant(Vector3 const& value) {
+		api_core->godot_variant_new_vector3((&this->handle), reinterpret_cast<godot_vector3 const*>(&value));
+	}
+
+	Variant::Variant(Plane const& value) {
+		api_core->godot_variant_new_plane((&this->handle), reinterpret_cast<godot_plane const*>(&value));
+	}
+
+	Variant::Variant(AABB const& value) {
+		api_core->godot_variant_new_aabb((&this->handle), reinterpret_cast<godot_aabb const*>(&value));
+	}
+
+	Variant::Variant(Quat const& value) {
+		api_core->godot_variant_new_quat((&this->handle), reinterpret_cast<godot_quat const*>(&value));
+	}
+
+	Variant::Variant(Basis const& value) {
+		api_core->godot_variant_new_basis((&this->handle), reinterpret_cast<godot_basis const*>(&value));
+	}
+
+	Variant::Variant(Transform2D const& value) {
+		api_core->godot_variant_new_transform2d((&this->handle), reinterpret_cast<godot_transform2d const*>(&value));
+	}
+
+	Variant::Variant(Transform const& value) {
+		api_core->godot_variant_new_transform((&this->handle), reinterpret_cast<godot_transform const*>(&value));
+	}
+
+	Variant::Variant(Color const& value) {
+		api_core->godot_variant_new_color((&this->handle), reinterpret_cast<godot_color const*>(&value));
+	}
+
+	Variant::Variant(NodePath const& value) {
+		api_core->godot_variant_new_node_path((&this->handle), reinterpret_cast<godot_node_path const*>(&value));
+	}
+
+	Variant::Variant(RID const& value) {
+		api_core->godot_variant_new_rid((&this->handle), reinterpret_cast<godot_rid const*>(&value));
+	}
+
+	Variant::Variant(Object value) {
+		api_core->godot_variant_new_object((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(Dictionary const& value) {
+		api_core->godot_variant_new_dictionary((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(Array const& value) {
+		api_core->godot_variant_new_array((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(PoolByteArray const& value) {
+		api_core->godot_variant_new_pool_byte_array((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(PoolIntArray const& value) {
+		api_core->godot_variant_new_pool_int_array((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(PoolRealArray const& value) {
+		api_core->godot_variant_new_pool_real_array((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(PoolStringArray const& value) {
+		api_core->godot_variant_new_pool_string_array((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(PoolVector2Array const& value) {
+		api_core->godot_variant_new_pool_vector2_array((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(PoolVector3Array const& value) {
+		api_core->godot_variant_new_pool_vector3_array((&this->handle), value.handleof());
+	}
+
+	Variant::Variant(PoolColorArray const& value) {
+		api_core->godot_variant_new_pool_color_array((&this->handle), value.handleof());
+	}
+
+	Variant::~Variant() {
+		api_core->godot_variant_destroy(&this->handle);
+	}
+
+	Variant::Type Variant::type_of() const {
+		return static_cast<Type>(api_core->godot_variant_get_type(&this->handle));
+	}
+
+	Variant Variant::call(String const& method_name, Variant const** args, int const arg_count) {
+		godot_variant_call_error error;
+
+		return Variant(api_core->godot_variant_call(
+			(&this->handle),
+			method_name.handleof(),
+			reinterpret_cast<godot_variant const**>(args),
+			arg_count,
+			(&error)
+		));
+	}
+
+	bool Variant::has_method(String const& method_name) const {
+		return api_core->godot_variant_has_method((&this->handle), method_name.handleof());
+	}
+}
@@ -0,0 +1,73 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	real_t Vector2::angle() const {
+		return std::atan2(this->y, this->x);
+	}
+
+	real_t Vector2::angle_to(Vector2 const& to) const {
+		return std::atan2(this->cross(to), this->dot(to));
+	}
+
+	real_t Vector2::cross(Vector2 const& with) const {
+		return ((this->x * with.y) - (this->y * with.x));
+	}
+
+	Vector2 Vector2::cubic_interpolate(
+		Vector2 const& b,
+		Vector2 const& pre_a,
+		Vector2 const& post_b,
+		real_t t
+	) const {
+		Vector2 const& p0 = pre_a;
+		Vector2 const& p1 = *this;
+		Vector2 const& p2 = b;
+		Vector2 const& p3 = post_b;
+		real_t const t2 = (t * t);
+		real_t const t3 = (t2 * t);
+
+		return ((
+			(p1 * 2.f) +
+			((-p0 + p2) * t) +
+			((((p0 * 2.f) - (p1 * 5.f)) + (p2 * 4.f) - p3) * t2) +
+			((-p0 + (p1 * 3.f) - (p2 * 3.f) + p3) * t3)
+		) * 0.5f);
+	}
+
+	real_t Vector2::dot(Vector2 const& with) const {
+		return ((this->x * with.x) + (this->y * with.y));
+	}
+
+	real_t Vector2::length() const {
+		return std::sqrt(this->length_squared());
+	}
+
+	real_t Vector2::length_squared() const {
+		return ((this->x * this->x) + (this->y * this->y));
+	}
+
+	Vector2 Vector2::linear_interpolate(Vector2 const& b, real_t t) const {
+		return Vector2{(this->x + ((b.x - this->x) * t)), (this->y + ((b.y - this->y) * t))};
+	}
+
+	Vector2 Vector2::normalized() const {
+		real_t const length_squared = this->length_squared();
+
+		if (length_squared == 0) return *this;
+
+		real_t const length = std::sqrt(length_squared);
+
+		return Vector2{(this->x / length), (this->y / length)};
+	}
+
+	Vector2 Vector2::rotated(real_t const phi) const {
+		real_t const sine = std::sin(phi);
+		real_t const cosine = std::cos(phi);
+
+		return Vector2{((this->x * cosine) - (this->y * sine)), ((this->x * sine) + (this->y * cosine))};
+	}
+
+	Vector2 Vector2::slerp(Vector2 const& b, real_t t) const {
+		return this->rotated(this->angle_to(b) * t);
+	}
+}
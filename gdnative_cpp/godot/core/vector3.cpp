@@ -0,0 +1,97 @@
+#include "godot/core.hpp"
+
+namespace godot::core {
+	real_t Vector3::angle_to(Vector3 const& to) const {
+		return std::atan2(this->cross(to).length(), this->dot(to));
+	}
+
+	Vector3 Vector3::cross(Vector3 const& b) const {
+		return Vector3{
+			((this->y * b.z) - (this->z * b.y)),
+			((this->z * b.x) - (this->x * b.z)),
+			((this->x * b.y) - (this->y * b.x))
+		};
+	}
+
+	Vector3 Vector3::cubic_interpolate(
+		Vector3 const& b,
+		Vector3 const& pre_a,
+		Vector3 const& post_b,
+		real_t t
+	) const {
+		Vector3 const& p0 = pre_a;
+		Vector3 const& p1 = *this;
+		Vector3 const& p2 = b;
+		Vector3 const& p3 = post_b;
+		real_t const t2 = (t * t);
+		real_t const t3 = (t2 * t);
+
+		return ((
+			(p1 * 2.f) +
+			((-p0 + p2) * t) +
+			((((p0 * 2.f) - (p1 * 5.f)) + (p2 * 4.f) - p3) * t2) +
+			((-p0 + (p1 * 3.f) - (p2 * 3.f) + p3) * t3)
+		) * 0.5f);
+	}
+
+	real_t Vector3::dot(Vector3 const& b) const {
+		return ((this->x * b.x) + (this->y * b.y) + (this->z * b.z));
+	}
+
+	real_t Vector3::length() const {
+		return std::sqrt((this->x * this->x) + (this->y * this->y) + (this->z * this->z));
+	}
+
+	Vector3 Vector3::linear_interpolate(Vector3 const& b, real_t t) const {
+		return Vector3{
+			(this->x + ((b.x - this->x) * t)),
+			(this->y + ((b.y - this->y) * t)),
+			(this->z + ((b.z - this->z) * t))
+		};
+	}
+
+	Vector3 Vector3::normalized() const {
+		real_t const length = this->length();
+
+		if (length == 0) return Vector3{0, 0, 0};
+
+		return Vector3{(this->x / length), (this->y / length), (this->z / length)};
+	}
+
+	Vector3 Vector3::rotated(Vector3 const& axis, real_t phi) const {
+		// Builds the same axis-angle basis as the engine, including its double-precision diagonal.
+		real_t const cosine = std::cos(phi);
+		real_t const sine = std::sin(phi);
+		real_t const t = (1.f - cosine);
+		Vector3 const squared = Vector3{(axis.x * axis.x), (axis.y * axis.y), (axis.z * axis.z)};
+		real_t const xy = (axis.x * axis.y * t);
+		real_t const xz = (axis.x * axis.z * t);
+		real_t const yz = (axis.y * axis.z * t);
+
+		Basis const basis = Basis{
+			Vector3{
+				static_cast<real_t>(squared.x + (cosine * (1.0 - squared.x))),
+				(xy - (axis.z * sine)),
+				(xz + (axis.y * sine))
+			},
+
+			Vector3{
+				(xy + (axis.z * sine)),
+				static_cast<real_t>(squared.y + (cosine * (1.0 - squared.y))),
+				(yz - (axis.x * sine))
+			},
+
+			Vector3{
+				(xz - (axis.y * sine)),
+				(yz + (axis.x * sine)),
+				static_cast<real_t>(squared.z + (cosine * (1.0 - squared.z)))
+			}
+		};
+
+		return basis.xform(*this);
+	}
+
+	Vector3 Vector3::slerp(Vector3 const& b, real_t t) const {
+		return this->rotated(this->cross(b).normalized(), (this->angle_to(b) * t));
+	}
+}
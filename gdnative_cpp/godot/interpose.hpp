@@ -0,0 +1,62 @@
+#ifndef GODOT_INTERPOSE_H
+#define GODOT_INTERPOSE_H
+
+#include "godot/core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace godot::interpose {
+	/// Opt-in instrumentation of the engine API boundary. `install` swaps `api_core`, `api_core11`,
+	/// `api_core12` and `api_nativescript` for copies of themselves whose functions forward through shims
+	/// that count every call and time every `sample_interval`th one, so the report shows which crossings
+	/// dominate a frame. Functions outside the list in `interpose/interposer.cpp` are forwarded untouched.
+	/// Installing and uninstalling must happen while no other thread is calling into the API.
+
+	/// Bucket `i` of a histogram counts sampled calls that took less than `2^(i + 1)` nanoseconds.
+	static constexpr size_t histogram_buckets = 32;
+
+	struct FunctionStats {
+		char const* name;
+
+		uint64_t calls;
+
+		uint64_t samples;
+
+		uint64_t sampled_nanoseconds;
+
+		uint64_t histogram[histogram_buckets];
+
+		/// Time spent in the function over all calls, extrapolated from the sampled ones.
+		constexpr uint64_t estimated_nanoseconds() const {
+			if (this->samples == 0) return 0;
+
+			return static_cast<uint64_t>(
+				(static_cast<double>(this->sampled_nanoseconds) / this->samples) * this->calls
+			);
+		}
+
+		/// Upper bound of the histogram bucket holding the given fraction of sampled calls.
+		uint64_t percentile_nanoseconds(double fraction) const;
+	};
+
+	/// Rounds `sample_interval` up to a power of two. Installing again only changes the interval.
+	void install(uint32_t sample_interval = 16);
+
+	bool is_installed();
+
+	/// Prints the `limit` functions with the most estimated time through the original print function, so
+	/// the report does not count itself.
+	void print_report(size_t limit = 32);
+
+	void reset();
+
+	/// Stats of every function called at least once since the last reset, most estimated time first.
+	std::vector<FunctionStats> snapshot();
+
+	/// Restores the original tables. Counters are kept until the next `reset`.
+	void uninstall();
+}
+
+#endif
@@ -0,0 +1,430 @@
+#include "godot/interpose.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+namespace godot::interpose {
+#define GODOT_INTERPOSE_POOL(X, NAME) \
+	X(core, godot_pool_##NAME##_array_new) \
+	X(core, godot_pool_##NAME##_array_new_copy) \
+	X(core, godot_pool_##NAME##_array_destroy) \
+	X(core, godot_pool_##NAME##_array_size) \
+	X(core, godot_pool_##NAME##_array_append) \
+	X(core, godot_pool_##NAME##_array_push_back) \
+	X(core, godot_pool_##NAME##_array_resize) \
+	X(core, godot_pool_##NAME##_array_set) \
+	X(core, godot_pool_##NAME##_array_get) \
+	X(core, godot_pool_##NAME##_array_read) \
+	X(core, godot_pool_##NAME##_array_write) \
+	X(core, godot_pool_##NAME##_array_read_access_ptr) \
+	X(core, godot_pool_##NAME##_array_write_access_ptr) \
+	X(core, godot_pool_##NAME##_array_read_access_destroy) \
+	X(core, godot_pool_##NAME##_array_write_access_destroy)
+
+// The functions the wrappers and modules reach on hot paths. Each entry is the table it lives in and its
+// field name, which is also the name it is reported under.
+#define GODOT_INTERPOSE_FUNCTIONS(X) \
+	X(core, godot_object_destroy) \
+	X(core, godot_global_get_singleton) \
+	X(core, godot_method_bind_get_method) \
+	X(core, godot_method_bind_ptrcall) \
+	X(core, godot_method_bind_call) \
+	X(core, godot_get_class_constructor) \
+	X(core, godot_alloc) \
+	X(core, godot_realloc) \
+	X(core, godot_free) \
+	X(core, godot_print_error) \
+	X(core, godot_print_warning) \
+	X(core, godot_print) \
+	X(core, godot_string_new) \
+	X(core, godot_string_new_copy) \
+	X(core, godot_string_new_with_wide_string) \
+	X(core, godot_string_destroy) \
+	X(core, godot_string_empty) \
+	X(core, godot_string_length) \
+	X(core, godot_string_wide_str) \
+	X(core, godot_string_parse_utf8) \
+	X(core, godot_string_parse_utf8_with_len) \
+	X(core, godot_string_chars_to_utf8) \
+	X(core, godot_string_chars_to_utf8_with_len) \
+	X(core, godot_string_utf8) \
+	X(core, godot_char_string_length) \
+	X(core, godot_char_string_get_data) \
+	X(core, godot_char_string_destroy) \
+	X(core, godot_string_operator_equal) \
+	X(core, godot_string_operator_less) \
+	X(core, godot_string_operator_plus) \
+	X(core, godot_variant_new_copy) \
+	X(core, godot_variant_new_nil) \
+	X(core, godot_variant_new_bool) \
+	X(core, godot_variant_new_uint) \
+	X(core, godot_variant_new_int) \
+	X(core, godot_variant_new_real) \
+	X(core, godot_variant_new_string) \
+	X(core, godot_variant_new_vector2) \
+	X(core, godot_variant_new_rect2) \
+	X(core, godot_variant_new_vector3) \
+	X(core, godot_variant_new_transform2d) \
+	X(core, godot_variant_new_plane) \
+	X(core, godot_variant_new_quat) \
+	X(core, godot_variant_new_aabb) \
+	X(core, godot_variant_new_basis) \
+	X(core, godot_variant_new_transform) \
+	X(core, godot_variant_new_color) \
+	X(core, godot_variant_new_node_path) \
+	X(core, godot_variant_new_rid) \
+	X(core, godot_variant_new_object) \
+	X(core, godot_variant_new_dictionary) \
+	X(core, godot_variant_new_array) \
+	X(core, godot_variant_new_pool_byte_array) \
+	X(core, godot_variant_new_pool_int_array) \
+	X(core, godot_variant_new_pool_real_array) \
+	X(core, godot_variant_new_pool_string_array) \
+	X(core, godot_variant_new_pool_vector2_array) \
+	X(core, godot_variant_new_pool_vector3_array) \
+	X(core, godot_variant_new_pool_color_array) \
+	X(core, godot_variant_as_bool) \
+	X(core, godot_variant_as_uint) \
+	X(core, godot_variant_as_int) \
+	X(core, godot_variant_as_real) \
+	X(core, godot_variant_as_string) \
+	X(core, godot_variant_as_vector2) \
+	X(core, godot_variant_as_rect2) \
+	X(core, godot_variant_as_vector3) \
+	X(core, godot_variant_as_transform2d) \
+	X(core, godot_variant_as_plane) \
+	X(core, godot_variant_as_quat) \
+	X(core, godot_variant_as_aabb) \
+	X(core, godot_variant_as_basis) \
+	X(core, godot_variant_as_transform) \
+	X(core, godot_variant_as_color) \
+	X(core, godot_variant_as_node_path) \
+	X(core, godot_variant_as_rid) \
+	X(core, godot_variant_as_object) \
+	X(core, godot_variant_as_dictionary) \
+	X(core, godot_variant_as_array) \
+	X(core, godot_variant_as_pool_byte_array) \
+	X(core, godot_variant_as_pool_int_array) \
+	X(core, godot_variant_as_pool_real_array) \
+	X(core, godot_variant_as_pool_string_array) \
+	X(core, godot_variant_as_pool_vector2_array) \
+	X(core, godot_variant_as_pool_vector3_array) \
+	X(core, godot_variant_as_pool_color_array) \
+	X(core, godot_variant_call) \
+	X(core, godot_variant_has_method) \
+	X(core, godot_variant_get_type) \
+	X(core, godot_variant_destroy) \
+	X(core, godot_variant_operator_equal) \
+	X(core, godot_variant_hash_compare) \
+	X(core, godot_variant_booleanize) \
+	X(core, godot_array_new) \
+	X(core, godot_array_new_copy) \
+	X(core, godot_array_set) \
+	X(core, godot_array_get) \
+	X(core, godot_array_operator_index) \
+	X(core, godot_array_operator_index_const) \
+	X(core, godot_array_append) \
+	X(core, godot_array_push_back) \
+	X(core, godot_array_pop_back) \
+	X(core, godot_array_clear) \
+	X(core, godot_array_empty) \
+	X(core, godot_array_resize) \
+	X(core, godot_array_size) \
+	X(core, godot_array_destroy) \
+	X(core, godot_dictionary_new) \
+	X(core, godot_dictionary_new_copy) \
+	X(core, godot_dictionary_destroy) \
+	X(core, godot_dictionary_size) \
+	X(core, godot_dictionary_empty) \
+	X(core, godot_dictionary_clear) \
+	X(core, godot_dictionary_has) \
+	X(core, godot_dictionary_erase) \
+	X(core, godot_dictionary_keys) \
+	X(core, godot_dictionary_values) \
+	X(core, godot_dictionary_get) \
+	X(core, godot_dictionary_set) \
+	X(core, godot_dictionary_operator_index) \
+	X(core, godot_dictionary_operator_index_const) \
+	X(core, godot_dictionary_next) \
+	X(core, godot_node_path_new) \
+	X(core, godot_node_path_new_copy) \
+	X(core, godot_node_path_destroy) \
+	X(core, godot_node_path_as_string) \
+	X(core, godot_rid_new) \
+	X(core, godot_rid_get_id) \
+	GODOT_INTERPOSE_POOL(X, byte) \
+	GODOT_INTERPOSE_POOL(X, int) \
+	GODOT_INTERPOSE_POOL(X, real) \
+	GODOT_INTERPOSE_POOL(X, string) \
+	GODOT_INTERPOSE_POOL(X, vector2) \
+	GODOT_INTERPOSE_POOL(X, vector3) \
+	GODOT_INTERPOSE_POOL(X, color) \
+	X(core11, godot_object_cast_to) \
+	X(core11, godot_get_class_tag) \
+	X(core11, godot_is_instance_valid) \
+	X(core12, godot_dictionary_duplicate) \
+	X(core12, godot_instance_from_id) \
+	X(nativescript, godot_nativescript_register_class) \
+	X(nativescript, godot_nativescript_register_tool_class) \
+	X(nativescript, godot_nativescript_register_method) \
+	X(nativescript, godot_nativescript_register_property) \
+	X(nativescript, godot_nativescript_register_signal) \
+	X(nativescript, godot_nativescript_get_userdata)
+
+#define GODOT_INTERPOSE_SLOT(TABLE, NAME) TABLE##_##NAME,
+
+	enum Slot : size_t {
+		GODOT_INTERPOSE_FUNCTIONS(GODOT_INTERPOSE_SLOT)
+		slot_count
+	};
+
+#undef GODOT_INTERPOSE_SLOT
+
+#define GODOT_INTERPOSE_NAME(TABLE, NAME) #NAME,
+
+	static char const* const slot_names[slot_count] = {
+		GODOT_INTERPOSE_FUNCTIONS(GODOT_INTERPOSE_NAME)
+	};
+
+#undef GODOT_INTERPOSE_NAME
+
+	// Padded to a cache line each so that threads hammering different functions do not contend.
+	struct alignas(64) Counter {
+		std::atomic<uint64_t> calls;
+
+		std::atomic<uint64_t> samples;
+
+		std::atomic<uint64_t> nanoseconds;
+
+		std::atomic<uint64_t> histogram[histogram_buckets];
+	};
+
+	static Counter counters[slot_count] = {};
+
+	static std::atomic<uint64_t> sample_mask = 15;
+
+	static godot_gdnative_core_api_struct * original_core = nullptr;
+
+	static godot_gdnative_core_1_1_api_struct * original_core11 = nullptr;
+
+	static godot_gdnative_core_1_2_api_struct * original_core12 = nullptr;
+
+	static godot_gdnative_ext_nativescript_api_struct * original_nativescript = nullptr;
+
+	static godot_gdnative_core_api_struct wrapped_core = {};
+
+	static godot_gdnative_core_1_1_api_struct wrapped_core11 = {};
+
+	static godot_gdnative_core_1_2_api_struct wrapped_core12 = {};
+
+	static godot_gdnative_ext_nativescript_api_struct wrapped_nativescript = {};
+
+	static bool installed = false;
+
+	static uint64_t nanoseconds_now() {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count());
+	}
+
+	// Times the call it is scoped around and records it when it goes out of scope, after the forwarded
+	// call has produced its result.
+	class Sample final {
+		Counter * counter;
+
+		uint64_t start;
+
+		public:
+		Sample(Counter& counter) : counter(&counter), start(nanoseconds_now()) { }
+
+		Sample(Sample const& that) = delete;
+
+		~Sample() {
+			uint64_t const elapsed = (nanoseconds_now() - this->start);
+			size_t const bucket = std::min(
+				static_cast<size_t>(std::max<int>(std::bit_width(elapsed), 1) - 1),
+				(histogram_buckets - 1)
+			);
+
+			this->counter->samples.fetch_add(1, std::memory_order_relaxed);
+			this->counter->nanoseconds.fetch_add(elapsed, std::memory_order_relaxed);
+			this->counter->histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+		}
+	};
+
+	template<size_t Index, typename Function> struct Shim;
+
+	template<size_t Index, typename Result, typename... Arguments> struct Shim<Index, Result (*)(Arguments...)> {
+		static inline Result (*original)(Arguments...) = nullptr;
+
+		static Result call(Arguments... arguments) {
+			Counter& counter = counters[Index];
+			uint64_t const call = counter.calls.fetch_add(1, std::memory_order_relaxed);
+
+			if ((call & sample_mask.load(std::memory_order_relaxed)) != 0) return original(arguments...);
+
+			Sample const sample = Sample(counter);
+
+			return original(arguments...);
+		}
+	};
+
+	template<size_t Index, typename Function> static void wrap(Function& entry) {
+		Shim<Index, Function>::original = entry;
+
+		if (entry != nullptr) entry = Shim<Index, Function>::call;
+	}
+
+	// The original core table when installed, so reporting does not show up in its own report.
+	static godot_gdnative_core_api_struct const* reporting_core() {
+		return (installed ? original_core : core::api_core);
+	}
+
+	uint64_t FunctionStats::percentile_nanoseconds(double const fraction) const {
+		if (this->samples == 0) return 0;
+
+		uint64_t const target = std::min(static_cast<uint64_t>(fraction * this->samples), (this->samples - 1));
+		uint64_t seen = 0;
+
+		for (size_t i = 0; i < histogram_buckets; i += 1) {
+			seen += this->histogram[i];
+
+			if (seen > target) return (uint64_t(1) << (i + 1));
+		}
+
+		return 0;
+	}
+
+	void install(uint32_t const sample_interval) {
+		sample_mask.store((std::bit_ceil(std::max(sample_interval, uint32_t(1))) - 1), std::memory_order_relaxed);
+
+		if (installed) return;
+
+		original_core = core::api_core;
+		original_core11 = core::api_core11;
+		original_core12 = core::api_core12;
+		original_nativescript = core::api_nativescript;
+
+		if (original_core != nullptr) wrapped_core = *original_core;
+
+		if (original_core11 != nullptr) wrapped_core11 = *original_core11;
+
+		if (original_core12 != nullptr) wrapped_core12 = *original_core12;
+
+		if (original_nativescript != nullptr) wrapped_nativescript = *original_nativescript;
+
+#define GODOT_INTERPOSE_WRAP(TABLE, NAME) wrap<TABLE##_##NAME>(wrapped_##TABLE.NAME);
+
+		GODOT_INTERPOSE_FUNCTIONS(GODOT_INTERPOSE_WRAP)
+
+#undef GODOT_INTERPOSE_WRAP
+
+		if (original_core != nullptr) core::api_core = (&wrapped_core);
+
+		if (original_core11 != nullptr) core::api_core11 = (&wrapped_core11);
+
+		if (original_core12 != nullptr) core::api_core12 = (&wrapped_core12);
+
+		if (original_nativescript != nullptr) core::api_nativescript = (&wrapped_nativescript);
+
+		installed = true;
+	}
+
+	bool is_installed() {
+		return installed;
+	}
+
+	void print_report(size_t const limit) {
+		godot_gdnative_core_api_struct const* const api = reporting_core();
+
+		if (api == nullptr) return;
+
+		std::vector<FunctionStats> const stats = snapshot();
+		char line[256];
+
+		auto const print_line = [&]() {
+			godot_string message = api->godot_string_chars_to_utf8(line);
+
+			api->godot_print(&message);
+			api->godot_string_destroy(&message);
+		};
+
+		std::snprintf(line, sizeof(line), "%-48s %12s %12s %10s %10s %10s",
+			"function", "calls", "total ms", "mean ns", "p50 ns", "p99 ns");
+
+		print_line();
+
+		for (size_t i = 0; i < std::min(limit, stats.size()); i += 1) {
+			FunctionStats const& function = stats[i];
+
+			std::snprintf(line, sizeof(line), "%-48s %12" PRIu64 " %12.3f %10" PRIu64 " %10" PRIu64 " %10" PRIu64,
+				function.name,
+				function.calls,
+				(function.estimated_nanoseconds() / 1e6),
+				((function.samples == 0) ? 0 : (function.sampled_nanoseconds / function.samples)),
+				function.percentile_nanoseconds(0.5),
+				function.percentile_nanoseconds(0.99));
+
+			print_line();
+		}
+	}
+
+	void reset() {
+		for (Counter& counter : counters) {
+			counter.calls.store(0, std::memory_order_relaxed);
+			counter.samples.store(0, std::memory_order_relaxed);
+			counter.nanoseconds.store(0, std::memory_order_relaxed);
+
+			for (std::atomic<uint64_t>& bucket : counter.histogram) bucket.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	std::vector<FunctionStats> snapshot() {
+		std::vector<FunctionStats> stats = {};
+
+		for (size_t i = 0; i < slot_count; i += 1) {
+			Counter const& counter = counters[i];
+			FunctionStats function = FunctionStats{slot_names[i], 0, 0, 0, {}};
+
+			function.calls = counter.calls.load(std::memory_order_relaxed);
+
+			if (function.calls == 0) continue;
+
+			function.samples = counter.samples.load(std::memory_order_relaxed);
+			function.sampled_nanoseconds = counter.nanoseconds.load(std::memory_order_relaxed);
+
+			for (size_t j = 0; j < histogram_buckets; j += 1) {
+				function.histogram[j] = counter.histogram[j].load(std::memory_order_relaxed);
+			}
+
+			stats.push_back(function);
+		}
+
+		std::sort(stats.begin(), stats.end(), [](FunctionStats const& a, FunctionStats const& b) {
+			return (a.estimated_nanoseconds() > b.estimated_nanoseconds());
+		});
+
+		return stats;
+	}
+
+	void uninstall() {
+		if (!installed) return;
+
+		if (original_core != nullptr) core::api_core = original_core;
+
+		if (original_core11 != nullptr) core::api_core11 = original_core11;
+
+		if (original_core12 != nullptr) core::api_core12 = original_core12;
+
+		if (original_nativescript != nullptr) core::api_nativescript = original_nativescript;
+
+		installed = false;
+	}
+
+#undef GODOT_INTERPOSE_FUNCTIONS
+#undef GODOT_INTERPOSE_POOL
+}
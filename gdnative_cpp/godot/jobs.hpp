@@ -0,0 +1,465 @@
+#ifndef GODOT_JOBS_H
+#define GODOT_JOBS_H
+
+#include "godot/core.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace godot::jobs {
+	struct Range {
+		size_t begin, end;
+
+		static constexpr Range of(size_t const begin, size_t const end) {
+			return Range{begin, end};
+		}
+
+		constexpr size_t size() const {
+			return ((this->end > this->begin) ? (this->end - this->begin) : 0);
+		}
+	};
+
+	/// Accumulated timings for every run of a named job. Counters are updated by whichever thread ran the
+	/// work, so reads from the main thread are only a snapshot.
+	struct JobCounter {
+		char const* name;
+
+		std::atomic<uint64_t> runs;
+
+		std::atomic<uint64_t> tasks;
+
+		std::atomic<uint64_t> busy_nanoseconds;
+
+		std::atomic<uint64_t> wall_nanoseconds;
+
+		std::atomic<uint64_t> max_wall_nanoseconds;
+
+		constexpr JobCounter(char const* name) :
+			name(name),
+			runs(0),
+			tasks(0),
+			busy_nanoseconds(0),
+			wall_nanoseconds(0),
+			max_wall_nanoseconds(0) { }
+
+		void reset();
+	};
+
+	struct TaskGroup {
+		std::atomic<size_t> pending;
+
+		JobCounter * counter;
+	};
+
+	struct Task {
+		void (*function)(void const* context, Range range);
+
+		void const* context;
+
+		Range range;
+
+		TaskGroup * group;
+	};
+
+	class ThreadPool final {
+		struct WorkQueue {
+			std::mutex mutex;
+
+			std::deque<Task> tasks;
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> queues;
+
+		std::vector<std::thread> workers;
+
+		std::atomic<size_t> queued;
+
+		std::atomic<size_t> next_queue;
+
+		std::mutex sleep_mutex;
+
+		std::condition_variable wake;
+
+		bool stopping;
+
+		bool pop_or_steal(size_t home, Task& task);
+
+		void push(size_t queue_index, std::span<Task const> tasks);
+
+		void run_worker(size_t index);
+
+		public:
+		/// Spawns `worker_count` workers, or one fewer than the hardware thread count when zero. The thread
+		/// that waits on work also executes tasks, so a pool of zero workers runs everything inline.
+		ThreadPool(size_t worker_count = 0);
+
+		ThreadPool(ThreadPool const& that) = delete;
+
+		~ThreadPool();
+
+		void execute(Task const& task);
+
+		void run_chunked(
+			Range range,
+			size_t grain,
+			void (*function)(void const* context, Range range),
+			void const* context,
+			JobCounter * counter
+		);
+
+		void submit(std::span<Task const> tasks);
+
+		bool try_run_one();
+
+		void wait(TaskGroup& group);
+
+		constexpr size_t worker_count() const {
+			return this->workers.size();
+		}
+
+		template<typename Function> void parallel_for(
+			Range const range,
+			size_t const grain,
+			Function const& function,
+			JobCounter * counter = nullptr
+		) {
+			this->run_chunked(range, grain, [](void const* context, Range const chunk) {
+				(*static_cast<Function const*>(context))(chunk);
+			}, (&function), counter);
+		}
+
+		template<typename Type, typename Function> void parallel_for(
+			std::span<Type> const elements,
+			size_t const grain,
+			Function const& function,
+			JobCounter * counter = nullptr
+		) {
+			this->parallel_for(Range::of(0, elements.size()), grain, [&](Range const chunk) {
+				function(elements.subspan(chunk.begin, chunk.size()));
+			}, counter);
+		}
+	};
+
+	/// Dependency graph of tasks that is built once and can be run repeatedly. Nodes become runnable when
+	/// all of their predecessors have finished.
+	class TaskGraph final {
+		struct Node {
+			std::function<void()> function;
+
+			std::vector<size_t> successors;
+
+			size_t predecessor_count;
+
+			std::atomic<size_t> remaining;
+
+			TaskGraph * graph;
+		};
+
+		std::deque<Node> nodes;
+
+		ThreadPool * pool;
+
+		TaskGroup group;
+
+		static void run_node(void const* context, Range range);
+
+		public:
+		using NodeId = size_t;
+
+		TaskGraph() = default;
+
+		TaskGraph(TaskGraph const& that) = delete;
+
+		NodeId add(std::function<void()> function);
+
+		void precede(NodeId before, NodeId after);
+
+		void run(ThreadPool& pool, JobCounter * counter = nullptr);
+
+		size_t size() const;
+	};
+
+	/// Move-only, type-erased `void()` callable. Callables small enough to fit in the inline buffer are
+	/// stored without allocating, so workers can post results without touching the heap.
+	class Job final {
+		struct Operations {
+			void (*invoke)(void * storage);
+
+			void (*relocate)(void * from, void * to);
+
+			void (*destroy)(void * storage);
+		};
+
+		static constexpr size_t inline_size = (sizeof(void *) * 6);
+
+		template<typename Function> static constexpr bool fits_inline = (
+			(sizeof(Function) <= inline_size) &&
+			(alignof(Function) <= alignof(std::max_align_t)) &&
+			std::is_nothrow_move_constructible_v<Function>
+		);
+
+		template<typename Function> static constexpr Operations inline_operations = {
+			[](void * storage) {
+				(*std::launder(static_cast<Function *>(storage)))();
+			},
+
+			[](void * from, void * to) {
+				Function * function = std::launder(static_cast<Function *>(from));
+
+				new (to) Function(std::move(*function));
+				function->~Function();
+			},
+
+			[](void * storage) {
+				std::launder(static_cast<Function *>(storage))->~Function();
+			}
+		};
+
+		template<typename Function> static constexpr Operations heap_operations = {
+			[](void * storage) {
+				(**static_cast<Function **>(storage))();
+			},
+
+			[](void * from, void * to) {
+				*static_cast<Function **>(to) = *static_cast<Function **>(from);
+			},
+
+			[](void * storage) {
+				delete *static_cast<Function **>(storage);
+			}
+		};
+
+		alignas(std::max_align_t) unsigned char storage[inline_size];
+
+		Operations const* operations;
+
+		public:
+		constexpr Job() : storage(), operations(nullptr) { }
+
+		template<typename Function, typename = std::enable_if_t<
+			!std::is_same_v<std::decay_t<Function>, Job>
+		>> Job(Function&& function) {
+			using Stored = std::decay_t<Function>;
+
+			if constexpr (fits_inline<Stored>) {
+				new (this->storage) Stored(std::forward<Function>(function));
+
+				this->operations = (&inline_operations<Stored>);
+			} else {
+				*reinterpret_cast<Stored **>(this->storage) = new Stored(std::forward<Function>(function));
+				this->operations = (&heap_operations<Stored>);
+			}
+		}
+
+		Job(Job const& that) = delete;
+
+		Job(Job&& that) noexcept : operations(that.operations) {
+			if (this->operations) {
+				this->operations->relocate(that.storage, this->storage);
+
+				that.operations = nullptr;
+			}
+		}
+
+		~Job() {
+			if (this->operations) this->operations->destroy(this->storage);
+		}
+
+		Job& operator=(Job&& that) noexcept {
+			if (this != (&that)) {
+				if (this->operations) this->operations->destroy(this->storage);
+
+				this->operations = that.operations;
+
+				if (this->operations) {
+					this->operations->relocate(that.storage, this->storage);
+
+					that.operations = nullptr;
+				}
+			}
+
+			return *this;
+		}
+
+		void operator()() {
+			this->operations->invoke(this->storage);
+		}
+
+		constexpr explicit operator bool() const {
+			return (this->operations != nullptr);
+		}
+	};
+
+	/// Bounded lock-free queue for any number of producers and a single consumer. Each slot carries a
+	/// sequence number so producers claim slots with one compare-exchange and never wait on each other.
+	template<typename Type> class MPSCQueue final {
+		struct Slot {
+			std::atomic<size_t> sequence;
+
+			alignas(Type) unsigned char storage[sizeof(Type)];
+		};
+
+		static constexpr size_t cache_line_size = 64;
+
+		std::unique_ptr<Slot[]> slots;
+
+		size_t mask;
+
+		alignas(cache_line_size) std::atomic<size_t> tail;
+
+		alignas(cache_line_size) size_t head;
+
+		public:
+		/// Capacity is rounded up to the next power of two.
+		MPSCQueue(size_t const capacity) : tail(0), head(0) {
+			size_t rounded = 2;
+
+			while (rounded < capacity) rounded <<= 1;
+
+			this->slots = std::make_unique<Slot[]>(rounded);
+			this->mask = (rounded - 1);
+
+			for (size_t i = 0; i < rounded; i += 1) {
+				this->slots[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		MPSCQueue(MPSCQueue const& that) = delete;
+
+		~MPSCQueue() {
+			Type value;
+
+			while (this->try_pop(value));
+		}
+
+		constexpr size_t capacity() const {
+			return (this->mask + 1);
+		}
+
+		/// Consumer only.
+		bool try_pop(Type& value) {
+			Slot& slot = this->slots[(this->head & this->mask)];
+
+			if (slot.sequence.load(std::memory_order_acquire) != (this->head + 1)) return false;
+
+			Type * stored = std::launder(reinterpret_cast<Type *>(slot.storage));
+
+			value = std::move(*stored);
+
+			stored->~Type();
+			slot.sequence.store((this->head + this->mask + 1), std::memory_order_release);
+
+			this->head += 1;
+
+			return true;
+		}
+
+		/// Returns `false` without taking ownership of `value` when the queue is full.
+		bool try_push(Type&& value) {
+			size_t position = this->tail.load(std::memory_order_relaxed);
+
+			while (true) {
+				Slot& slot = this->slots[(position & this->mask)];
+				size_t const sequence = slot.sequence.load(std::memory_order_acquire);
+
+				if (sequence == position) {
+					if (this->tail.compare_exchange_weak(
+						position,
+						(position + 1),
+						std::memory_order_relaxed
+					)) {
+						new (slot.storage) Type(std::move(value));
+						slot.sequence.store((position + 1), std::memory_order_release);
+
+						return true;
+					}
+				} else if (sequence < position) {
+					return false;
+				} else {
+					position = this->tail.load(std::memory_order_relaxed);
+				}
+			}
+		}
+	};
+
+	/// Hands work from worker threads to the main thread, which alone may touch the scene tree.
+	class MainThreadQueue final {
+		MPSCQueue<Job> jobs;
+
+		public:
+		MainThreadQueue(size_t capacity = 4096);
+
+		/// Runs queued jobs on the main thread until the queue is empty or `budget_microseconds` has
+		/// elapsed, whichever comes first. At least one job is run per call so a backlog always drains.
+		/// Intended to be called once per frame from a native class's `_process`.
+		size_t drain(uint64_t budget_microseconds);
+
+		/// Callable from any thread. Returns `false` when the queue is full, leaving `job` with the caller so
+		/// it can be retried or run another way.
+		bool post(Job&& job);
+	};
+
+	/// Starts the shared pool used by the free `parallel_for` functions. Until it is started they run
+	/// inline on the calling thread.
+	void start(size_t worker_count = 0);
+
+	void stop();
+
+	ThreadPool * shared_pool();
+
+	template<typename Function> void parallel_for(
+		Range const range,
+		size_t const grain,
+		Function const& function,
+		JobCounter * counter = nullptr
+	) {
+		ThreadPool * pool = shared_pool();
+
+		if (pool) {
+			pool->parallel_for(range, grain, function, counter);
+		} else if (range.size() != 0) {
+			function(range);
+		}
+	}
+
+	template<typename Type, typename Function> void parallel_for(
+		std::span<Type> const elements,
+		size_t const grain,
+		Function const& function,
+		JobCounter * counter = nullptr
+	) {
+		parallel_for(Range::of(0, elements.size()), grain, [&](Range const chunk) {
+			function(elements.subspan(chunk.begin, chunk.size()));
+		}, counter);
+	}
+
+	template<typename Type, typename Function> void parallel_for(
+		core::PoolArrayWrite<Type> const& elements,
+		size_t const grain,
+		Function const& function,
+		JobCounter * counter = nullptr
+	) {
+		parallel_for(elements.span(), grain, function, counter);
+	}
+
+	template<typename Type, typename Function> void parallel_for(
+		core::PoolArrayRead<Type> const& elements,
+		size_t const grain,
+		Function const& function,
+		JobCounter * counter = nullptr
+	) {
+		parallel_for(elements.span(), grain, function, counter);
+	}
+}
+
+#endif
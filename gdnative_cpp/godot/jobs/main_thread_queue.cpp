@@ -0,0 +1,36 @@
+#include "godot/jobs.hpp"
+#include "godot/profile.hpp"
+
+#include <chrono>
+
+namespace godot::jobs {
+	MainThreadQueue::MainThreadQueue(size_t const capacity) : jobs(capacity) { }
+
+	size_t MainThreadQueue::drain(uint64_t const budget_microseconds) {
+		if (!GD_MAIN_THREAD_ONLY()) return 0;
+
+		GD_PROFILE_SCOPE("MainThreadQueue::drain");
+
+		auto const deadline = (
+			std::chrono::steady_clock::now() + std::chrono::microseconds(budget_microseconds)
+		);
+
+		size_t count = 0;
+		Job job;
+
+		while (this->jobs.try_pop(job)) {
+			job();
+
+			job = Job();
+			count += 1;
+
+			if (std::chrono::steady_clock::now() >= deadline) break;
+		}
+
+		return count;
+	}
+
+	bool MainThreadQueue::post(Job&& job) {
+		return this->jobs.try_push(std::move(job));
+	}
+}
@@ -0,0 +1,81 @@
+#include "godot/jobs.hpp"
+#include "godot/profile.hpp"
+
+#include <chrono>
+
+namespace godot::jobs {
+	TaskGraph::NodeId TaskGraph::add(std::function<void()> function) {
+		Node& node = this->nodes.emplace_back();
+
+		node.function = std::move(function);
+		node.predecessor_count = 0;
+		node.graph = this;
+
+		return (this->nodes.size() - 1);
+	}
+
+	void TaskGraph::precede(NodeId const before, NodeId const after) {
+		this->nodes[before].successors.push_back(after);
+
+		this->nodes[after].predecessor_count += 1;
+	}
+
+	void TaskGraph::run(ThreadPool& pool, JobCounter * counter) {
+		std::vector<Task> roots;
+		auto const start = std::chrono::steady_clock::now();
+
+		GD_PROFILE_SCOPE("TaskGraph::run");
+
+		this->pool = (&pool);
+
+		this->group.pending.store(this->nodes.size(), std::memory_order_relaxed);
+
+		this->group.counter = counter;
+
+		for (Node& node : this->nodes) {
+			node.remaining.store(node.predecessor_count, std::memory_order_relaxed);
+
+			if (node.predecessor_count == 0) {
+				roots.push_back(Task{TaskGraph::run_node, (&node), Range::of(0, 0), (&this->group)});
+			}
+		}
+
+		pool.submit(roots);
+		pool.wait(this->group);
+
+		if (counter) {
+			counter->runs.fetch_add(1, std::memory_order_relaxed);
+
+			counter->wall_nanoseconds.fetch_add(static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - start
+				).count()
+			), std::memory_order_relaxed);
+		}
+	}
+
+	void TaskGraph::run_node(void const* context, Range) {
+		Node * node = const_cast<Node *>(static_cast<Node const*>(context));
+		TaskGraph * graph = node->graph;
+
+		{
+			GD_PROFILE_SCOPE("TaskGraph::run_node");
+
+			node->function();
+		}
+
+		for (size_t const successor_id : node->successors) {
+			Node& successor = graph->nodes[successor_id];
+
+			if (successor.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				Task const task = Task{TaskGraph::run_node, (&successor), Range::of(0, 0), (&graph->group)};
+
+				graph->pool->submit(std::span<Task const>(&task, 1));
+			}
+		}
+	}
+
+	size_t TaskGraph::size() const {
+		return this->nodes.size();
+	}
+}
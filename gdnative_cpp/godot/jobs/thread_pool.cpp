@@ -0,0 +1,271 @@
+#include "godot/jobs.hpp"
+#include "godot/profile.hpp"
+
+#include <chrono>
+#include <string>
+
+namespace godot::jobs {
+	static thread_local ThreadPool * current_pool = nullptr;
+
+	static thread_local size_t current_queue = 0;
+
+	static std::unique_ptr<ThreadPool> shared;
+
+	static uint64_t nanoseconds_now() {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count());
+	}
+
+	static void record_run(JobCounter * counter, uint64_t const wall_nanoseconds) {
+		if (counter) {
+			uint64_t max = counter->max_wall_nanoseconds.load(std::memory_order_relaxed);
+
+			counter->runs.fetch_add(1, std::memory_order_relaxed);
+			counter->wall_nanoseconds.fetch_add(wall_nanoseconds, std::memory_order_relaxed);
+
+			while ((wall_nanoseconds > max) && (!counter->max_wall_nanoseconds.compare_exchange_weak(
+				max,
+				wall_nanoseconds,
+				std::memory_order_relaxed
+			)));
+		}
+	}
+
+	void JobCounter::reset() {
+		this->runs.store(0, std::memory_order_relaxed);
+		this->tasks.store(0, std::memory_order_relaxed);
+		this->busy_nanoseconds.store(0, std::memory_order_relaxed);
+		this->wall_nanoseconds.store(0, std::memory_order_relaxed);
+		this->max_wall_nanoseconds.store(0, std::memory_order_relaxed);
+	}
+
+	ThreadPool::ThreadPool(size_t worker_count) : queued(0), next_queue(0), stopping(false) {
+		if (worker_count == 0) {
+			size_t const hardware_threads = std::thread::hardware_concurrency();
+
+			worker_count = ((hardware_threads > 1) ? (hardware_threads - 1) : 0);
+		}
+
+		// The last queue is shared by every thread that is not one of the workers.
+		for (size_t i = 0; i <= worker_count; i += 1) {
+			this->queues.push_back(std::make_unique<WorkQueue>());
+		}
+
+		for (size_t i = 0; i < worker_count; i += 1) {
+			this->workers.emplace_back(&ThreadPool::run_worker, this, i);
+		}
+	}
+
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(this->sleep_mutex);
+
+			this->stopping = true;
+		}
+
+		this->wake.notify_all();
+
+		for (std::thread& worker : this->workers) worker.join();
+	}
+
+	void ThreadPool::execute(Task const& task) {
+		TaskGroup * group = task.group;
+
+		GD_PROFILE_SCOPE(((group->counter != nullptr) ? group->counter->name : "ThreadPool::execute"));
+
+		if (group->counter) {
+			uint64_t const start = nanoseconds_now();
+
+			task.function(task.context, task.range);
+			group->counter->tasks.fetch_add(1, std::memory_order_relaxed);
+
+			group->counter->busy_nanoseconds.fetch_add(
+				(nanoseconds_now() - start),
+				std::memory_order_relaxed
+			);
+		} else {
+			task.function(task.context, task.range);
+		}
+
+		group->pending.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	bool ThreadPool::pop_or_steal(size_t const home, Task& task) {
+		size_t const queue_count = this->queues.size();
+
+		{
+			WorkQueue& queue = *this->queues[home];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			if (!queue.tasks.empty()) {
+				task = queue.tasks.back();
+
+				queue.tasks.pop_back();
+				this->queued.fetch_sub(1, std::memory_order_relaxed);
+
+				return true;
+			}
+		}
+
+		for (size_t i = 1; i < queue_count; i += 1) {
+			WorkQueue& queue = *this->queues[((home + i) % queue_count)];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			if (!queue.tasks.empty()) {
+				task = queue.tasks.front();
+
+				queue.tasks.pop_front();
+				this->queued.fetch_sub(1, std::memory_order_relaxed);
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void ThreadPool::push(size_t const queue_index, std::span<Task const> const tasks) {
+		// Counted before the tasks are published, so a thief's decrement can never take `queued` below zero.
+		// A worker woken in between finds nothing to pop and goes round again until the insert lands.
+		{
+			std::lock_guard<std::mutex> lock(this->sleep_mutex);
+
+			this->queued.fetch_add(tasks.size(), std::memory_order_relaxed);
+		}
+
+		{
+			WorkQueue& queue = *this->queues[queue_index];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			queue.tasks.insert(queue.tasks.end(), tasks.begin(), tasks.end());
+		}
+
+		if (tasks.size() == 1) {
+			this->wake.notify_one();
+		} else {
+			this->wake.notify_all();
+		}
+	}
+
+	void ThreadPool::run_chunked(
+		Range const range,
+		size_t grain,
+		void (*function)(void const* context, Range range),
+		void const* context,
+		JobCounter * counter
+	) {
+		size_t const count = range.size();
+
+		if (count == 0) return;
+
+		if (grain == 0) grain = 1;
+
+		size_t const chunk_count = ((count + grain - 1) / grain);
+		uint64_t const start = nanoseconds_now();
+
+		GD_PROFILE_SCOPE("ThreadPool::run_chunked");
+
+		if ((chunk_count == 1) || this->workers.empty()) {
+			function(context, range);
+
+			if (counter) {
+				uint64_t const elapsed = (nanoseconds_now() - start);
+
+				counter->tasks.fetch_add(1, std::memory_order_relaxed);
+				counter->busy_nanoseconds.fetch_add(elapsed, std::memory_order_relaxed);
+				record_run(counter, elapsed);
+			}
+
+			return;
+		}
+
+		std::vector<Task> tasks;
+		TaskGroup group;
+
+		group.pending.store(chunk_count, std::memory_order_relaxed);
+
+		group.counter = counter;
+
+		tasks.reserve(chunk_count);
+
+		for (size_t begin = range.begin; begin < range.end; begin += grain) {
+			size_t const end = (((range.end - begin) > grain) ? (begin + grain) : range.end);
+
+			tasks.push_back(Task{function, context, Range::of(begin, end), (&group)});
+		}
+
+		this->submit(tasks);
+		this->wait(group);
+		record_run(counter, (nanoseconds_now() - start));
+	}
+
+	void ThreadPool::run_worker(size_t const index) {
+		current_pool = this;
+		current_queue = index;
+
+		profile::name_thread(("jobs worker " + std::to_string(index)).c_str());
+
+		while (true) {
+			Task task;
+
+			if (this->pop_or_steal(index, task)) {
+				this->execute(task);
+
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(this->sleep_mutex);
+
+			this->wake.wait(lock, [this]() {
+				return (this->stopping || (this->queued.load(std::memory_order_relaxed) != 0));
+			});
+
+			if (this->stopping && (this->queued.load(std::memory_order_relaxed) == 0)) return;
+		}
+	}
+
+	void ThreadPool::submit(std::span<Task const> const tasks) {
+		if (tasks.empty()) return;
+
+		if (current_pool == this) {
+			this->push(current_queue, tasks);
+		} else {
+			this->push(this->workers.size(), tasks);
+		}
+	}
+
+	bool ThreadPool::try_run_one() {
+		Task task;
+
+		if (this->pop_or_steal(((current_pool == this) ? current_queue : this->workers.size()), task)) {
+			this->execute(task);
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void ThreadPool::wait(TaskGroup& group) {
+		// Waiting threads help out instead of blocking, which keeps nested parallel_for calls from
+		// starving the pool.
+		GD_PROFILE_SCOPE("ThreadPool::wait");
+
+		while (group.pending.load(std::memory_order_acquire) != 0) {
+			if (!this->try_run_one()) std::this_thread::yield();
+		}
+	}
+
+	void start(size_t const worker_count) {
+		if (!shared) shared = std::make_unique<ThreadPool>(worker_count);
+	}
+
+	void stop() {
+		shared.reset();
+	}
+
+	ThreadPool * shared_pool() {
+		return shared.get();
+	}
+}
@@ -0,0 +1,84 @@
+#ifndef GODOT_LOGGING_H
+#define GODOT_LOGGING_H
+
+#include "godot/core.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/// Logs a printf-style message from any thread. Nothing is formatted when `LEVEL` is filtered out, and
+/// each call site is rate-limited on its own so one noisy loop cannot flood the output.
+#define GD_LOG(LEVEL, ...) do { \
+		if (::godot::logging::is_enabled(LEVEL)) { \
+			static ::godot::logging::CallSite godot_logging_site = \
+				::godot::logging::CallSite(__FILE__, __LINE__, __func__); \
+			::godot::logging::write(godot_logging_site, LEVEL, __VA_ARGS__); \
+		} \
+	} while (false)
+
+#define GD_LOG_VERBOSE(...) GD_LOG(::godot::logging::Level::VERBOSE, __VA_ARGS__)
+#define GD_LOG_INFO(...) GD_LOG(::godot::logging::Level::INFO, __VA_ARGS__)
+#define GD_LOG_WARNING(...) GD_LOG(::godot::logging::Level::WARNING, __VA_ARGS__)
+#define GD_LOG_ERROR(...) GD_LOG(::godot::logging::Level::ERROR, __VA_ARGS__)
+
+namespace godot::logging {
+	/// Records are formatted on the calling thread and pushed through a lock-free queue, and `flush`
+	/// hands everything queued to the engine from the main thread. Consecutive verbose and info records go
+	/// out as one batched `godot_print`; warnings and errors keep their own engine calls so the editor
+	/// still shows their source location, and the batch before each is printed first to keep the order.
+
+	enum class Level {
+		VERBOSE,
+		INFO,
+		WARNING,
+		ERROR
+	};
+
+	extern std::atomic<Level> minimum_level;
+
+	inline bool is_enabled(Level const level) {
+		return (level >= minimum_level.load(std::memory_order_relaxed));
+	}
+
+	/// Per-call-site state behind `GD_LOG`, counting records in the current one second window.
+	struct CallSite {
+		char const* file;
+
+		int line;
+
+		char const* function;
+
+		std::atomic<uint64_t> window;
+
+		std::atomic<uint32_t> window_count;
+
+		std::atomic<uint32_t> suppressed;
+
+		constexpr CallSite(char const* file, int const line, char const* function) :
+			file(file),
+			line(line),
+			function(function),
+			window(0),
+			window_count(0),
+			suppressed(0) { }
+	};
+
+	/// Records lost because the queue was full since the last flush.
+	uint64_t dropped_records();
+
+	/// Hands queued records to the engine. Main thread only; call once per frame, for example next to
+	/// `MainThreadQueue::drain`. Returns the number of records flushed.
+	size_t flush();
+
+	void set_level(Level level);
+
+	/// Records each call site may log per second before further ones are counted and skipped. Zero lifts
+	/// the limit.
+	void set_rate_limit(uint32_t records_per_second);
+
+	/// Messages longer than fit in a queued record are cut short and end in "...".
+	void write(CallSite& site, Level level, char const* format, ...);
+}
+
+#endif
@@ -0,0 +1,186 @@
+#include "godot/jobs.hpp"
+#include "godot/logging.hpp"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace godot::logging {
+	// Sized so a record stays a few cache lines and moving it through the queue is a plain copy.
+	static constexpr size_t text_capacity = 200;
+
+	struct Record {
+		CallSite const* site;
+
+		Level level;
+
+		uint32_t suppressed;
+
+		uint32_t length;
+
+		char text[text_capacity];
+	};
+
+	std::atomic<Level> minimum_level = Level::INFO;
+
+	static std::atomic<uint32_t> rate_limit = 100;
+
+	static std::atomic<uint64_t> dropped = 0;
+
+	static jobs::MPSCQueue<Record>& queue() {
+		static jobs::MPSCQueue<Record> records = jobs::MPSCQueue<Record>(4096);
+
+		return records;
+	}
+
+	static uint64_t current_second() {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count());
+	}
+
+	// Whoever sees a new window first resets its count; the races around that only let a few extra
+	// records through at the window boundary.
+	static bool admit(CallSite& site) {
+		uint32_t const limit = rate_limit.load(std::memory_order_relaxed);
+
+		if (limit == 0) return true;
+
+		uint64_t const second = current_second();
+		uint64_t window = site.window.load(std::memory_order_relaxed);
+
+		if ((window != second) && site.window.compare_exchange_strong(window, second, std::memory_order_relaxed)) {
+			site.window_count.store(0, std::memory_order_relaxed);
+		}
+
+		if (site.window_count.fetch_add(1, std::memory_order_relaxed) < limit) return true;
+
+		site.suppressed.fetch_add(1, std::memory_order_relaxed);
+
+		return false;
+	}
+
+	static char const* prefix_of(Level const level) {
+		switch (level) {
+			case Level::VERBOSE: return "[verbose] ";
+			case Level::INFO: return "";
+			case Level::WARNING: return "[warning] ";
+			case Level::ERROR: return "[error] ";
+		}
+
+		return "";
+	}
+
+	static void print_batch(std::string const& batch) {
+		godot_string message = core::api_core->godot_string_chars_to_utf8_with_len(
+			batch.data(),
+			static_cast<int>(batch.size())
+		);
+
+		core::api_core->godot_print(&message);
+		core::api_core->godot_string_destroy(&message);
+	}
+
+	uint64_t dropped_records() {
+		return dropped.load(std::memory_order_relaxed);
+	}
+
+	size_t flush() {
+		if (!GD_MAIN_THREAD_ONLY()) return 0;
+
+		// Kept between flushes so a steady stream of output stops allocating after the first frames.
+		static std::string batch;
+
+		jobs::MPSCQueue<Record>& records = queue();
+		uint64_t const lost = dropped.exchange(0, std::memory_order_relaxed);
+		size_t count = 0;
+		Record record;
+
+		batch.clear();
+
+		while (records.try_pop(record)) {
+			std::string_view const text = std::string_view(record.text, record.length);
+			char suffix[48] = "";
+
+			count += 1;
+
+			if (record.suppressed != 0) {
+				std::snprintf(suffix, sizeof(suffix), " (%u similar suppressed)", record.suppressed);
+			}
+
+			if (record.level >= Level::WARNING) {
+				std::string const description = (std::string(text) + suffix);
+				auto const print = ((record.level == Level::ERROR) ?
+					core::api_core->godot_print_error : core::api_core->godot_print_warning);
+
+				// Records logged before this one go out first, so the output keeps the order of logging.
+				if (!batch.empty()) {
+					print_batch(batch);
+					batch.clear();
+				}
+
+				print(description.c_str(), record.site->function, record.site->file, record.site->line);
+
+				continue;
+			}
+
+			if (!batch.empty()) batch += '\n';
+
+			batch += prefix_of(record.level);
+			batch += text;
+			batch += suffix;
+		}
+
+		if (lost != 0) {
+			if (!batch.empty()) batch += '\n';
+
+			batch += "[logging] ";
+			batch += std::to_string(lost);
+			batch += " records dropped because the queue was full";
+		}
+
+		if (!batch.empty()) print_batch(batch);
+
+		return count;
+	}
+
+	void set_level(Level const level) {
+		minimum_level.store(level, std::memory_order_relaxed);
+	}
+
+	void set_rate_limit(uint32_t const records_per_second) {
+		rate_limit.store(records_per_second, std::memory_order_relaxed);
+	}
+
+	void write(CallSite& site, Level const level, char const* format, ...) {
+		if (!admit(site)) return;
+
+		Record record;
+		va_list arguments;
+
+		va_start(arguments, format);
+
+		int const length = std::vsnprintf(record.text, text_capacity, format, arguments);
+
+		va_end(arguments);
+
+		if (length < 0) return;
+
+		if (static_cast<size_t>(length) >= text_capacity) {
+			std::memcpy((record.text + text_capacity - 4), "...", 4);
+
+			record.length = static_cast<uint32_t>(text_capacity - 1);
+		} else {
+			record.length = static_cast<uint32_t>(length);
+		}
+
+		record.site = (&site);
+		record.level = level;
+		record.suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+
+		if (!queue().try_push(std::move(record))) dropped.fetch_add(1, std::memory_order_relaxed);
+	}
+}
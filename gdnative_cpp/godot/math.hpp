@@ -0,0 +1,300 @@
+#ifndef GODOT_MATH_H
+#define GODOT_MATH_H
+
+#include "godot/core.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#endif
+
+namespace godot::math {
+	using core::real_t;
+
+	/// Selects between the engine-exact implementations, which are the member functions of the core types,
+	/// and cheaper approximations for code where throughput matters more than the last few bits.
+	enum class Precision {
+		EXACT,
+		FAST
+	};
+
+	/// Precision used when none is given. Defining `GODOT_FAST_MATH` for a build switches the unqualified
+	/// calls below to the approximations; the member functions stay exact either way.
+#ifdef GODOT_FAST_MATH
+	static constexpr Precision default_precision = Precision::FAST;
+#else
+	static constexpr Precision default_precision = Precision::EXACT;
+#endif
+
+	/// Reciprocal square root from the hardware estimate with one Newton-Raphson step, within 3e-7
+	/// relative error.
+	inline real_t fast_rsqrt(real_t const value) {
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+		real_t const estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+
+		return ((0.5f * estimate) * (3.f - ((value * estimate) * estimate)));
+#else
+		return (1.f / std::sqrt(value));
+#endif
+	}
+
+	// Reduces `angle` by the nearest multiple of pi, returning the remainder in [-pi/2, pi/2] and whether
+	// that multiple was odd. Pi is split in two so the reduction stays accurate for a few hundred radians.
+	inline real_t reduce_half_turn(real_t const angle, bool& odd) {
+		int32_t const turns = static_cast<int32_t>((angle * (1.f / core::PI)) + ((angle < 0) ? -0.5f : 0.5f));
+		real_t const multiple = static_cast<real_t>(turns);
+
+		odd = ((turns & 1) != 0);
+
+		return ((angle - (multiple * 3.140625f)) - (multiple * 9.67653589793e-4f));
+	}
+
+	/// Polynomial sine, within 3e-7 of `std::sin` for |angle| up to a few hundred radians.
+	inline real_t fast_sin(real_t const angle) {
+		bool odd;
+		real_t const r = reduce_half_turn(angle, odd);
+		real_t const r2 = (r * r);
+
+		real_t const sine = (r * (1.f + (r2 * (-1.66666667e-1f + (r2 * (8.33333333e-3f + (r2 * (
+			-1.98412698e-4f + (r2 * (2.75573192e-6f + (r2 * -2.50521084e-8f)))
+		))))))));
+
+		return (odd ? -sine : sine);
+	}
+
+	/// Polynomial cosine, within 2e-7 of `std::cos` for |angle| up to a few hundred radians.
+	inline real_t fast_cos(real_t const angle) {
+		bool odd;
+		real_t const r = reduce_half_turn(angle, odd);
+		real_t const r2 = (r * r);
+
+		real_t const cosine = (1.f + (r2 * (-0.5f + (r2 * (4.16666667e-2f + (r2 * (-1.38888889e-3f + (r2 * (
+			2.48015873e-5f + (r2 * (-2.75573192e-7f + (r2 * 2.08767570e-9f)))
+		)))))))));
+
+		return (odd ? -cosine : cosine);
+	}
+
+	/// Octant-reduced polynomial arctangent, within 2e-6 radians of `std::atan2`.
+	inline real_t fast_atan2(real_t const y, real_t const x) {
+		real_t const ax = std::fabs(x);
+		real_t const ay = std::fabs(y);
+		real_t const large = ((ax < ay) ? ay : ax);
+		real_t const small = ((ax < ay) ? ax : ay);
+		real_t const a = ((large == 0) ? 0 : (small / large));
+		real_t const s = (a * a);
+
+		real_t angle = (a * (0.99997726f + (s * (-0.33262347f + (s * (0.19354346f + (s * (
+			-0.11643287f + (s * (0.05265332f + (s * -0.01172120f)))
+		))))))));
+
+		if (ay > ax) angle = ((core::PI * 0.5f) - angle);
+
+		if (std::signbit(x)) angle = (core::PI - angle);
+
+		return (std::signbit(y) ? -angle : angle);
+	}
+
+	/// Fast lengths are within 3e-7 relative error. Where the hardware square root is as quick as the
+	/// estimate, as on current x86, they are no faster and only exist so callers can switch wholesale.
+	template<Precision precision = default_precision> inline real_t length(core::Vector2 const& v) {
+		if constexpr (precision == Precision::FAST) {
+			real_t const length_squared = ((v.x * v.x) + (v.y * v.y));
+
+			return ((length_squared == 0) ? 0 : (length_squared * fast_rsqrt(length_squared)));
+		} else {
+			return v.length();
+		}
+	}
+
+	template<Precision precision = default_precision> inline real_t length(core::Vector3 const& v) {
+		if constexpr (precision == Precision::FAST) {
+			real_t const length_squared = ((v.x * v.x) + (v.y * v.y) + (v.z * v.z));
+
+			return ((length_squared == 0) ? 0 : (length_squared * fast_rsqrt(length_squared)));
+		} else {
+			return v.length();
+		}
+	}
+
+	template<Precision precision = default_precision> inline real_t length(core::Quat const& q) {
+		if constexpr (precision == Precision::FAST) {
+			real_t const length_squared = q.length_squared();
+
+			return ((length_squared == 0) ? 0 : (length_squared * fast_rsqrt(length_squared)));
+		} else {
+			return q.length();
+		}
+	}
+
+	/// Fast results are within 3e-7 per component of the exact ones.
+	template<Precision precision = default_precision> inline core::Vector2 normalized(core::Vector2 const& v) {
+		if constexpr (precision == Precision::FAST) {
+			real_t const length_squared = ((v.x * v.x) + (v.y * v.y));
+
+			return ((length_squared == 0) ? v : (v * fast_rsqrt(length_squared)));
+		} else {
+			return v.normalized();
+		}
+	}
+
+	template<Precision precision = default_precision> inline core::Vector3 normalized(core::Vector3 const& v) {
+		if constexpr (precision == Precision::FAST) {
+			real_t const length_squared = ((v.x * v.x) + (v.y * v.y) + (v.z * v.z));
+
+			return ((length_squared == 0) ? core::Vector3::zero() : (v * fast_rsqrt(length_squared)));
+		} else {
+			return v.normalized();
+		}
+	}
+
+	template<Precision precision = default_precision> inline core::Quat normalized(core::Quat const& q) {
+		if constexpr (precision == Precision::FAST) {
+			return (q * fast_rsqrt(q.length_squared()));
+		} else {
+			return q.normalized();
+		}
+	}
+
+	/// Fast angles are within 2e-6 radians of the exact ones.
+	template<Precision precision = default_precision> inline real_t angle_to(
+		core::Vector2 const& from,
+		core::Vector2 const& to
+	) {
+		if constexpr (precision == Precision::FAST) {
+			return fast_atan2(
+				((from.x * to.y) - (from.y * to.x)),
+				((from.x * to.x) + (from.y * to.y))
+			);
+		} else {
+			return from.angle_to(to);
+		}
+	}
+
+	template<Precision precision = default_precision> inline real_t angle_to(
+		core::Vector3 const& from,
+		core::Vector3 const& to
+	) {
+		if constexpr (precision == Precision::FAST) {
+			core::Vector3 const cross = core::Vector3{
+				((from.y * to.z) - (from.z * to.y)),
+				((from.z * to.x) - (from.x * to.z)),
+				((from.x * to.y) - (from.y * to.x))
+			};
+
+			return fast_atan2(length<Precision::FAST>(cross), ((from.x * to.x) + (from.y * to.y) + (from.z * to.z)));
+		} else {
+			return from.angle_to(to);
+		}
+	}
+
+	/// Fast results are within 3e-7 per component for unit inputs.
+	template<Precision precision = default_precision> inline core::Vector2 rotated(
+		core::Vector2 const& v,
+		real_t const phi
+	) {
+		if constexpr (precision == Precision::FAST) {
+			real_t const sine = fast_sin(phi);
+			real_t const cosine = fast_cos(phi);
+
+			return core::Vector2{((v.x * cosine) - (v.y * sine)), ((v.x * sine) + (v.y * cosine))};
+		} else {
+			return v.rotated(phi);
+		}
+	}
+
+	/// `axis` must be normalized. The fast version rotates with Rodrigues' formula rather than building a
+	/// basis.
+	template<Precision precision = default_precision> inline core::Vector3 rotated(
+		core::Vector3 const& v,
+		core::Vector3 const& axis,
+		real_t const phi
+	) {
+		if constexpr (precision == Precision::FAST) {
+			real_t const sine = fast_sin(phi);
+			real_t const cosine = fast_cos(phi);
+			real_t const along = (((axis.x * v.x) + (axis.y * v.y) + (axis.z * v.z)) * (1.f - cosine));
+
+			return core::Vector3{
+				((v.x * cosine) + (((axis.y * v.z) - (axis.z * v.y)) * sine) + (axis.x * along)),
+				((v.y * cosine) + (((axis.z * v.x) - (axis.x * v.z)) * sine) + (axis.y * along)),
+				((v.z * cosine) + (((axis.x * v.y) - (axis.y * v.x)) * sine) + (axis.z * along))
+			};
+		} else {
+			return v.rotated(axis, phi);
+		}
+	}
+
+	/// Fast results are within 2e-6 per component for unit inputs.
+	template<Precision precision = default_precision> inline core::Vector2 slerp(
+		core::Vector2 const& from,
+		core::Vector2 const& to,
+		real_t const t
+	) {
+		if constexpr (precision == Precision::FAST) {
+			return rotated<Precision::FAST>(from, (angle_to<Precision::FAST>(from, to) * t));
+		} else {
+			return from.slerp(to, t);
+		}
+	}
+
+	template<Precision precision = default_precision> inline core::Vector3 slerp(
+		core::Vector3 const& from,
+		core::Vector3 const& to,
+		real_t const t
+	) {
+		if constexpr (precision == Precision::FAST) {
+			core::Vector3 const axis = normalized<Precision::FAST>(core::Vector3{
+				((from.y * to.z) - (from.z * to.y)),
+				((from.z * to.x) - (from.x * to.z)),
+				((from.x * to.y) - (from.y * to.x))
+			});
+
+			return rotated<Precision::FAST>(from, axis, (angle_to<Precision::FAST>(from, to) * t));
+		} else {
+			return from.slerp(to, t);
+		}
+	}
+
+	/// Fast results are within 3e-5 per component for unit inputs, the worst case being nearly parallel
+	/// inputs where the sine of the angle is small.
+	template<Precision precision = default_precision> inline core::Quat slerp(
+		core::Quat const& from,
+		core::Quat const& to,
+		real_t const t
+	) {
+		if constexpr (precision == Precision::FAST) {
+			real_t cosom = from.dot(to);
+			core::Quat target = to;
+			real_t scale0, scale1;
+
+			if (cosom < 0) {
+				cosom = -cosom;
+				target = -to;
+			}
+
+			if ((1.f - cosom) > core::CMP_EPSILON) {
+				// The sine of the angle falls out of the cosine, so only the partial angles need a sine.
+				real_t const sine_squared = (1.f - (cosom * cosom));
+				real_t const inverse_sine = fast_rsqrt(sine_squared);
+				real_t const omega = fast_atan2((sine_squared * inverse_sine), cosom);
+
+				scale0 = (fast_sin((1.f - t) * omega) * inverse_sine);
+				scale1 = (fast_sin(t * omega) * inverse_sine);
+			} else {
+				scale0 = (1.f - t);
+				scale1 = t;
+			}
+
+			return core::Quat{
+				((scale0 * from.x) + (scale1 * target.x)),
+				((scale0 * from.y) + (scale1 * target.y)),
+				((scale0 * from.z) + (scale1 * target.z)),
+				((scale0 * from.w) + (scale1 * target.w))
+			};
+		} else {
+			return from.slerp(to, t);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef GODOT_MOCK_H
+#define GODOT_MOCK_H
+
+#include "godot/core.hpp"
+
+#include <string>
+#include <vector>
+
+namespace godot::mock {
+	/// An in-process stand-in for the engine side of the GDNative API, so wrappers, kernels and codecs
+	/// can be benchmarked and exercised headless. Strings, variants, arrays, dictionaries and pool
+	/// arrays are stored inside their opaque handles the way the engine stores them, with the same
+	/// reference counting and copy-on-write, so per-call costs measured against the mock are
+	/// representative of the wrapper rather than of the stand-in. Objects are not modelled: engine
+	/// classes exist only as the method binds, constructors and singletons a caller binds.
+
+	/// Engine-side implementation of a method bind, called through `godot_method_bind_ptrcall` and
+	/// `godot_method_bind_call` respectively. Either may be null if the caller never uses that path.
+	struct MethodBind {
+		void (*ptrcall)(godot_object * object, void const** arguments, void * result);
+
+		godot_variant (*call)(godot_object * object, godot_variant const** arguments, int argument_count);
+	};
+
+	struct ScriptMethod {
+		std::string name;
+
+		godot_instance_method method;
+	};
+
+	/// A class registered through the mock NativeScript table.
+	struct ScriptClass {
+		std::string name;
+
+		std::string base;
+
+		bool tool;
+
+		godot_instance_create_func create;
+
+		godot_instance_destroy_func destroy;
+
+		std::vector<ScriptMethod> methods;
+
+		std::vector<std::string> properties;
+
+		std::vector<std::string> signals;
+	};
+
+	void bind_constructor(char const* class_name, godot_class_constructor constructor);
+
+	void bind_method(char const* class_name, char const* method_name, MethodBind const& bind);
+
+	void bind_singleton(char const* name, godot_object * singleton);
+
+	/// Calls a method registered on `instance`'s script class, returning nil if there is none.
+	godot_variant call(
+		godot_object * instance,
+		char const* method_name,
+		godot_variant ** arguments,
+		int argument_count
+	);
+
+	godot_gdnative_core_api_struct const& core_api();
+
+	/// Runs the destroy function of an instance made by `instantiate` and releases it.
+	void free_instance(godot_object * instance);
+
+	/// Hands the mock tables to `core::gdnative_init` the way the engine would.
+	void install();
+
+	/// Creates an instance of a registered script class through its create function, standing in for
+	/// the engine object it would be attached to.
+	godot_object * instantiate(char const* class_name);
+
+	/// Number of string, container and pool buffers currently allocated, for leak checks.
+	int64_t live_buffers();
+
+	godot_gdnative_ext_nativescript_api_struct const& nativescript_api();
+
+	std::vector<ScriptClass> const& script_classes();
+
+	/// Fill their part of the core table. Used by `core_api`.
+	void install_arrays(godot_gdnative_core_api_struct& api);
+
+	void install_dictionaries(godot_gdnative_core_api_struct& api);
+
+	void install_pool_arrays(godot_gdnative_core_api_struct& api);
+
+	/// Also fills in node paths and RIDs, which the mock keeps as plain text and ids.
+	void install_strings(godot_gdnative_core_api_struct& api);
+
+	void install_variants(godot_gdnative_core_api_struct& api);
+
+	/// Close to the engine's `hash_compare`: strings by content, reals by value with NaN equal to NaN, and
+	/// containers by identity. Used to key dictionaries.
+	bool equal(godot_variant const* a, godot_variant const* b);
+
+	uint32_t hash(godot_variant const* value);
+
+	/// Shared by the buffer types to keep `live_buffers` current.
+	void count_buffer(int64_t change);
+}
+
+#endif
@@ -0,0 +1,317 @@
+#include "godot/mock.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <unordered_set>
+
+namespace godot::mock {
+	// An instance of a script class, standing in for the engine object the script would be attached to.
+	struct Instance {
+		size_t class_index;
+
+		void * userdata;
+	};
+
+	static std::atomic<int64_t> buffer_count = 0;
+
+	static std::map<std::pair<std::string, std::string>, MethodBind> method_binds = {};
+
+	static std::map<std::string, godot_class_constructor> constructors = {};
+
+	static std::map<std::string, godot_object *> singletons = {};
+
+	static std::vector<ScriptClass> classes = {};
+
+	static std::unordered_set<godot_object *> instances = {};
+
+	static std::string utf8_of(godot_string const* string) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		godot_char_string utf8 = api.godot_string_utf8(string);
+		std::string result = std::string(api.godot_char_string_get_data(&utf8), api.godot_char_string_length(&utf8));
+
+		api.godot_char_string_destroy(&utf8);
+
+		return result;
+	}
+
+	static ScriptClass * find_class(char const* name) {
+		for (ScriptClass& script_class : classes) {
+			if (script_class.name == name) return (&script_class);
+		}
+
+		return nullptr;
+	}
+
+	static void object_destroy(godot_object * object) {
+		if (instances.contains(object)) free_instance(object);
+	}
+
+	static godot_object * global_get_singleton(char * name) {
+		auto const singleton = singletons.find(name);
+
+		return ((singleton == singletons.end()) ? nullptr : singleton->second);
+	}
+
+	static godot_method_bind * method_bind_get_method(char const* class_name, char const* method_name) {
+		auto const bind = method_binds.find(std::make_pair(std::string(class_name), std::string(method_name)));
+
+		return ((bind == method_binds.end()) ? nullptr : reinterpret_cast<godot_method_bind *>(&bind->second));
+	}
+
+	static void method_bind_ptrcall(
+		godot_method_bind * bind,
+		godot_object * object,
+		void const** arguments,
+		void * result
+	) {
+		reinterpret_cast<MethodBind *>(bind)->ptrcall(object, arguments, result);
+	}
+
+	static godot_variant method_bind_call(
+		godot_method_bind * bind,
+		godot_object * object,
+		godot_variant const** arguments,
+		int const argument_count,
+		godot_variant_call_error * error
+	) {
+		MethodBind const* const method = reinterpret_cast<MethodBind *>(bind);
+		godot_variant result;
+
+		if (method->call == nullptr) {
+			error->error = GODOT_CALL_ERROR_CALL_ERROR_INVALID_METHOD;
+
+			core_api().godot_variant_new_nil(&result);
+
+			return result;
+		}
+
+		error->error = GODOT_CALL_ERROR_CALL_OK;
+
+		return method->call(object, arguments, argument_count);
+	}
+
+	static godot_class_constructor get_class_constructor(char const* class_name) {
+		auto const constructor = constructors.find(class_name);
+
+		return ((constructor == constructors.end()) ? nullptr : constructor->second);
+	}
+
+	static void * alloc(int const size) {
+		return std::malloc(static_cast<size_t>(size));
+	}
+
+	static void * reallocate(void * pointer, int const size) {
+		return std::realloc(pointer, static_cast<size_t>(size));
+	}
+
+	static void free(void * pointer) {
+		std::free(pointer);
+	}
+
+	static void print_error(char const* description, char const* function, char const* file, int const line) {
+		std::fprintf(stderr, "ERROR: %s: %s\n   At: %s:%d\n", function, description, file, line);
+	}
+
+	static void print_warning(char const* description, char const* function, char const* file, int const line) {
+		std::fprintf(stderr, "WARNING: %s: %s\n   At: %s:%d\n", function, description, file, line);
+	}
+
+	static void print(godot_string const* message) {
+		std::printf("%s\n", utf8_of(message).c_str());
+	}
+
+	static void register_class(
+		void *,
+		char const* name,
+		char const* base,
+		godot_instance_create_func create,
+		godot_instance_destroy_func destroy
+	) {
+		classes.push_back(ScriptClass{name, base, false, create, destroy, {}, {}, {}});
+	}
+
+	static void register_tool_class(
+		void *,
+		char const* name,
+		char const* base,
+		godot_instance_create_func create,
+		godot_instance_destroy_func destroy
+	) {
+		classes.push_back(ScriptClass{name, base, true, create, destroy, {}, {}, {}});
+	}
+
+	static void register_method(
+		void *,
+		char const* class_name,
+		char const* method_name,
+		godot_method_attributes,
+		godot_instance_method method
+	) {
+		ScriptClass * const script_class = find_class(class_name);
+
+		if (script_class != nullptr) script_class->methods.push_back(ScriptMethod{method_name, method});
+	}
+
+	static void register_property(
+		void *,
+		char const* class_name,
+		char const* path,
+		godot_property_attributes *,
+		godot_property_set_func,
+		godot_property_get_func
+	) {
+		ScriptClass * const script_class = find_class(class_name);
+
+		if (script_class != nullptr) script_class->properties.push_back(path);
+	}
+
+	static void register_signal(void *, char const* class_name, godot_signal const* signal) {
+		ScriptClass * const script_class = find_class(class_name);
+
+		if (script_class != nullptr) script_class->signals.push_back(utf8_of(&signal->name));
+	}
+
+	static void * get_userdata(godot_object * instance) {
+		return reinterpret_cast<Instance *>(instance)->userdata;
+	}
+
+	void bind_constructor(char const* class_name, godot_class_constructor constructor) {
+		constructors[class_name] = constructor;
+	}
+
+	void bind_method(char const* class_name, char const* method_name, MethodBind const& bind) {
+		method_binds[std::make_pair(std::string(class_name), std::string(method_name))] = bind;
+	}
+
+	void bind_singleton(char const* name, godot_object * singleton) {
+		singletons[name] = singleton;
+	}
+
+	godot_variant call(
+		godot_object * instance,
+		char const* method_name,
+		godot_variant ** arguments,
+		int const argument_count
+	) {
+		Instance * const data = reinterpret_cast<Instance *>(instance);
+		godot_variant result;
+
+		for (ScriptMethod const& method : classes[data->class_index].methods) {
+			if (method.name == method_name) {
+				return method.method.method(
+					instance,
+					method.method.method_data,
+					data->userdata,
+					argument_count,
+					arguments
+				);
+			}
+		}
+
+		core_api().godot_variant_new_nil(&result);
+
+		return result;
+	}
+
+	godot_gdnative_core_api_struct const& core_api() {
+		static godot_gdnative_core_api_struct const api = []() {
+			static godot_gdnative_api_struct const* extensions[] = {
+				reinterpret_cast<godot_gdnative_api_struct const*>(&nativescript_api())
+			};
+
+			godot_gdnative_core_api_struct api = {};
+
+			api.type = GDNATIVE_CORE;
+			api.version = godot_gdnative_api_version{1, 0};
+			api.num_extensions = 1;
+			api.extensions = extensions;
+			api.godot_object_destroy = object_destroy;
+			api.godot_global_get_singleton = global_get_singleton;
+			api.godot_method_bind_get_method = method_bind_get_method;
+			api.godot_method_bind_ptrcall = method_bind_ptrcall;
+			api.godot_method_bind_call = method_bind_call;
+			api.godot_get_class_constructor = get_class_constructor;
+			api.godot_alloc = alloc;
+			api.godot_realloc = reallocate;
+			api.godot_free = free;
+			api.godot_print_error = print_error;
+			api.godot_print_warning = print_warning;
+			api.godot_print = print;
+
+			install_arrays(api);
+			install_dictionaries(api);
+			install_pool_arrays(api);
+			install_strings(api);
+			install_variants(api);
+
+			return api;
+		}();
+
+		return api;
+	}
+
+	void free_instance(godot_object * instance) {
+		Instance * const data = reinterpret_cast<Instance *>(instance);
+		godot_instance_destroy_func const& destroy = classes[data->class_index].destroy;
+
+		destroy.destroy_func(instance, destroy.method_data, data->userdata);
+		instances.erase(instance);
+
+		delete data;
+	}
+
+	void install() {
+		godot_gdnative_init_options options = {};
+
+		options.api_struct = (&core_api());
+
+		core::gdnative_init(&options);
+	}
+
+	godot_object * instantiate(char const* class_name) {
+		ScriptClass * const script_class = find_class(class_name);
+
+		if (script_class == nullptr) return nullptr;
+
+		Instance * const data = new Instance{static_cast<size_t>(script_class - classes.data()), nullptr};
+		godot_object * const instance = reinterpret_cast<godot_object *>(data);
+
+		data->userdata = script_class->create.create_func(instance, script_class->create.method_data);
+
+		instances.insert(instance);
+
+		return instance;
+	}
+
+	int64_t live_buffers() {
+		return buffer_count.load(std::memory_order_relaxed);
+	}
+
+	godot_gdnative_ext_nativescript_api_struct const& nativescript_api() {
+		static godot_gdnative_ext_nativescript_api_struct const api = []() {
+			godot_gdnative_ext_nativescript_api_struct api = {};
+
+			api.type = GDNATIVE_EXT_NATIVESCRIPT;
+			api.version = godot_gdnative_api_version{1, 0};
+			api.godot_nativescript_register_class = register_class;
+			api.godot_nativescript_register_tool_class = register_tool_class;
+			api.godot_nativescript_register_method = register_method;
+			api.godot_nativescript_register_property = register_property;
+			api.godot_nativescript_register_signal = register_signal;
+			api.godot_nativescript_get_userdata = get_userdata;
+
+			return api;
+		}();
+
+		return api;
+	}
+
+	std::vector<ScriptClass> const& script_classes() {
+		return classes;
+	}
+
+	void count_buffer(int64_t const change) {
+		buffer_count.fetch_add(change, std::memory_order_relaxed);
+	}
+}
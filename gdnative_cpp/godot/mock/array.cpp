@@ -0,0 +1,168 @@
+#include "godot/mock.hpp"
+
+#include <atomic>
+
+namespace godot::mock {
+	// Arrays are shared by reference like the engine's, so copies alias the same elements until the last
+	// handle is destroyed.
+	struct ArrayData {
+		std::atomic<uint32_t> references;
+
+		std::vector<godot_variant> elements;
+
+		ArrayData() : references(1) { }
+	};
+
+	static ArrayData *& data_of(godot_array * array) {
+		return *reinterpret_cast<ArrayData **>(array);
+	}
+
+	static ArrayData * data_of(godot_array const* array) {
+		return *reinterpret_cast<ArrayData * const*>(array);
+	}
+
+	static void destroy_elements(ArrayData * data, size_t const from) {
+		godot_gdnative_core_api_struct const& api = core_api();
+
+		for (size_t i = from; i < data->elements.size(); i += 1) api.godot_variant_destroy(&data->elements[i]);
+	}
+
+	static void create(godot_array * destination) {
+		data_of(destination) = new ArrayData();
+
+		count_buffer(1);
+	}
+
+	static void create_copy(godot_array * destination, godot_array const* source) {
+		ArrayData * const data = data_of(source);
+
+		data->references.fetch_add(1, std::memory_order_relaxed);
+
+		data_of(destination) = data;
+	}
+
+	static void destroy(godot_array * array) {
+		ArrayData * const data = data_of(array);
+
+		if (data->references.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+		destroy_elements(data, 0);
+
+		delete data;
+
+		count_buffer(-1);
+	}
+
+	static godot_int size(godot_array const* array) {
+		return static_cast<godot_int>(data_of(array)->elements.size());
+	}
+
+	static godot_bool empty(godot_array const* array) {
+		return data_of(array)->elements.empty();
+	}
+
+	static void clear(godot_array * array) {
+		ArrayData * const data = data_of(array);
+
+		destroy_elements(data, 0);
+		data->elements.clear();
+	}
+
+	static void resize(godot_array * array, godot_int const size) {
+		ArrayData * const data = data_of(array);
+		size_t const old_size = data->elements.size();
+
+		if (size < 0) return;
+
+		destroy_elements(data, static_cast<size_t>(size));
+		data->elements.resize(static_cast<size_t>(size));
+
+		for (size_t i = old_size; i < data->elements.size(); i += 1) {
+			core_api().godot_variant_new_nil(&data->elements[i]);
+		}
+	}
+
+	static void append(godot_array * array, godot_variant const* value) {
+		ArrayData * const data = data_of(array);
+		godot_variant copy;
+
+		core_api().godot_variant_new_copy((&copy), value);
+		data->elements.push_back(copy);
+	}
+
+	static godot_variant pop_back(godot_array * array) {
+		ArrayData * const data = data_of(array);
+		godot_variant value;
+
+		if (data->elements.empty()) {
+			core_api().godot_variant_new_nil(&value);
+		} else {
+			value = data->elements.back();
+
+			data->elements.pop_back();
+		}
+
+		return value;
+	}
+
+	static godot_variant * operator_index(godot_array * array, godot_int const index) {
+		ArrayData * const data = data_of(array);
+
+		if ((index < 0) || (static_cast<size_t>(index) >= data->elements.size())) {
+			core_api().godot_print_error("Index out of bounds", "godot_array_operator_index", __FILE__, __LINE__);
+
+			return nullptr;
+		}
+
+		return (&data->elements[static_cast<size_t>(index)]);
+	}
+
+	static godot_variant const* operator_index_const(godot_array const* array, godot_int const index) {
+		return operator_index(const_cast<godot_array *>(array), index);
+	}
+
+	static godot_variant get(godot_array const* array, godot_int const index) {
+		godot_variant const* const element = operator_index_const(array, index);
+		godot_variant value;
+
+		if (element == nullptr) {
+			core_api().godot_variant_new_nil(&value);
+		} else {
+			core_api().godot_variant_new_copy((&value), element);
+		}
+
+		return value;
+	}
+
+	static void set(godot_array * array, godot_int const index, godot_variant const* value) {
+		godot_variant * const element = operator_index(array, index);
+		godot_variant copy;
+
+		if (element == nullptr) return;
+
+		// Copied first so that setting an element to itself survives the destroy.
+		core_api().godot_variant_new_copy((&copy), value);
+		core_api().godot_variant_destroy(element);
+
+		*element = copy;
+	}
+
+	void install_arrays(godot_gdnative_core_api_struct& api) {
+		static_assert(sizeof(ArrayData *) <= sizeof(godot_array));
+
+		api.godot_array_new = create;
+		api.godot_array_new_copy = create_copy;
+		api.godot_array_destroy = destroy;
+		api.godot_array_size = size;
+		api.godot_array_empty = empty;
+		api.godot_array_clear = clear;
+		api.godot_array_resize = resize;
+		api.godot_array_append = append;
+		api.godot_array_push_back = append;
+		api.godot_array_pop_back = pop_back;
+		api.godot_array_get = get;
+		api.godot_array_set = set;
+		api.godot_array_operator_index = operator_index;
+		api.godot_array_operator_index_const = operator_index_const;
+	}
+}
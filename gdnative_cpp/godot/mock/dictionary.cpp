@@ -0,0 +1,225 @@
+#include "godot/mock.hpp"
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+namespace godot::mock {
+	// Dictionaries are shared by reference and keep insertion order like the engine's. Entries are boxed so
+	// that pointers from `operator_index` and `next` stay valid while others are added, and erasing
+	// reindexes the whole table, which is fine for the workloads the mock is for.
+	struct Entry {
+		godot_variant key;
+
+		godot_variant value;
+
+		uint32_t hash;
+	};
+
+	struct DictionaryData {
+		std::atomic<uint32_t> references;
+
+		std::vector<std::unique_ptr<Entry>> entries;
+
+		std::unordered_multimap<uint32_t, size_t> lookup;
+
+		DictionaryData() : references(1) { }
+	};
+
+	static constexpr size_t missing = SIZE_MAX;
+
+	static DictionaryData *& data_of(godot_dictionary * dictionary) {
+		return *reinterpret_cast<DictionaryData **>(dictionary);
+	}
+
+	static DictionaryData * data_of(godot_dictionary const* dictionary) {
+		return *reinterpret_cast<DictionaryData * const*>(dictionary);
+	}
+
+	static size_t find(DictionaryData const* data, godot_variant const* key) {
+		auto const [first, last] = data->lookup.equal_range(hash(key));
+
+		for (auto entry = first; entry != last; entry++) {
+			if (equal((&data->entries[entry->second]->key), key)) return entry->second;
+		}
+
+		return missing;
+	}
+
+	static Entry * insert(DictionaryData * data, godot_variant const* key) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+
+		api.godot_variant_new_copy((&entry->key), key);
+		api.godot_variant_new_nil(&entry->value);
+
+		entry->hash = hash(key);
+
+		data->lookup.emplace(entry->hash, data->entries.size());
+		data->entries.push_back(std::move(entry));
+
+		return data->entries.back().get();
+	}
+
+	static void clear_entries(DictionaryData * data) {
+		godot_gdnative_core_api_struct const& api = core_api();
+
+		for (std::unique_ptr<Entry>& entry : data->entries) {
+			api.godot_variant_destroy(&entry->key);
+			api.godot_variant_destroy(&entry->value);
+		}
+
+		data->entries.clear();
+		data->lookup.clear();
+	}
+
+	static void create(godot_dictionary * destination) {
+		data_of(destination) = new DictionaryData();
+
+		count_buffer(1);
+	}
+
+	static void create_copy(godot_dictionary * destination, godot_dictionary const* source) {
+		DictionaryData * const data = data_of(source);
+
+		data->references.fetch_add(1, std::memory_order_relaxed);
+
+		data_of(destination) = data;
+	}
+
+	static void destroy(godot_dictionary * dictionary) {
+		DictionaryData * const data = data_of(dictionary);
+
+		if (data->references.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+		clear_entries(data);
+
+		delete data;
+
+		count_buffer(-1);
+	}
+
+	static godot_int size(godot_dictionary const* dictionary) {
+		return static_cast<godot_int>(data_of(dictionary)->entries.size());
+	}
+
+	static godot_bool empty(godot_dictionary const* dictionary) {
+		return data_of(dictionary)->entries.empty();
+	}
+
+	static void clear(godot_dictionary * dictionary) {
+		clear_entries(data_of(dictionary));
+	}
+
+	static godot_bool has(godot_dictionary const* dictionary, godot_variant const* key) {
+		return (find(data_of(dictionary), key) != missing);
+	}
+
+	static void erase(godot_dictionary * dictionary, godot_variant const* key) {
+		DictionaryData * const data = data_of(dictionary);
+		size_t const index = find(data, key);
+
+		if (index == missing) return;
+
+		core_api().godot_variant_destroy(&data->entries[index]->key);
+		core_api().godot_variant_destroy(&data->entries[index]->value);
+		data->entries.erase(data->entries.begin() + static_cast<ptrdiff_t>(index));
+		data->lookup.clear();
+
+		for (size_t i = 0; i < data->entries.size(); i += 1) data->lookup.emplace(data->entries[i]->hash, i);
+	}
+
+	static godot_variant const* operator_index_const(godot_dictionary const* dictionary, godot_variant const* key) {
+		DictionaryData * const data = data_of(dictionary);
+		size_t const index = find(data, key);
+
+		return ((index == missing) ? nullptr : (&data->entries[index]->value));
+	}
+
+	static godot_variant * operator_index(godot_dictionary * dictionary, godot_variant const* key) {
+		DictionaryData * const data = data_of(dictionary);
+		size_t const index = find(data, key);
+
+		return (&((index == missing) ? insert(data, key) : data->entries[index].get())->value);
+	}
+
+	static godot_variant get(godot_dictionary const* dictionary, godot_variant const* key) {
+		godot_variant const* const value = operator_index_const(dictionary, key);
+		godot_variant result;
+
+		if (value == nullptr) {
+			core_api().godot_print_error("Key not found", "godot_dictionary_get", __FILE__, __LINE__);
+			core_api().godot_variant_new_nil(&result);
+		} else {
+			core_api().godot_variant_new_copy((&result), value);
+		}
+
+		return result;
+	}
+
+	static void set(godot_dictionary * dictionary, godot_variant const* key, godot_variant const* value) {
+		godot_variant * const slot = operator_index(dictionary, key);
+		godot_variant copy;
+
+		core_api().godot_variant_new_copy((&copy), value);
+		core_api().godot_variant_destroy(slot);
+
+		*slot = copy;
+	}
+
+	static godot_variant * next(godot_dictionary const* dictionary, godot_variant const* key) {
+		DictionaryData * const data = data_of(dictionary);
+		size_t const index = ((key == nullptr) ? 0 : (find(data, key) + 1));
+
+		// A missing key wraps `find` round to zero, which the engine would also report as the end.
+		if ((key != nullptr) && (index == 0)) return nullptr;
+
+		return ((index < data->entries.size()) ? (&data->entries[index]->key) : nullptr);
+	}
+
+	static godot_array keys(godot_dictionary const* dictionary) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		godot_array result;
+
+		api.godot_array_new(&result);
+
+		for (std::unique_ptr<Entry> const& entry : data_of(dictionary)->entries) {
+			api.godot_array_append((&result), (&entry->key));
+		}
+
+		return result;
+	}
+
+	static godot_array values(godot_dictionary const* dictionary) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		godot_array result;
+
+		api.godot_array_new(&result);
+
+		for (std::unique_ptr<Entry> const& entry : data_of(dictionary)->entries) {
+			api.godot_array_append((&result), (&entry->value));
+		}
+
+		return result;
+	}
+
+	void install_dictionaries(godot_gdnative_core_api_struct& api) {
+		static_assert(sizeof(DictionaryData *) <= sizeof(godot_dictionary));
+
+		api.godot_dictionary_new = create;
+		api.godot_dictionary_new_copy = create_copy;
+		api.godot_dictionary_destroy = destroy;
+		api.godot_dictionary_size = size;
+		api.godot_dictionary_empty = empty;
+		api.godot_dictionary_clear = clear;
+		api.godot_dictionary_has = has;
+		api.godot_dictionary_erase = erase;
+		api.godot_dictionary_get = get;
+		api.godot_dictionary_set = set;
+		api.godot_dictionary_operator_index = operator_index;
+		api.godot_dictionary_operator_index_const = operator_index_const;
+		api.godot_dictionary_next = next;
+		api.godot_dictionary_keys = keys;
+		api.godot_dictionary_values = values;
+	}
+}
@@ -0,0 +1,246 @@
+#include "godot/mock.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+namespace godot::mock {
+	// Pool arrays are copy-on-write like the engine's: copies share one buffer until either side writes or
+	// resizes, and the empty array holds no buffer at all. As in the engine, read and write accesses only
+	// point into the buffer, so they must not outlive the array.
+	template<typename Element> struct PoolData {
+		std::atomic<uint32_t> references;
+
+		std::vector<Element> elements;
+
+		PoolData() : references(1) { }
+	};
+
+	template<typename Element> struct PoolAccess {
+		Element * pointer;
+	};
+
+	template<typename Element> static void copy_element(Element& destination, Element const& source) {
+		if constexpr (std::is_same_v<Element, godot_string>) {
+			core_api().godot_string_new_copy((&destination), (&source));
+		} else {
+			destination = source;
+		}
+	}
+
+	template<typename Handle, typename Element, typename Argument> struct Pool {
+		using Data = PoolData<Element>;
+
+		static Data *& data_of(Handle * pool) {
+			return *reinterpret_cast<Data **>(pool);
+		}
+
+		static Data * data_of(Handle const* pool) {
+			return *reinterpret_cast<Data * const*>(pool);
+		}
+
+		static Element element_of(Argument const argument) {
+			if constexpr (std::is_pointer_v<Argument>) {
+				return *argument;
+			} else {
+				return argument;
+			}
+		}
+
+		static void release(Data * data) {
+			if ((data == nullptr) || (data->references.fetch_sub(1, std::memory_order_acq_rel) != 1)) return;
+
+			if constexpr (std::is_same_v<Element, godot_string>) {
+				for (godot_string& string : data->elements) core_api().godot_string_destroy(&string);
+			}
+
+			delete data;
+
+			count_buffer(-1);
+		}
+
+		// The buffer of `pool`, made unique to it first so it can be written.
+		static Data * own(Handle * pool) {
+			Data * const data = data_of(pool);
+
+			if ((data != nullptr) && (data->references.load(std::memory_order_acquire) == 1)) return data;
+
+			Data * const copy = new Data();
+
+			count_buffer(1);
+
+			if (data != nullptr) {
+				copy->elements.resize(data->elements.size());
+
+				for (size_t i = 0; i < data->elements.size(); i += 1) {
+					copy_element(copy->elements[i], data->elements[i]);
+				}
+
+				release(data);
+			}
+
+			data_of(pool) = copy;
+
+			return copy;
+		}
+
+		static void create(Handle * destination) {
+			data_of(destination) = nullptr;
+		}
+
+		static void create_copy(Handle * destination, Handle const* source) {
+			Data * const data = data_of(source);
+
+			if (data != nullptr) data->references.fetch_add(1, std::memory_order_relaxed);
+
+			data_of(destination) = data;
+		}
+
+		static void destroy(Handle * pool) {
+			release(data_of(pool));
+		}
+
+		static godot_int size(Handle const* pool) {
+			Data * const data = data_of(pool);
+
+			return ((data == nullptr) ? 0 : static_cast<godot_int>(data->elements.size()));
+		}
+
+		static void append(Handle * pool, Argument const argument) {
+			Data * const data = own(pool);
+
+			data->elements.emplace_back();
+			copy_element(data->elements.back(), element_of(argument));
+		}
+
+		static void resize(Handle * pool, godot_int const size) {
+			if (size <= 0) {
+				release(data_of(pool));
+
+				data_of(pool) = nullptr;
+
+				return;
+			}
+
+			Data * const data = own(pool);
+			size_t const old_size = data->elements.size();
+
+			if constexpr (std::is_same_v<Element, godot_string>) {
+				for (size_t i = static_cast<size_t>(size); i < old_size; i += 1) {
+					core_api().godot_string_destroy(&data->elements[i]);
+				}
+			}
+
+			data->elements.resize(static_cast<size_t>(size));
+
+			if constexpr (std::is_same_v<Element, godot_string>) {
+				for (size_t i = old_size; i < data->elements.size(); i += 1) {
+					core_api().godot_string_new(&data->elements[i]);
+				}
+			}
+		}
+
+		static bool in_bounds(Handle const* pool, godot_int const index, char const* function) {
+			if ((index >= 0) && (index < size(pool))) return true;
+
+			core_api().godot_print_error("Index out of bounds", function, __FILE__, __LINE__);
+
+			return false;
+		}
+
+		static void set(Handle * pool, godot_int const index, Argument const argument) {
+			if (!in_bounds(pool, index, "godot_pool_array_set")) return;
+
+			Element& element = own(pool)->elements[static_cast<size_t>(index)];
+			Element copy;
+
+			copy_element(copy, element_of(argument));
+
+			if constexpr (std::is_same_v<Element, godot_string>) core_api().godot_string_destroy(&element);
+
+			element = copy;
+		}
+
+		static Element get(Handle const* pool, godot_int const index) {
+			Element element = Element{};
+
+			if (in_bounds(pool, index, "godot_pool_array_get")) {
+				copy_element(element, data_of(pool)->elements[static_cast<size_t>(index)]);
+			} else if constexpr (std::is_same_v<Element, godot_string>) {
+				core_api().godot_string_new(&element);
+			}
+
+			return element;
+		}
+
+		static godot_pool_array_read_access * read(Handle const* pool) {
+			Data * const data = data_of(pool);
+
+			count_buffer(1);
+
+			return reinterpret_cast<godot_pool_array_read_access *>(new PoolAccess<Element>{
+				((data == nullptr) ? nullptr : data->elements.data())
+			});
+		}
+
+		static godot_pool_array_write_access * write(Handle * pool) {
+			Data * const data = ((data_of(pool) == nullptr) ? nullptr : own(pool));
+
+			count_buffer(1);
+
+			return reinterpret_cast<godot_pool_array_write_access *>(new PoolAccess<Element>{
+				((data == nullptr) ? nullptr : data->elements.data())
+			});
+		}
+
+		static Element const* read_access_ptr(godot_pool_array_read_access const* access) {
+			return reinterpret_cast<PoolAccess<Element> const*>(access)->pointer;
+		}
+
+		static Element * write_access_ptr(godot_pool_array_write_access const* access) {
+			return reinterpret_cast<PoolAccess<Element> const*>(access)->pointer;
+		}
+
+		static void read_access_destroy(godot_pool_array_read_access * access) {
+			delete reinterpret_cast<PoolAccess<Element> *>(access);
+
+			count_buffer(-1);
+		}
+
+		static void write_access_destroy(godot_pool_array_write_access * access) {
+			delete reinterpret_cast<PoolAccess<Element> *>(access);
+
+			count_buffer(-1);
+		}
+	};
+
+#define GODOT_MOCK_POOL(NAME, ELEMENT, ARGUMENT) { \
+		using Functions = Pool<godot_pool_##NAME##_array, ELEMENT, ARGUMENT>; \
+		api.godot_pool_##NAME##_array_new = Functions::create; \
+		api.godot_pool_##NAME##_array_new_copy = Functions::create_copy; \
+		api.godot_pool_##NAME##_array_destroy = Functions::destroy; \
+		api.godot_pool_##NAME##_array_size = Functions::size; \
+		api.godot_pool_##NAME##_array_append = Functions::append; \
+		api.godot_pool_##NAME##_array_push_back = Functions::append; \
+		api.godot_pool_##NAME##_array_resize = Functions::resize; \
+		api.godot_pool_##NAME##_array_set = Functions::set; \
+		api.godot_pool_##NAME##_array_get = Functions::get; \
+		api.godot_pool_##NAME##_array_read = Functions::read; \
+		api.godot_pool_##NAME##_array_write = Functions::write; \
+		api.godot_pool_##NAME##_array_read_access_ptr = Functions::read_access_ptr; \
+		api.godot_pool_##NAME##_array_write_access_ptr = Functions::write_access_ptr; \
+		api.godot_pool_##NAME##_array_read_access_destroy = Functions::read_access_destroy; \
+		api.godot_pool_##NAME##_array_write_access_destroy = Functions::write_access_destroy; \
+	}
+
+	void install_pool_arrays(godot_gdnative_core_api_struct& api) {
+		GODOT_MOCK_POOL(byte, uint8_t, uint8_t)
+		GODOT_MOCK_POOL(int, godot_int, godot_int)
+		GODOT_MOCK_POOL(real, godot_real, godot_real)
+		GODOT_MOCK_POOL(string, godot_string, godot_string const*)
+		GODOT_MOCK_POOL(vector2, godot_vector2, godot_vector2 const*)
+		GODOT_MOCK_POOL(vector3, godot_vector3, godot_vector3 const*)
+		GODOT_MOCK_POOL(color, godot_color, godot_color const*)
+	}
+
+#undef GODOT_MOCK_POOL
+}
@@ -0,0 +1,428 @@
+#include "godot/mock.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <cwchar>
+#include <new>
+
+namespace godot::mock {
+	// Laid out like the engine's copy-on-write string data: a reference count and length ahead of the
+	// NUL-terminated characters, with the empty string held as a null pointer.
+	template<typename Character> struct Buffer {
+		std::atomic<uint32_t> references;
+
+		int length;
+
+		Buffer(int const length) : references(1), length(length) { }
+	};
+
+	using StringBuffer = Buffer<wchar_t>;
+
+	using CharBuffer = Buffer<char>;
+
+	static constexpr char32_t replacement_character = 0xFFFD;
+
+	template<typename Character> static Character * characters_of(Buffer<Character> * buffer) {
+		return reinterpret_cast<Character *>(buffer + 1);
+	}
+
+	template<typename Character> static Buffer<Character> * allocate(int const length) {
+		if (length == 0) return nullptr;
+
+		void * const memory = std::malloc(sizeof(Buffer<Character>) + ((length + 1) * sizeof(Character)));
+		Buffer<Character> * const buffer = new (memory) Buffer<Character>(length);
+
+		characters_of(buffer)[length] = 0;
+
+		count_buffer(1);
+
+		return buffer;
+	}
+
+	template<typename Character> static Buffer<Character> * retain(Buffer<Character> * buffer) {
+		if (buffer != nullptr) buffer->references.fetch_add(1, std::memory_order_relaxed);
+
+		return buffer;
+	}
+
+	template<typename Character> static void release(Buffer<Character> * buffer) {
+		if ((buffer == nullptr) || (buffer->references.fetch_sub(1, std::memory_order_acq_rel) != 1)) return;
+
+		buffer->~Buffer<Character>();
+
+		std::free(buffer);
+		count_buffer(-1);
+	}
+
+	static StringBuffer *& buffer_of(godot_string * string) {
+		return *reinterpret_cast<StringBuffer **>(string);
+	}
+
+	static StringBuffer * buffer_of(godot_string const* string) {
+		return *reinterpret_cast<StringBuffer * const*>(string);
+	}
+
+	static CharBuffer *& buffer_of(godot_char_string * string) {
+		return *reinterpret_cast<CharBuffer **>(string);
+	}
+
+	static CharBuffer * buffer_of(godot_char_string const* string) {
+		return *reinterpret_cast<CharBuffer * const*>(string);
+	}
+
+	static int length_of(godot_string const* string) {
+		StringBuffer * const buffer = buffer_of(string);
+
+		return ((buffer == nullptr) ? 0 : buffer->length);
+	}
+
+	static wchar_t const* wide_of(godot_string const* string) {
+		StringBuffer * const buffer = buffer_of(string);
+
+		return ((buffer == nullptr) ? L"" : characters_of(buffer));
+	}
+
+	// Writes `code_point` as one or two wide characters, depending on the width of `wchar_t`, returning
+	// how many were needed. Only counts when `out` is null.
+	static int put_wide(wchar_t * out, char32_t const code_point) {
+		if constexpr (sizeof(wchar_t) == 2) {
+			if (code_point >= 0x10000) {
+				if (out != nullptr) {
+					out[0] = static_cast<wchar_t>(0xD800 + ((code_point - 0x10000) >> 10));
+					out[1] = static_cast<wchar_t>(0xDC00 + ((code_point - 0x10000) & 0x3FF));
+				}
+
+				return 2;
+			}
+		}
+
+		if (out != nullptr) out[0] = static_cast<wchar_t>(code_point);
+
+		return 1;
+	}
+
+	// Decodes UTF-8 into `out`, or only counts the wide characters needed when it is null. Malformed
+	// sequences become U+FFFD and set `invalid`.
+	static int decode_utf8(char const* text, int const size, wchar_t * out, bool& invalid) {
+		uint8_t const* bytes = reinterpret_cast<uint8_t const*>(text);
+		uint8_t const* const end = (bytes + size);
+		int count = 0;
+
+		invalid = false;
+
+		while (bytes != end) {
+			uint8_t const lead = *bytes;
+			int const trailing = (
+				(lead < 0x80) ? 0 :
+				(lead < 0xC2) ? -1 :
+				(lead < 0xE0) ? 1 :
+				(lead < 0xF0) ? 2 :
+				(lead < 0xF5) ? 3 : -1
+			);
+			char32_t code_point = replacement_character;
+
+			bytes += 1;
+
+			if (trailing == 0) {
+				code_point = lead;
+			} else if ((trailing > 0) && ((end - bytes) >= trailing)) {
+				code_point = (lead & (0x3F >> trailing));
+
+				for (int i = 0; i < trailing; i += 1) {
+					if ((bytes[i] & 0xC0) != 0x80) {
+						code_point = replacement_character;
+
+						break;
+					}
+
+					code_point = ((code_point << 6) | (bytes[i] & 0x3F));
+				}
+
+				if (code_point != replacement_character) {
+					bytes += trailing;
+
+					// Overlong forms, surrogates and values past Unicode are as malformed as bad bytes.
+					if (
+						((trailing == 2) && (code_point < 0x800)) ||
+						((trailing == 3) && ((code_point < 0x10000) || (code_point > 0x10FFFF))) ||
+						((code_point >= 0xD800) && (code_point < 0xE000))
+					) {
+						code_point = replacement_character;
+					}
+				}
+			}
+
+			if (code_point == replacement_character) invalid = true;
+
+			count += put_wide(((out == nullptr) ? nullptr : (out + count)), code_point);
+		}
+
+		return count;
+	}
+
+	static StringBuffer * parse(char const* text, int const size, bool& invalid) {
+		StringBuffer * const buffer = allocate<wchar_t>(decode_utf8(text, size, nullptr, invalid));
+
+		if (buffer != nullptr) decode_utf8(text, size, characters_of(buffer), invalid);
+
+		return buffer;
+	}
+
+	static void create(godot_string * destination) {
+		buffer_of(destination) = nullptr;
+	}
+
+	static void create_copy(godot_string * destination, godot_string const* source) {
+		buffer_of(destination) = retain(buffer_of(source));
+	}
+
+	static void create_with_wide_string(godot_string * destination, wchar_t const* contents, int const size) {
+		int const length = ((size < 0) ? static_cast<int>(std::wcslen(contents)) : size);
+
+		buffer_of(destination) = allocate<wchar_t>(length);
+
+		if (length != 0) std::memcpy(characters_of(buffer_of(destination)), contents, (length * sizeof(wchar_t)));
+	}
+
+	static void destroy(godot_string * string) {
+		release(buffer_of(string));
+	}
+
+	static godot_int length(godot_string const* string) {
+		return length_of(string);
+	}
+
+	static godot_bool empty(godot_string const* string) {
+		return (buffer_of(string) == nullptr);
+	}
+
+	static wchar_t const* wide_str(godot_string const* string) {
+		return wide_of(string);
+	}
+
+	static godot_bool parse_utf8_with_len(godot_string * string, char const* text, godot_int const size) {
+		bool invalid;
+		StringBuffer * const buffer = parse(text, size, invalid);
+
+		release(buffer_of(string));
+
+		buffer_of(string) = buffer;
+
+		return invalid;
+	}
+
+	static godot_bool parse_utf8(godot_string * string, char const* text) {
+		return parse_utf8_with_len(string, text, static_cast<godot_int>(std::strlen(text)));
+	}
+
+	static godot_string chars_to_utf8_with_len(char const* text, godot_int const size) {
+		godot_string string;
+		bool invalid;
+
+		buffer_of(&string) = parse(text, size, invalid);
+
+		return string;
+	}
+
+	static godot_string chars_to_utf8(char const* text) {
+		return chars_to_utf8_with_len(text, static_cast<godot_int>(std::strlen(text)));
+	}
+
+	static godot_char_string utf8(godot_string const* string) {
+		wchar_t const* const wide = wide_of(string);
+		int const length = length_of(string);
+		int size = 0;
+
+		auto const code_point_at = [&](int& index) -> char32_t {
+			char32_t code_point = static_cast<char32_t>(wide[index]);
+
+			index += 1;
+
+			if constexpr (sizeof(wchar_t) == 2) {
+				if (
+					(code_point >= 0xD800) &&
+					(code_point < 0xDC00) &&
+					(index < length) &&
+					(wide[index] >= 0xDC00) &&
+					(wide[index] < 0xE000)
+				) {
+					char32_t const low = static_cast<char32_t>(wide[index]);
+
+					code_point = (0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00));
+					index += 1;
+				}
+			}
+
+			return code_point;
+		};
+
+		for (int i = 0; i < length;) {
+			char32_t const code_point = code_point_at(i);
+
+			size += ((code_point < 0x80) ? 1 : (code_point < 0x800) ? 2 : (code_point < 0x10000) ? 3 : 4);
+		}
+
+		godot_char_string result;
+		CharBuffer * const buffer = allocate<char>(size);
+		uint8_t * out = ((buffer == nullptr) ? nullptr : reinterpret_cast<uint8_t *>(characters_of(buffer)));
+
+		for (int i = 0; i < length;) {
+			char32_t const code_point = code_point_at(i);
+
+			if (code_point < 0x80) {
+				*(out++) = static_cast<uint8_t>(code_point);
+			} else if (code_point < 0x800) {
+				*(out++) = static_cast<uint8_t>(0xC0 | (code_point >> 6));
+				*(out++) = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+			} else if (code_point < 0x10000) {
+				*(out++) = static_cast<uint8_t>(0xE0 | (code_point >> 12));
+				*(out++) = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+				*(out++) = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+			} else {
+				*(out++) = static_cast<uint8_t>(0xF0 | (code_point >> 18));
+				*(out++) = static_cast<uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+				*(out++) = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+				*(out++) = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+			}
+		}
+
+		buffer_of(&result) = buffer;
+
+		return result;
+	}
+
+	static godot_int char_string_length(godot_char_string const* string) {
+		CharBuffer * const buffer = buffer_of(string);
+
+		return ((buffer == nullptr) ? 0 : buffer->length);
+	}
+
+	static char const* char_string_get_data(godot_char_string const* string) {
+		CharBuffer * const buffer = buffer_of(string);
+
+		return ((buffer == nullptr) ? "" : characters_of(buffer));
+	}
+
+	static void char_string_destroy(godot_char_string * string) {
+		release(buffer_of(string));
+	}
+
+	static godot_bool operator_equal(godot_string const* a, godot_string const* b) {
+		return (
+			(length_of(a) == length_of(b)) &&
+			(std::wmemcmp(wide_of(a), wide_of(b), static_cast<size_t>(length_of(a))) == 0)
+		);
+	}
+
+	static godot_bool operator_less(godot_string const* a, godot_string const* b) {
+		return (std::wcscmp(wide_of(a), wide_of(b)) < 0);
+	}
+
+	static godot_string operator_plus(godot_string const* a, godot_string const* b) {
+		godot_string result;
+		int const length_a = length_of(a);
+		int const length_b = length_of(b);
+		StringBuffer * const buffer = allocate<wchar_t>(length_a + length_b);
+
+		if (buffer != nullptr) {
+			std::memcpy(characters_of(buffer), wide_of(a), (length_a * sizeof(wchar_t)));
+			std::memcpy((characters_of(buffer) + length_a), wide_of(b), (length_b * sizeof(wchar_t)));
+		}
+
+		buffer_of(&result) = buffer;
+
+		return result;
+	}
+
+	// Node paths keep only their text, which covers what the mock is asked of them.
+	static godot_string& path_of(godot_node_path * path) {
+		return *reinterpret_cast<godot_string *>(path);
+	}
+
+	static godot_string const& path_of(godot_node_path const* path) {
+		return *reinterpret_cast<godot_string const*>(path);
+	}
+
+	static void node_path_create(godot_node_path * destination, godot_string const* from) {
+		create_copy((&path_of(destination)), from);
+	}
+
+	static void node_path_create_copy(godot_node_path * destination, godot_node_path const* source) {
+		create_copy((&path_of(destination)), (&path_of(source)));
+	}
+
+	static void node_path_destroy(godot_node_path * path) {
+		destroy(&path_of(path));
+	}
+
+	static godot_string node_path_as_string(godot_node_path const* path) {
+		godot_string string;
+
+		create_copy((&string), (&path_of(path)));
+
+		return string;
+	}
+
+	static godot_bool node_path_is_absolute(godot_node_path const* path) {
+		return (wide_of(&path_of(path))[0] == L'/');
+	}
+
+	static godot_bool node_path_is_empty(godot_node_path const* path) {
+		return (length_of(&path_of(path)) == 0);
+	}
+
+	static godot_int node_path_get_name_count(godot_node_path const* path) {
+		wchar_t const* character = wide_of(&path_of(path));
+		godot_int count = 0;
+
+		for (wchar_t previous = L'/'; (*character != L'\0') && (*character != L':'); character += 1) {
+			if ((previous == L'/') && (*character != L'/')) count += 1;
+
+			previous = *character;
+		}
+
+		return count;
+	}
+
+	static void rid_create(godot_rid * destination) {
+		*destination = godot_rid{};
+	}
+
+	static godot_int rid_get_id(godot_rid const* rid) {
+		return static_cast<godot_int>(*reinterpret_cast<uintptr_t const*>(rid));
+	}
+
+	void install_strings(godot_gdnative_core_api_struct& api) {
+		static_assert(sizeof(StringBuffer *) <= sizeof(godot_string));
+		static_assert(sizeof(CharBuffer *) <= sizeof(godot_char_string));
+		static_assert(sizeof(godot_string) <= sizeof(godot_node_path));
+
+		api.godot_string_new = create;
+		api.godot_string_new_copy = create_copy;
+		api.godot_string_new_with_wide_string = create_with_wide_string;
+		api.godot_string_destroy = destroy;
+		api.godot_string_length = length;
+		api.godot_string_empty = empty;
+		api.godot_string_wide_str = wide_str;
+		api.godot_string_parse_utf8 = parse_utf8;
+		api.godot_string_parse_utf8_with_len = parse_utf8_with_len;
+		api.godot_string_chars_to_utf8 = chars_to_utf8;
+		api.godot_string_chars_to_utf8_with_len = chars_to_utf8_with_len;
+		api.godot_string_utf8 = utf8;
+		api.godot_char_string_length = char_string_length;
+		api.godot_char_string_get_data = char_string_get_data;
+		api.godot_char_string_destroy = char_string_destroy;
+		api.godot_string_operator_equal = operator_equal;
+		api.godot_string_operator_less = operator_less;
+		api.godot_string_operator_plus = operator_plus;
+		api.godot_node_path_new = node_path_create;
+		api.godot_node_path_new_copy = node_path_create_copy;
+		api.godot_node_path_destroy = node_path_destroy;
+		api.godot_node_path_as_string = node_path_as_string;
+		api.godot_node_path_is_absolute = node_path_is_absolute;
+		api.godot_node_path_is_empty = node_path_is_empty;
+		api.godot_node_path_get_name_count = node_path_get_name_count;
+		api.godot_rid_new = rid_create;
+		api.godot_rid_get_id = rid_get_id;
+	}
+}
@@ -0,0 +1,761 @@
+#include "godot/mock.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <initializer_list>
+
+namespace godot::mock {
+	// Laid out like the engine's variants: a type ahead of 16 bytes of storage, with values that do not fit
+	// kept on the heap. Conversions cover the numeric types and strings, and anything else asked for as
+	// the wrong type comes back as that type's default value.
+	struct VariantData {
+		godot_variant_type type;
+
+		alignas(8) uint8_t storage[16];
+	};
+
+	static_assert(sizeof(VariantData) <= sizeof(godot_variant));
+
+	static VariantData& data_of(godot_variant * variant) {
+		return *reinterpret_cast<VariantData *>(variant);
+	}
+
+	static VariantData const& data_of(godot_variant const* variant) {
+		return *reinterpret_cast<VariantData const*>(variant);
+	}
+
+	template<typename Type> static constexpr bool is_boxed() {
+		return (sizeof(Type) > sizeof(VariantData::storage));
+	}
+
+	template<typename Type> static void store(
+		godot_variant * destination,
+		godot_variant_type const type,
+		Type const& value
+	) {
+		VariantData& data = data_of(destination);
+
+		data.type = type;
+
+		std::memset(data.storage, 0, sizeof(data.storage));
+
+		if constexpr (is_boxed<Type>()) {
+			Type * const boxed = new Type(value);
+
+			std::memcpy(data.storage, (&boxed), sizeof(boxed));
+			count_buffer(1);
+		} else {
+			std::memcpy(data.storage, (&value), sizeof(value));
+		}
+	}
+
+	template<typename Type> static Type const& load(godot_variant const* variant) {
+		VariantData const& data = data_of(variant);
+
+		if constexpr (is_boxed<Type>()) {
+			return **reinterpret_cast<Type * const*>(data.storage);
+		} else {
+			return *reinterpret_cast<Type const*>(data.storage);
+		}
+	}
+
+	template<typename Type> static Type& load(godot_variant * variant) {
+		return const_cast<Type&>(load<Type>(static_cast<godot_variant const*>(variant)));
+	}
+
+	template<typename Type> static void unbox(godot_variant * variant) {
+		delete (&load<Type>(variant));
+
+		count_buffer(-1);
+	}
+
+	template<typename Type> static Type of_reals(std::initializer_list<godot_real> const reals) {
+		Type value;
+
+		std::memcpy((&value), reals.begin(), sizeof(value));
+
+		return value;
+	}
+
+	template<typename Type> static Type value_or(
+		godot_variant const* variant,
+		godot_variant_type const type,
+		Type const& fallback
+	) {
+		return ((data_of(variant).type == type) ? load<Type>(variant) : fallback);
+	}
+
+	static godot_real const* reals_of(godot_variant const* variant, size_t& count) {
+		switch (data_of(variant).type) {
+			case GODOT_VARIANT_TYPE_VECTOR2:
+				count = (sizeof(godot_vector2) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_vector2>(variant));
+
+			case GODOT_VARIANT_TYPE_RECT2:
+				count = (sizeof(godot_rect2) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_rect2>(variant));
+
+			case GODOT_VARIANT_TYPE_VECTOR3:
+				count = (sizeof(godot_vector3) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_vector3>(variant));
+
+			case GODOT_VARIANT_TYPE_TRANSFORM2D:
+				count = (sizeof(godot_transform2d) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_transform2d>(variant));
+
+			case GODOT_VARIANT_TYPE_PLANE:
+				count = (sizeof(godot_plane) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_plane>(variant));
+
+			case GODOT_VARIANT_TYPE_QUAT:
+				count = (sizeof(godot_quat) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_quat>(variant));
+
+			case GODOT_VARIANT_TYPE_AABB:
+				count = (sizeof(godot_aabb) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_aabb>(variant));
+
+			case GODOT_VARIANT_TYPE_BASIS:
+				count = (sizeof(godot_basis) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_basis>(variant));
+
+			case GODOT_VARIANT_TYPE_TRANSFORM:
+				count = (sizeof(godot_transform) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_transform>(variant));
+
+			case GODOT_VARIANT_TYPE_COLOR:
+				count = (sizeof(godot_color) / sizeof(godot_real));
+
+				return reinterpret_cast<godot_real const*>(&load<godot_color>(variant));
+
+			default:
+				count = 0;
+
+				return nullptr;
+		}
+	}
+
+	static bool same_real(double const a, double const b) {
+		return ((a == b) || (std::isnan(a) && std::isnan(b)));
+	}
+
+	// FNV-1a, which is plenty for dictionary keys in benchmarks.
+	static uint32_t hash_bytes(void const* bytes, size_t const size, uint32_t hash = 2166136261u) {
+		for (size_t i = 0; i < size; i += 1) {
+			hash = ((hash ^ static_cast<uint8_t const*>(bytes)[i]) * 16777619u);
+		}
+
+		return hash;
+	}
+
+	static uint32_t hash_real(double const value, uint32_t const hash) {
+		// Values that compare equal must hash equal, so signed zeroes and NaNs are folded first.
+		double const folded = ((value == 0) ? 0.0 : std::isnan(value) ? NAN : value);
+
+		return hash_bytes((&folded), sizeof(folded), hash);
+	}
+
+	static void create_copy(godot_variant * destination, godot_variant const* source) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		VariantData const& data = data_of(source);
+
+		switch (data.type) {
+			case GODOT_VARIANT_TYPE_STRING: {
+				godot_string value;
+
+				api.godot_string_new_copy((&value), (&load<godot_string>(source)));
+				store(destination, data.type, value);
+			} break;
+
+			case GODOT_VARIANT_TYPE_TRANSFORM2D: store(destination, data.type, load<godot_transform2d>(source)); break;
+
+			case GODOT_VARIANT_TYPE_AABB: store(destination, data.type, load<godot_aabb>(source)); break;
+
+			case GODOT_VARIANT_TYPE_BASIS: store(destination, data.type, load<godot_basis>(source)); break;
+
+			case GODOT_VARIANT_TYPE_TRANSFORM: store(destination, data.type, load<godot_transform>(source)); break;
+
+			case GODOT_VARIANT_TYPE_NODE_PATH: {
+				godot_node_path value;
+
+				api.godot_node_path_new_copy((&value), (&load<godot_node_path>(source)));
+				store(destination, data.type, value);
+			} break;
+
+			case GODOT_VARIANT_TYPE_DICTIONARY: {
+				godot_dictionary value;
+
+				api.godot_dictionary_new_copy((&value), (&load<godot_dictionary>(source)));
+				store(destination, data.type, value);
+			} break;
+
+			case GODOT_VARIANT_TYPE_ARRAY: {
+				godot_array value;
+
+				api.godot_array_new_copy((&value), (&load<godot_array>(source)));
+				store(destination, data.type, value);
+			} break;
+
+#define GODOT_MOCK_COPY_POOL(TYPE, NAME) \
+			case GODOT_VARIANT_TYPE_##TYPE: { \
+				godot_##NAME value; \
+				api.godot_##NAME##_new_copy((&value), (&load<godot_##NAME>(source))); \
+				store(destination, data.type, value); \
+			} break;
+
+			GODOT_MOCK_COPY_POOL(POOL_BYTE_ARRAY, pool_byte_array)
+			GODOT_MOCK_COPY_POOL(POOL_INT_ARRAY, pool_int_array)
+			GODOT_MOCK_COPY_POOL(POOL_REAL_ARRAY, pool_real_array)
+			GODOT_MOCK_COPY_POOL(POOL_STRING_ARRAY, pool_string_array)
+			GODOT_MOCK_COPY_POOL(POOL_VECTOR2_ARRAY, pool_vector2_array)
+			GODOT_MOCK_COPY_POOL(POOL_VECTOR3_ARRAY, pool_vector3_array)
+			GODOT_MOCK_COPY_POOL(POOL_COLOR_ARRAY, pool_color_array)
+#undef GODOT_MOCK_COPY_POOL
+
+			default: std::memcpy(destination, source, sizeof(VariantData)); break;
+		}
+	}
+
+	static void create_nil(godot_variant * destination) {
+		data_of(destination).type = GODOT_VARIANT_TYPE_NIL;
+	}
+
+	static void create_bool(godot_variant * destination, godot_bool const value) {
+		store(destination, GODOT_VARIANT_TYPE_BOOL, static_cast<bool>(value));
+	}
+
+	static void create_uint(godot_variant * destination, uint64_t const value) {
+		store(destination, GODOT_VARIANT_TYPE_INT, static_cast<int64_t>(value));
+	}
+
+	static void create_int(godot_variant * destination, int64_t const value) {
+		store(destination, GODOT_VARIANT_TYPE_INT, value);
+	}
+
+	static void create_real(godot_variant * destination, double const value) {
+		store(destination, GODOT_VARIANT_TYPE_REAL, value);
+	}
+
+	static void create_string(godot_variant * destination, godot_string const* value) {
+		godot_string copy;
+
+		core_api().godot_string_new_copy((&copy), value);
+		store(destination, GODOT_VARIANT_TYPE_STRING, copy);
+	}
+
+	static void create_node_path(godot_variant * destination, godot_node_path const* value) {
+		godot_node_path copy;
+
+		core_api().godot_node_path_new_copy((&copy), value);
+		store(destination, GODOT_VARIANT_TYPE_NODE_PATH, copy);
+	}
+
+	static void create_object(godot_variant * destination, godot_object const* value) {
+		store(destination, GODOT_VARIANT_TYPE_OBJECT, value);
+	}
+
+	static void create_dictionary(godot_variant * destination, godot_dictionary const* value) {
+		godot_dictionary copy;
+
+		core_api().godot_dictionary_new_copy((&copy), value);
+		store(destination, GODOT_VARIANT_TYPE_DICTIONARY, copy);
+	}
+
+	static void create_array(godot_variant * destination, godot_array const* value) {
+		godot_array copy;
+
+		core_api().godot_array_new_copy((&copy), value);
+		store(destination, GODOT_VARIANT_TYPE_ARRAY, copy);
+	}
+
+#define GODOT_MOCK_VALUE(TYPE, NAME) \
+	static void create_##NAME(godot_variant * destination, godot_##NAME const* value) { \
+		store(destination, GODOT_VARIANT_TYPE_##TYPE, *value); \
+	} \
+	\
+	static godot_##NAME as_##NAME(godot_variant const* variant) { \
+		return value_or(variant, GODOT_VARIANT_TYPE_##TYPE, NAME##_default); \
+	}
+
+	static godot_vector2 const vector2_default = of_reals<godot_vector2>({0, 0});
+
+	static godot_rect2 const rect2_default = of_reals<godot_rect2>({0, 0, 0, 0});
+
+	static godot_vector3 const vector3_default = of_reals<godot_vector3>({0, 0, 0});
+
+	static godot_transform2d const transform2d_default = of_reals<godot_transform2d>({1, 0, 0, 1, 0, 0});
+
+	static godot_plane const plane_default = of_reals<godot_plane>({0, 0, 0, 0});
+
+	static godot_quat const quat_default = of_reals<godot_quat>({0, 0, 0, 1});
+
+	static godot_aabb const aabb_default = of_reals<godot_aabb>({0, 0, 0, 0, 0, 0});
+
+	static godot_basis const basis_default = of_reals<godot_basis>({1, 0, 0, 0, 1, 0, 0, 0, 1});
+
+	static godot_transform const transform_default = of_reals<godot_transform>({1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0});
+
+	static godot_color const color_default = of_reals<godot_color>({0, 0, 0, 1});
+
+	static godot_rid const rid_default = godot_rid{};
+
+	GODOT_MOCK_VALUE(VECTOR2, vector2)
+	GODOT_MOCK_VALUE(RECT2, rect2)
+	GODOT_MOCK_VALUE(VECTOR3, vector3)
+	GODOT_MOCK_VALUE(TRANSFORM2D, transform2d)
+	GODOT_MOCK_VALUE(PLANE, plane)
+	GODOT_MOCK_VALUE(QUAT, quat)
+	GODOT_MOCK_VALUE(AABB, aabb)
+	GODOT_MOCK_VALUE(BASIS, basis)
+	GODOT_MOCK_VALUE(TRANSFORM, transform)
+	GODOT_MOCK_VALUE(COLOR, color)
+	GODOT_MOCK_VALUE(RID, rid)
+#undef GODOT_MOCK_VALUE
+
+#define GODOT_MOCK_POOL(TYPE, NAME) \
+	static void create_##NAME(godot_variant * destination, godot_##NAME const* value) { \
+		godot_##NAME copy; \
+		core_api().godot_##NAME##_new_copy((&copy), value); \
+		store(destination, GODOT_VARIANT_TYPE_##TYPE, copy); \
+	} \
+	\
+	static godot_##NAME as_##NAME(godot_variant const* variant) { \
+		godot_##NAME value; \
+		if (data_of(variant).type == GODOT_VARIANT_TYPE_##TYPE) { \
+			core_api().godot_##NAME##_new_copy((&value), (&load<godot_##NAME>(variant))); \
+		} else { \
+			core_api().godot_##NAME##_new(&value); \
+		} \
+		return value; \
+	}
+
+	GODOT_MOCK_POOL(POOL_BYTE_ARRAY, pool_byte_array)
+	GODOT_MOCK_POOL(POOL_INT_ARRAY, pool_int_array)
+	GODOT_MOCK_POOL(POOL_REAL_ARRAY, pool_real_array)
+	GODOT_MOCK_POOL(POOL_STRING_ARRAY, pool_string_array)
+	GODOT_MOCK_POOL(POOL_VECTOR2_ARRAY, pool_vector2_array)
+	GODOT_MOCK_POOL(POOL_VECTOR3_ARRAY, pool_vector3_array)
+	GODOT_MOCK_POOL(POOL_COLOR_ARRAY, pool_color_array)
+#undef GODOT_MOCK_POOL
+
+	static int64_t as_int(godot_variant const* variant) {
+		switch (data_of(variant).type) {
+			case GODOT_VARIANT_TYPE_BOOL: return load<bool>(variant);
+
+			case GODOT_VARIANT_TYPE_INT: return load<int64_t>(variant);
+
+			case GODOT_VARIANT_TYPE_REAL: return static_cast<int64_t>(load<double>(variant));
+
+			case GODOT_VARIANT_TYPE_STRING:
+				return std::wcstoll(core_api().godot_string_wide_str(&load<godot_string>(variant)), nullptr, 10);
+
+			default: return 0;
+		}
+	}
+
+	static uint64_t as_uint(godot_variant const* variant) {
+		return static_cast<uint64_t>(as_int(variant));
+	}
+
+	static double as_real(godot_variant const* variant) {
+		switch (data_of(variant).type) {
+			case GODOT_VARIANT_TYPE_BOOL: return load<bool>(variant);
+
+			case GODOT_VARIANT_TYPE_INT: return static_cast<double>(load<int64_t>(variant));
+
+			case GODOT_VARIANT_TYPE_REAL: return load<double>(variant);
+
+			case GODOT_VARIANT_TYPE_STRING:
+				return std::wcstod(core_api().godot_string_wide_str(&load<godot_string>(variant)), nullptr);
+
+			default: return 0;
+		}
+	}
+
+	static godot_bool as_bool(godot_variant const* variant) {
+		switch (data_of(variant).type) {
+			case GODOT_VARIANT_TYPE_BOOL: return load<bool>(variant);
+
+			case GODOT_VARIANT_TYPE_INT: return (load<int64_t>(variant) != 0);
+
+			case GODOT_VARIANT_TYPE_REAL: return (load<double>(variant) != 0);
+
+			case GODOT_VARIANT_TYPE_STRING: return !core_api().godot_string_empty(&load<godot_string>(variant));
+
+			default: return false;
+		}
+	}
+
+	static godot_string as_string(godot_variant const* variant) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		godot_string value;
+		char text[32];
+
+		switch (data_of(variant).type) {
+			case GODOT_VARIANT_TYPE_NIL: return api.godot_string_chars_to_utf8("Null");
+
+			case GODOT_VARIANT_TYPE_BOOL: return api.godot_string_chars_to_utf8(load<bool>(variant) ? "True" : "False");
+
+			case GODOT_VARIANT_TYPE_INT:
+				std::snprintf(text, sizeof(text), "%lld", static_cast<long long>(load<int64_t>(variant)));
+
+				return api.godot_string_chars_to_utf8(text);
+
+			case GODOT_VARIANT_TYPE_REAL:
+				std::snprintf(text, sizeof(text), "%.14g", load<double>(variant));
+
+				return api.godot_string_chars_to_utf8(text);
+
+			case GODOT_VARIANT_TYPE_STRING:
+				api.godot_string_new_copy((&value), (&load<godot_string>(variant)));
+
+				return value;
+
+			case GODOT_VARIANT_TYPE_NODE_PATH: return api.godot_node_path_as_string(&load<godot_node_path>(variant));
+
+			default:
+				api.godot_string_new(&value);
+
+				return value;
+		}
+	}
+
+	static godot_node_path as_node_path(godot_variant const* variant) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		godot_node_path value;
+
+		if (data_of(variant).type == GODOT_VARIANT_TYPE_NODE_PATH) {
+			api.godot_node_path_new_copy((&value), (&load<godot_node_path>(variant)));
+		} else {
+			godot_string path = as_string(variant);
+
+			if (data_of(variant).type != GODOT_VARIANT_TYPE_STRING) {
+				api.godot_string_destroy(&path);
+				api.godot_string_new(&path);
+			}
+
+			api.godot_node_path_new((&value), (&path));
+			api.godot_string_destroy(&path);
+		}
+
+		return value;
+	}
+
+	static godot_object * as_object(godot_variant const* variant) {
+		return const_cast<godot_object *>(value_or<godot_object const*>(variant, GODOT_VARIANT_TYPE_OBJECT, nullptr));
+	}
+
+	static godot_dictionary as_dictionary(godot_variant const* variant) {
+		godot_dictionary value;
+
+		if (data_of(variant).type == GODOT_VARIANT_TYPE_DICTIONARY) {
+			core_api().godot_dictionary_new_copy((&value), (&load<godot_dictionary>(variant)));
+		} else {
+			core_api().godot_dictionary_new(&value);
+		}
+
+		return value;
+	}
+
+	static godot_array as_array(godot_variant const* variant) {
+		godot_array value;
+
+		if (data_of(variant).type == GODOT_VARIANT_TYPE_ARRAY) {
+			core_api().godot_array_new_copy((&value), (&load<godot_array>(variant)));
+		} else {
+			core_api().godot_array_new(&value);
+		}
+
+		return value;
+	}
+
+	static godot_variant call_method(
+		godot_variant *,
+		godot_string const*,
+		godot_variant const**,
+		godot_int const,
+		godot_variant_call_error * error
+	) {
+		godot_variant result;
+
+		create_nil(&result);
+
+		if (error != nullptr) error->error = GODOT_CALL_ERROR_CALL_ERROR_INVALID_METHOD;
+
+		return result;
+	}
+
+	static godot_bool has_method(godot_variant const*, godot_string const*) {
+		return false;
+	}
+
+	static godot_variant_type get_type(godot_variant const* variant) {
+		return data_of(variant).type;
+	}
+
+	static void destroy(godot_variant * variant) {
+		godot_gdnative_core_api_struct const& api = core_api();
+
+		switch (data_of(variant).type) {
+			case GODOT_VARIANT_TYPE_STRING: api.godot_string_destroy(&load<godot_string>(variant)); break;
+
+			case GODOT_VARIANT_TYPE_TRANSFORM2D: unbox<godot_transform2d>(variant); break;
+
+			case GODOT_VARIANT_TYPE_AABB: unbox<godot_aabb>(variant); break;
+
+			case GODOT_VARIANT_TYPE_BASIS: unbox<godot_basis>(variant); break;
+
+			case GODOT_VARIANT_TYPE_TRANSFORM: unbox<godot_transform>(variant); break;
+
+#define GODOT_MOCK_DESTROY(TYPE, NAME) \
+			case GODOT_VARIANT_TYPE_##TYPE: api.godot_##NAME##_destroy(&load<godot_##NAME>(variant)); break;
+
+			GODOT_MOCK_DESTROY(NODE_PATH, node_path)
+			GODOT_MOCK_DESTROY(DICTIONARY, dictionary)
+			GODOT_MOCK_DESTROY(ARRAY, array)
+			GODOT_MOCK_DESTROY(POOL_BYTE_ARRAY, pool_byte_array)
+			GODOT_MOCK_DESTROY(POOL_INT_ARRAY, pool_int_array)
+			GODOT_MOCK_DESTROY(POOL_REAL_ARRAY, pool_real_array)
+			GODOT_MOCK_DESTROY(POOL_STRING_ARRAY, pool_string_array)
+			GODOT_MOCK_DESTROY(POOL_VECTOR2_ARRAY, pool_vector2_array)
+			GODOT_MOCK_DESTROY(POOL_VECTOR3_ARRAY, pool_vector3_array)
+			GODOT_MOCK_DESTROY(POOL_COLOR_ARRAY, pool_color_array)
+#undef GODOT_MOCK_DESTROY
+
+			default: break;
+		}
+
+		data_of(variant).type = GODOT_VARIANT_TYPE_NIL;
+	}
+
+	static godot_bool operator_equal(godot_variant const* a, godot_variant const* b) {
+		godot_variant_type const type_a = data_of(a).type;
+		godot_variant_type const type_b = data_of(b).type;
+
+		auto const is_number = [](godot_variant_type const type) -> bool {
+			return ((type == GODOT_VARIANT_TYPE_INT) || (type == GODOT_VARIANT_TYPE_REAL));
+		};
+
+		if (is_number(type_a) && is_number(type_b) && (type_a != type_b)) return (as_real(a) == as_real(b));
+
+		return equal(a, b);
+	}
+
+	static godot_bool hash_compare(godot_variant const* a, godot_variant const* b) {
+		return equal(a, b);
+	}
+
+	static godot_bool booleanize(godot_variant const* variant) {
+		godot_gdnative_core_api_struct const& api = core_api();
+
+		switch (data_of(variant).type) {
+			case GODOT_VARIANT_TYPE_NIL: return false;
+
+			case GODOT_VARIANT_TYPE_BOOL:
+			case GODOT_VARIANT_TYPE_INT:
+			case GODOT_VARIANT_TYPE_REAL:
+			case GODOT_VARIANT_TYPE_STRING: return as_bool(variant);
+
+			case GODOT_VARIANT_TYPE_NODE_PATH: return !api.godot_node_path_is_empty(&load<godot_node_path>(variant));
+
+			case GODOT_VARIANT_TYPE_OBJECT: return (load<godot_object const*>(variant) != nullptr);
+
+			case GODOT_VARIANT_TYPE_DICTIONARY: return !api.godot_dictionary_empty(&load<godot_dictionary>(variant));
+
+			case GODOT_VARIANT_TYPE_ARRAY: return !api.godot_array_empty(&load<godot_array>(variant));
+
+#define GODOT_MOCK_BOOLEANIZE(TYPE, NAME) \
+			case GODOT_VARIANT_TYPE_##TYPE: return (api.godot_##NAME##_size(&load<godot_##NAME>(variant)) != 0);
+
+			GODOT_MOCK_BOOLEANIZE(POOL_BYTE_ARRAY, pool_byte_array)
+			GODOT_MOCK_BOOLEANIZE(POOL_INT_ARRAY, pool_int_array)
+			GODOT_MOCK_BOOLEANIZE(POOL_REAL_ARRAY, pool_real_array)
+			GODOT_MOCK_BOOLEANIZE(POOL_STRING_ARRAY, pool_string_array)
+			GODOT_MOCK_BOOLEANIZE(POOL_VECTOR2_ARRAY, pool_vector2_array)
+			GODOT_MOCK_BOOLEANIZE(POOL_VECTOR3_ARRAY, pool_vector3_array)
+			GODOT_MOCK_BOOLEANIZE(POOL_COLOR_ARRAY, pool_color_array)
+#undef GODOT_MOCK_BOOLEANIZE
+
+			default: {
+				size_t count;
+				godot_real const* const reals = reals_of(variant, count);
+
+				for (size_t i = 0; i < count; i += 1) {
+					if (reals[i] != 0) return true;
+				}
+
+				return ((data_of(variant).type == GODOT_VARIANT_TYPE_RID) && (load<uint64_t>(variant) != 0));
+			}
+		}
+	}
+
+	bool equal(godot_variant const* a, godot_variant const* b) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		VariantData const& data = data_of(a);
+
+		if (data.type != data_of(b).type) return false;
+
+		switch (data.type) {
+			case GODOT_VARIANT_TYPE_NIL: return true;
+
+			case GODOT_VARIANT_TYPE_BOOL: return (load<bool>(a) == load<bool>(b));
+
+			case GODOT_VARIANT_TYPE_INT: return (load<int64_t>(a) == load<int64_t>(b));
+
+			case GODOT_VARIANT_TYPE_REAL: return same_real(load<double>(a), load<double>(b));
+
+			case GODOT_VARIANT_TYPE_STRING:
+				return api.godot_string_operator_equal((&load<godot_string>(a)), (&load<godot_string>(b)));
+
+			case GODOT_VARIANT_TYPE_NODE_PATH: {
+				godot_string path_a = api.godot_node_path_as_string(&load<godot_node_path>(a));
+				godot_string path_b = api.godot_node_path_as_string(&load<godot_node_path>(b));
+				bool const same = api.godot_string_operator_equal((&path_a), (&path_b));
+
+				api.godot_string_destroy(&path_a);
+				api.godot_string_destroy(&path_b);
+
+				return same;
+			}
+
+			default: {
+				size_t count;
+				godot_real const* const reals_a = reals_of(a, count);
+				godot_real const* const reals_b = reals_of(b, count);
+
+				if (reals_a == nullptr) {
+					return (std::memcmp(data.storage, data_of(b).storage, sizeof(data.storage)) == 0);
+				}
+
+				for (size_t i = 0; i < count; i += 1) {
+					if (!same_real(reals_a[i], reals_b[i])) return false;
+				}
+
+				return true;
+			}
+		}
+	}
+
+	uint32_t hash(godot_variant const* value) {
+		godot_gdnative_core_api_struct const& api = core_api();
+		VariantData const& data = data_of(value);
+		uint32_t const seed = hash_bytes((&data.type), sizeof(data.type));
+
+		switch (data.type) {
+			case GODOT_VARIANT_TYPE_NIL: return seed;
+
+			case GODOT_VARIANT_TYPE_REAL: return hash_real(load<double>(value), seed);
+
+			case GODOT_VARIANT_TYPE_STRING: {
+				godot_string const* const string = (&load<godot_string>(value));
+
+				return hash_bytes(
+					api.godot_string_wide_str(string),
+					(api.godot_string_length(string) * sizeof(wchar_t)),
+					seed
+				);
+			}
+
+			case GODOT_VARIANT_TYPE_NODE_PATH: {
+				godot_string path = api.godot_node_path_as_string(&load<godot_node_path>(value));
+				uint32_t const result = hash_bytes(
+					api.godot_string_wide_str(&path),
+					(api.godot_string_length(&path) * sizeof(wchar_t)),
+					seed
+				);
+
+				api.godot_string_destroy(&path);
+
+				return result;
+			}
+
+			default: {
+				size_t count;
+				godot_real const* const reals = reals_of(value, count);
+				uint32_t result = seed;
+
+				if (reals == nullptr) return hash_bytes(data.storage, sizeof(data.storage), seed);
+
+				for (size_t i = 0; i < count; i += 1) result = hash_real(reals[i], result);
+
+				return result;
+			}
+		}
+	}
+
+	void install_variants(godot_gdnative_core_api_struct& api) {
+		api.godot_variant_new_copy = create_copy;
+		api.godot_variant_new_nil = create_nil;
+		api.godot_variant_new_bool = create_bool;
+		api.godot_variant_new_uint = create_uint;
+		api.godot_variant_new_int = create_int;
+		api.godot_variant_new_real = create_real;
+		api.godot_variant_new_string = create_string;
+		api.godot_variant_new_vector2 = create_vector2;
+		api.godot_variant_new_rect2 = create_rect2;
+		api.godot_variant_new_vector3 = create_vector3;
+		api.godot_variant_new_transform2d = create_transform2d;
+		api.godot_variant_new_plane = create_plane;
+		api.godot_variant_new_quat = create_quat;
+		api.godot_variant_new_aabb = create_aabb;
+		api.godot_variant_new_basis = create_basis;
+		api.godot_variant_new_transform = create_transform;
+		api.godot_variant_new_color = create_color;
+		api.godot_variant_new_node_path = create_node_path;
+		api.godot_variant_new_rid = create_rid;
+		api.godot_variant_new_object = create_object;
+		api.godot_variant_new_dictionary = create_dictionary;
+		api.godot_variant_new_array = create_array;
+		api.godot_variant_new_pool_byte_array = create_pool_byte_array;
+		api.godot_variant_new_pool_int_array = create_pool_int_array;
+		api.godot_variant_new_pool_real_array = create_pool_real_array;
+		api.godot_variant_new_pool_string_array = create_pool_string_array;
+		api.godot_variant_new_pool_vector2_array = create_pool_vector2_array;
+		api.godot_variant_new_pool_vector3_array = create_pool_vector3_array;
+		api.godot_variant_new_pool_color_array = create_pool_color_array;
+		api.godot_variant_as_bool = as_bool;
+		api.godot_variant_as_uint = as_uint;
+		api.godot_variant_as_int = as_int;
+		api.godot_variant_as_real = as_real;
+		api.godot_variant_as_string = as_string;
+		api.godot_variant_as_vector2 = as_vector2;
+		api.godot_variant_as_rect2 = as_rect2;
+		api.godot_variant_as_vector3 = as_vector3;
+		api.godot_variant_as_transform2d = as_transform2d;
+		api.godot_variant_as_plane = as_plane;
+		api.godot_variant_as_quat = as_quat;
+		api.godot_variant_as_aabb = as_aabb;
+		api.godot_variant_as_basis = as_basis;
+		api.godot_variant_as_transform = as_transform;
+		api.godot_variant_as_color = as_color;
+		api.godot_variant_as_node_path = as_node_path;
+		api.godot_variant_as_rid = as_rid;
+		api.godot_variant_as_object = as_object;
+		api.godot_variant_as_dictionary = as_dictionary;
+		api.godot_variant_as_array = as_array;
+		api.godot_variant_as_pool_byte_array = as_pool_byte_array;
+		api.godot_variant_as_pool_int_array = as_pool_int_array;
+		api.godot_variant_as_pool_real_array = as_pool_real_array;
+		api.godot_variant_as_pool_string_array = as_pool_string_array;
+		api.godot_variant_as_pool_vector2_array = as_pool_vector2_array;
+		api.godot_variant_as_pool_vector3_array = as_pool_vector3_array;
+		api.godot_variant_as_pool_color_array = as_pool_color_array;
+		api.godot_variant_call = call_method;
+		api.godot_variant_has_method = has_method;
+		api.godot_variant_get_type = get_type;
+		api.godot_variant_destroy = destroy;
+		api.godot_variant_operator_equal = operator_equal;
+		api.godot_variant_hash_compare = hash_compare;
+		api.godot_variant_booleanize = booleanize;
+	}
+}
@@ -0,0 +1,188 @@
+#ifndef GODOT_PACKED_H
+#define GODOT_PACKED_H
+
+#include "godot/core.hpp"
+
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace godot::packed {
+	using core::real_t;
+
+	/// Element type of a chunk, fixing its element size and the spans it can be viewed as.
+	enum class ChunkType : uint32_t {
+		BYTE = 0,
+		INT = 1,
+		REAL = 2,
+		VECTOR2 = 3,
+		VECTOR3 = 4,
+		COLOR = 5
+	};
+
+	template<typename Type> constexpr ChunkType chunk_type_of() {
+		if constexpr (std::is_same_v<Type, uint8_t>) return ChunkType::BYTE;
+		else if constexpr (std::is_same_v<Type, godot_int>) return ChunkType::INT;
+		else if constexpr (std::is_same_v<Type, real_t>) return ChunkType::REAL;
+		else if constexpr (std::is_same_v<Type, core::Vector2>) return ChunkType::VECTOR2;
+		else if constexpr (std::is_same_v<Type, core::Vector3>) return ChunkType::VECTOR3;
+		else if constexpr (std::is_same_v<Type, core::Color>) return ChunkType::COLOR;
+		else static_assert(sizeof(Type) == 0, "Type has no chunk representation");
+	}
+
+	/// Layout of a chunk file: this header, then the chunk data, then the index of `chunk_count` entries
+	/// at `index_offset`, sorted by name. Everything is little-endian and every chunk starts on a
+	/// `chunk_alignment` boundary so it can be viewed in place.
+	struct ChunkFileHeader {
+		char magic[4];
+
+		uint32_t version;
+
+		uint32_t chunk_count;
+
+		uint32_t reserved;
+
+		uint64_t index_offset;
+	};
+
+	struct ChunkEntry {
+		/// NUL-padded, so names are at most 39 bytes.
+		char name[40];
+
+		ChunkType type;
+
+		uint32_t reserved;
+
+		uint64_t offset;
+
+		uint64_t size;
+
+		constexpr std::string_view name_of() const {
+			return std::string_view(this->name, std::char_traits<char>::length(this->name));
+		}
+	};
+
+	static_assert(sizeof(ChunkFileHeader) == 24);
+
+	static_assert(sizeof(ChunkEntry) == 64);
+
+	static constexpr uint32_t chunk_file_version = 1;
+
+	static constexpr uint64_t chunk_alignment = 64;
+
+	/// A read-only view of a whole file through the virtual memory system, so pages are only read from
+	/// disk when touched.
+	class MappedFile final {
+		uint8_t const* data;
+
+		size_t size;
+
+#ifdef _WIN32
+		void * mapping;
+#endif
+
+		public:
+		MappedFile();
+
+		MappedFile(MappedFile const& that) = delete;
+
+		~MappedFile();
+
+		constexpr std::span<uint8_t const> bytes() const {
+			return std::span<uint8_t const>(this->data, this->size);
+		}
+
+		void close();
+
+		core::Error open(char const* path);
+
+		/// Asks the system to start reading `range` in the background ahead of use.
+		void prefetch(std::span<uint8_t const> range) const;
+	};
+
+	/// Reads named chunks from a mapped chunk file. Opening only validates the header and index, and
+	/// spans point into the mapping, so startup time and resident memory follow the chunks actually
+	/// touched rather than the file size. Spans are invalidated by closing the reader.
+	class ChunkReader final {
+		MappedFile file;
+
+		std::span<ChunkEntry const> index;
+
+		template<typename Pool> bool copy_chunk(std::string_view name, ChunkType type, Pool& out) const;
+
+		public:
+		ChunkReader() = default;
+
+		ChunkReader(ChunkReader const& that) = delete;
+
+		constexpr std::span<ChunkEntry const> chunks() const {
+			return this->index;
+		}
+
+		void close();
+
+		/// Copies a chunk into a new pool array for engine APIs that need one, returning `false` if the
+		/// chunk is missing or of another type.
+		bool copy(std::string_view name, core::PoolByteArray& out) const;
+
+		bool copy(std::string_view name, core::PoolIntArray& out) const;
+
+		bool copy(std::string_view name, core::PoolRealArray& out) const;
+
+		bool copy(std::string_view name, core::PoolVector2Array& out) const;
+
+		bool copy(std::string_view name, core::PoolVector3Array& out) const;
+
+		bool copy(std::string_view name, core::PoolColorArray& out) const;
+
+		ChunkEntry const* find(std::string_view name) const;
+
+		/// Fails with `ERR_FILE_UNRECOGNIZED` for files that are not chunk files and `ERR_FILE_CORRUPT`
+		/// when the index points outside the file or at misaligned data.
+		core::Error open(char const* path);
+
+		void prefetch(std::string_view name) const;
+
+		/// The raw bytes of the named chunk, or an empty span if there is none.
+		std::span<uint8_t const> raw(std::string_view name) const;
+
+		/// The named chunk viewed in place, or an empty span if it is missing or holds another type.
+		template<typename Type> std::span<Type const> span(std::string_view const name) const {
+			ChunkEntry const* const entry = this->find(name);
+
+			if ((entry == nullptr) || (entry->type != chunk_type_of<Type>())) return std::span<Type const>();
+
+			return std::span<Type const>(
+				reinterpret_cast<Type const*>(this->file.bytes().data() + entry->offset),
+				static_cast<size_t>(entry->size / sizeof(Type))
+			);
+		}
+	};
+
+	/// Builds a chunk file, typically offline in tools. Added spans are referenced rather than copied
+	/// and must stay alive until `save` returns.
+	class ChunkWriter final {
+		struct Pending {
+			ChunkEntry entry;
+
+			std::span<uint8_t const> bytes;
+		};
+
+		std::vector<Pending> pending;
+
+		public:
+		/// Returns `false` if the name is empty, too long or already added.
+		bool add(std::string_view name, ChunkType type, std::span<uint8_t const> bytes);
+
+		template<typename Type> bool add(std::string_view const name, std::span<Type const> const elements) {
+			return this->add(name, chunk_type_of<Type>(), std::span<uint8_t const>(
+				reinterpret_cast<uint8_t const*>(elements.data()),
+				elements.size_bytes()
+			));
+		}
+
+		core::Error save(char const* path) const;
+	};
+}
+
+#endif
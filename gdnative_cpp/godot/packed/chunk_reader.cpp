@@ -0,0 +1,152 @@
+#include "godot/packed.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace godot::packed {
+	static constexpr char magic[4] = {'G', 'D', 'P', 'K'};
+
+	static constexpr size_t element_size_of(ChunkType const type) {
+		switch (type) {
+			case ChunkType::BYTE: return sizeof(uint8_t);
+			case ChunkType::INT: return sizeof(godot_int);
+			case ChunkType::REAL: return sizeof(real_t);
+			case ChunkType::VECTOR2: return sizeof(core::Vector2);
+			case ChunkType::VECTOR3: return sizeof(core::Vector3);
+			case ChunkType::COLOR: return sizeof(core::Color);
+		}
+
+		return 0;
+	}
+
+	void ChunkReader::close() {
+		this->index = std::span<ChunkEntry const>();
+
+		this->file.close();
+	}
+
+	bool ChunkReader::copy(std::string_view name, core::PoolByteArray& out) const {
+		return this->copy_chunk(name, ChunkType::BYTE, out);
+	}
+
+	bool ChunkReader::copy(std::string_view name, core::PoolIntArray& out) const {
+		return this->copy_chunk(name, ChunkType::INT, out);
+	}
+
+	bool ChunkReader::copy(std::string_view name, core::PoolRealArray& out) const {
+		return this->copy_chunk(name, ChunkType::REAL, out);
+	}
+
+	bool ChunkReader::copy(std::string_view name, core::PoolVector2Array& out) const {
+		return this->copy_chunk(name, ChunkType::VECTOR2, out);
+	}
+
+	bool ChunkReader::copy(std::string_view name, core::PoolVector3Array& out) const {
+		return this->copy_chunk(name, ChunkType::VECTOR3, out);
+	}
+
+	bool ChunkReader::copy(std::string_view name, core::PoolColorArray& out) const {
+		return this->copy_chunk(name, ChunkType::COLOR, out);
+	}
+
+	template<typename Pool> bool ChunkReader::copy_chunk(std::string_view name, ChunkType type, Pool& out) const {
+		ChunkEntry const* const entry = this->find(name);
+
+		if ((entry == nullptr) || (entry->type != type)) return false;
+
+		out.resize(static_cast<int>(entry->size / element_size_of(type)));
+
+		std::memcpy(out.write().data(), (this->file.bytes().data() + entry->offset), static_cast<size_t>(entry->size));
+
+		return true;
+	}
+
+	ChunkEntry const* ChunkReader::find(std::string_view name) const {
+		ChunkEntry const* const entry = std::lower_bound(
+			this->index.data(),
+			(this->index.data() + this->index.size()),
+			name,
+			[](ChunkEntry const& entry, std::string_view const name) { return (entry.name_of() < name); }
+		);
+
+		if ((entry == (this->index.data() + this->index.size())) || (entry->name_of() != name)) return nullptr;
+
+		return entry;
+	}
+
+	core::Error ChunkReader::open(char const* path) {
+		this->close();
+
+		core::Error const error = this->file.open(path);
+
+		if (error != core::Error::OK) return error;
+
+		std::span<uint8_t const> const bytes = this->file.bytes();
+		ChunkFileHeader header;
+
+		if (bytes.size() < sizeof(header)) {
+			this->file.close();
+
+			return core::Error::ERR_FILE_UNRECOGNIZED;
+		}
+
+		std::memcpy((&header), bytes.data(), sizeof(header));
+
+		if ((std::memcmp(header.magic, magic, sizeof(magic)) != 0) || (header.version != chunk_file_version)) {
+			this->file.close();
+
+			return core::Error::ERR_FILE_UNRECOGNIZED;
+		}
+
+		// Everything the spans will later trust is checked here, once, without touching chunk data.
+		bool valid = (
+			((header.index_offset % alignof(ChunkEntry)) == 0) &&
+			(header.index_offset <= bytes.size()) &&
+			(header.chunk_count <= ((bytes.size() - header.index_offset) / sizeof(ChunkEntry)))
+		);
+
+		std::span<ChunkEntry const> const entries = (valid ? std::span<ChunkEntry const>(
+			reinterpret_cast<ChunkEntry const*>(bytes.data() + header.index_offset),
+			header.chunk_count
+		) : std::span<ChunkEntry const>());
+
+		for (size_t i = 0; (valid && (i < entries.size())); i += 1) {
+			ChunkEntry const& entry = entries[i];
+			size_t const element_size = element_size_of(entry.type);
+
+			valid = (
+				(entry.name[sizeof(entry.name) - 1] == '\0') &&
+				(element_size != 0) &&
+				((entry.offset % chunk_alignment) == 0) &&
+				(entry.offset <= bytes.size()) &&
+				(entry.size <= (bytes.size() - entry.offset)) &&
+				((entry.size % element_size) == 0) &&
+				((entry.size / element_size) <= static_cast<uint64_t>(std::numeric_limits<int>::max())) &&
+				((i == 0) || (entries[i - 1].name_of() < entry.name_of()))
+			);
+		}
+
+		if (!valid) {
+			this->file.close();
+
+			return core::Error::ERR_FILE_CORRUPT;
+		}
+
+		this->index = entries;
+
+		return core::Error::OK;
+	}
+
+	void ChunkReader::prefetch(std::string_view name) const {
+		this->file.prefetch(this->raw(name));
+	}
+
+	std::span<uint8_t const> ChunkReader::raw(std::string_view name) const {
+		ChunkEntry const* const entry = this->find(name);
+
+		if (entry == nullptr) return std::span<uint8_t const>();
+
+		return this->file.bytes().subspan(static_cast<size_t>(entry->offset), static_cast<size_t>(entry->size));
+	}
+}
@@ -0,0 +1,86 @@
+#include "godot/packed.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace godot::packed {
+	static constexpr char magic[4] = {'G', 'D', 'P', 'K'};
+
+	bool ChunkWriter::add(std::string_view name, ChunkType type, std::span<uint8_t const> bytes) {
+		ChunkEntry entry = {};
+
+		if (name.empty() || (name.size() >= sizeof(entry.name)) || (name.find('\0') != std::string_view::npos)) {
+			return false;
+		}
+
+		for (Pending const& pending : this->pending) if (pending.entry.name_of() == name) return false;
+
+		std::memcpy(entry.name, name.data(), name.size());
+
+		entry.type = type;
+		entry.size = bytes.size();
+
+		this->pending.push_back(Pending{entry, bytes});
+
+		return true;
+	}
+
+	core::Error ChunkWriter::save(char const* path) const {
+		static constexpr uint8_t padding[chunk_alignment] = {};
+		std::vector<ChunkEntry> index;
+		std::FILE * const file = std::fopen(path, "wb");
+
+		if (file == nullptr) return core::Error::ERR_FILE_CANT_OPEN;
+
+		uint64_t offset = chunk_alignment;
+		bool written = true;
+
+		// The header is rewritten once the index position is known.
+		written = (written && (std::fwrite(padding, 1, chunk_alignment, file) == chunk_alignment));
+
+		for (Pending const& pending : this->pending) {
+			ChunkEntry entry = pending.entry;
+			uint64_t const padded = (((pending.bytes.size() + chunk_alignment) - 1) & ~(chunk_alignment - 1));
+
+			entry.offset = offset;
+
+			written = (written && (std::fwrite(
+				pending.bytes.data(),
+				1,
+				pending.bytes.size(),
+				file
+			) == pending.bytes.size()));
+
+			written = (written && (std::fwrite(
+				padding,
+				1,
+				static_cast<size_t>(padded - pending.bytes.size()),
+				file
+			) == (padded - pending.bytes.size())));
+
+			offset += padded;
+
+			index.push_back(entry);
+		}
+
+		std::sort(index.begin(), index.end(), [](ChunkEntry const& a, ChunkEntry const& b) {
+			return (a.name_of() < b.name_of());
+		});
+
+		ChunkFileHeader header = {};
+
+		std::memcpy(header.magic, magic, sizeof(magic));
+
+		header.version = chunk_file_version;
+		header.chunk_count = static_cast<uint32_t>(index.size());
+		header.index_offset = offset;
+
+		written = (written && (std::fwrite(index.data(), sizeof(ChunkEntry), index.size(), file) == index.size()));
+		written = (written && (std::fseek(file, 0, SEEK_SET) == 0));
+		written = (written && (std::fwrite((&header), sizeof(header), 1, file) == 1));
+		written = ((std::fclose(file) == 0) && written);
+
+		return (written ? core::Error::OK : core::Error::ERR_FILE_CANT_WRITE);
+	}
+}
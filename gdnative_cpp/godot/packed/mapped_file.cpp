@@ -0,0 +1,137 @@
+#include "godot/packed.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace godot::packed {
+#ifdef _WIN32
+	MappedFile::MappedFile() : data(nullptr), size(0), mapping(nullptr) { }
+#else
+	MappedFile::MappedFile() : data(nullptr), size(0) { }
+#endif
+
+	MappedFile::~MappedFile() {
+		this->close();
+	}
+
+	void MappedFile::close() {
+#ifdef _WIN32
+		if (this->data != nullptr) UnmapViewOfFile(this->data);
+
+		if (this->mapping != nullptr) CloseHandle(this->mapping);
+
+		this->mapping = nullptr;
+#else
+		if (this->data != nullptr) munmap(const_cast<uint8_t *>(this->data), this->size);
+#endif
+
+		this->data = nullptr;
+		this->size = 0;
+	}
+
+	core::Error MappedFile::open(char const* path) {
+		this->close();
+
+#ifdef _WIN32
+		HANDLE const file = CreateFileA(
+			path,
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL,
+			nullptr
+		);
+
+		if (file == INVALID_HANDLE_VALUE) return core::Error::ERR_FILE_CANT_OPEN;
+
+		LARGE_INTEGER size;
+
+		if (!GetFileSizeEx(file, (&size))) {
+			CloseHandle(file);
+
+			return core::Error::ERR_FILE_CANT_READ;
+		}
+
+		// Empty files cannot be mapped.
+		if (size.QuadPart == 0) {
+			CloseHandle(file);
+
+			return core::Error::ERR_FILE_UNRECOGNIZED;
+		}
+
+		this->mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		// The mapping keeps the file open on its own.
+		CloseHandle(file);
+
+		if (this->mapping == nullptr) return core::Error::ERR_FILE_CANT_READ;
+
+		this->data = static_cast<uint8_t const*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+
+		if (this->data == nullptr) {
+			this->close();
+
+			return core::Error::ERR_FILE_CANT_READ;
+		}
+
+		this->size = static_cast<size_t>(size.QuadPart);
+#else
+		int const file = ::open(path, O_RDONLY);
+
+		if (file < 0) return core::Error::ERR_FILE_CANT_OPEN;
+
+		struct stat status;
+
+		if (fstat(file, (&status)) != 0) {
+			::close(file);
+
+			return core::Error::ERR_FILE_CANT_READ;
+		}
+
+		// Empty files cannot be mapped.
+		if (status.st_size == 0) {
+			::close(file);
+
+			return core::Error::ERR_FILE_UNRECOGNIZED;
+		}
+
+		void * const data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+		// The mapping keeps the file open on its own.
+		::close(file);
+
+		if (data == MAP_FAILED) return core::Error::ERR_FILE_CANT_READ;
+
+		this->data = static_cast<uint8_t const*>(data);
+		this->size = static_cast<size_t>(status.st_size);
+#endif
+
+		return core::Error::OK;
+	}
+
+	void MappedFile::prefetch(std::span<uint8_t const> range) const {
+		if (range.empty()) return;
+
+#ifdef _WIN32
+		WIN32_MEMORY_RANGE_ENTRY entry = {const_cast<uint8_t *>(range.data()), range.size()};
+
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, (&entry), 0);
+#else
+		// madvise wants a page-aligned start, so round down to the page holding the first byte.
+		uintptr_t const page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+		uintptr_t const start = (reinterpret_cast<uintptr_t>(range.data()) & ~(page_size - 1));
+		uintptr_t const end = (reinterpret_cast<uintptr_t>(range.data()) + range.size());
+
+		madvise(reinterpret_cast<void *>(start), static_cast<size_t>(end - start), MADV_WILLNEED);
+#endif
+	}
+}
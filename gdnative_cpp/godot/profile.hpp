@@ -0,0 +1,67 @@
+#ifndef GODOT_PROFILE_H
+#define GODOT_PROFILE_H
+
+#include "godot/core.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/// Times the rest of the enclosing scope as a named slice on the calling thread's timeline. The name must
+/// have static storage duration, such as a string literal, because only the pointer is recorded. Builds
+/// without `GODOT_PROFILE` defined compile it to nothing; builds with it pay one relaxed load per scope
+/// until `profile::start` is called.
+#ifdef GODOT_PROFILE
+#define GODOT_PROFILE_JOIN_INNER(A, B) A##B
+#define GODOT_PROFILE_JOIN(A, B) GODOT_PROFILE_JOIN_INNER(A, B)
+#define GD_PROFILE_SCOPE(NAME) \
+	::godot::profile::Scope const GODOT_PROFILE_JOIN(godot_profile_scope_, __LINE__) = ::godot::profile::Scope(NAME)
+#else
+#define GD_PROFILE_SCOPE(NAME) ((void)0)
+#endif
+
+namespace godot::profile {
+	/// Set by `start` and `stop`. Read directly by `Scope` so the disabled path stays inline.
+	extern std::atomic<bool> recording;
+
+	uint64_t nanoseconds_now();
+
+	/// Appends a completed slice to the calling thread's ring buffer, dropping it if the buffer is full.
+	void record(char const* name, uint64_t begin_nanoseconds, uint64_t end_nanoseconds);
+
+	class Scope final {
+		char const* name;
+
+		uint64_t begin;
+
+		public:
+		Scope(char const* name) :
+			name(recording.load(std::memory_order_relaxed) ? name : nullptr),
+			begin((this->name != nullptr) ? nanoseconds_now() : 0) { }
+
+		Scope(Scope const& that) = delete;
+
+		~Scope() {
+			if (this->name != nullptr) record(this->name, this->begin, nanoseconds_now());
+		}
+	};
+
+	/// Slices recorded since the last `start` that were lost to full ring buffers.
+	uint64_t dropped_events();
+
+	/// Labels the calling thread in exported traces. The name is copied.
+	void name_thread(char const* name);
+
+	/// Starts recording. Each thread gets a lock-free single-producer ring of `events_per_thread` slices,
+	/// rounded up to a power of two, the first time it records; rings that already exist keep their size.
+	void start(size_t events_per_thread = 65536);
+
+	void stop();
+
+	/// Drains every thread's ring into a Chrome trace JSON file, which also loads in Perfetto. Recording
+	/// may continue while this runs; slices finished afterwards go to the next file. Returns `false` if the
+	/// file could not be written.
+	bool write_trace(char const* path);
+}
+
+#endif
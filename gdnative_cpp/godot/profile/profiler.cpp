@@ -0,0 +1,223 @@
+#include "godot/profile.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace godot::profile {
+	struct Event {
+		char const* name;
+
+		uint64_t begin;
+
+		uint64_t end;
+	};
+
+	// Only the owning thread pushes and only `write_trace` drains, so head and tail each have one writer.
+	class EventRing final {
+		static constexpr size_t cache_line_size = 64;
+
+		std::unique_ptr<Event[]> events;
+
+		size_t mask;
+
+		alignas(cache_line_size) std::atomic<size_t> head;
+
+		alignas(cache_line_size) std::atomic<size_t> tail;
+
+		public:
+		std::atomic<uint64_t> dropped;
+
+		EventRing(size_t const capacity) : head(0), tail(0), dropped(0) {
+			size_t rounded = 2;
+
+			while (rounded < capacity) rounded <<= 1;
+
+			this->events = std::make_unique<Event[]>(rounded);
+			this->mask = (rounded - 1);
+		}
+
+		EventRing(EventRing const& that) = delete;
+
+		template<typename Function> void drain(Function const& function) {
+			size_t tail = this->tail.load(std::memory_order_relaxed);
+			size_t const head = this->head.load(std::memory_order_acquire);
+
+			for (; tail != head; tail += 1) function(this->events[(tail & this->mask)]);
+
+			this->tail.store(tail, std::memory_order_release);
+		}
+
+		void push(Event const& event) {
+			size_t const head = this->head.load(std::memory_order_relaxed);
+
+			if ((head - this->tail.load(std::memory_order_acquire)) > this->mask) {
+				this->dropped.fetch_add(1, std::memory_order_relaxed);
+
+				return;
+			}
+
+			this->events[(head & this->mask)] = event;
+
+			this->head.store((head + 1), std::memory_order_release);
+		}
+	};
+
+	struct ThreadEvents {
+		uint32_t id;
+
+		std::string name;
+
+		EventRing ring;
+
+		ThreadEvents(uint32_t const id, std::string name, size_t const capacity) :
+			id(id),
+			name(std::move(name)),
+			ring(capacity) { }
+	};
+
+	std::atomic<bool> recording = false;
+
+	// Threads that have recorded are never unregistered, so rings of finished threads can still be
+	// flushed. Guards everything below it except the ring contents.
+	static std::mutex registry_mutex;
+
+	static std::vector<std::unique_ptr<ThreadEvents>> threads = {};
+
+	static size_t ring_capacity = 65536;
+
+	static uint64_t epoch = 0;
+
+	static thread_local ThreadEvents * current = nullptr;
+
+	static thread_local std::string current_name = {};
+
+	static void write_escaped(std::FILE * file, char const* text) {
+		std::fputc('"', file);
+
+		for (; (*text) != '\0'; text += 1) {
+			unsigned char const character = static_cast<unsigned char>(*text);
+
+			if ((character == '"') || (character == '\\')) {
+				std::fputc('\\', file);
+				std::fputc(character, file);
+			} else if (character < 0x20) {
+				std::fprintf(file, "\\u%04x", character);
+			} else {
+				std::fputc(character, file);
+			}
+		}
+
+		std::fputc('"', file);
+	}
+
+	static double microseconds_since_epoch(uint64_t const nanoseconds) {
+		return ((static_cast<double>(nanoseconds) - static_cast<double>(epoch)) / 1000.0);
+	}
+
+	uint64_t nanoseconds_now() {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count());
+	}
+
+	void record(char const* name, uint64_t const begin_nanoseconds, uint64_t const end_nanoseconds) {
+		if (current == nullptr) {
+			std::lock_guard<std::mutex> lock(registry_mutex);
+
+			threads.push_back(std::make_unique<ThreadEvents>(
+				static_cast<uint32_t>(threads.size() + 1),
+				current_name,
+				ring_capacity
+			));
+
+			current = threads.back().get();
+		}
+
+		current->ring.push(Event{name, begin_nanoseconds, end_nanoseconds});
+	}
+
+	uint64_t dropped_events() {
+		std::lock_guard<std::mutex> lock(registry_mutex);
+		uint64_t dropped = 0;
+
+		for (std::unique_ptr<ThreadEvents> const& thread : threads) {
+			dropped += thread->ring.dropped.load(std::memory_order_relaxed);
+		}
+
+		return dropped;
+	}
+
+	void name_thread(char const* name) {
+		current_name = name;
+
+		if (current != nullptr) {
+			std::lock_guard<std::mutex> lock(registry_mutex);
+
+			current->name = current_name;
+		}
+	}
+
+	void start(size_t const events_per_thread) {
+		{
+			std::lock_guard<std::mutex> lock(registry_mutex);
+
+			ring_capacity = events_per_thread;
+			epoch = nanoseconds_now();
+
+			for (std::unique_ptr<ThreadEvents> const& thread : threads) {
+				thread->ring.dropped.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		recording.store(true, std::memory_order_relaxed);
+	}
+
+	void stop() {
+		recording.store(false, std::memory_order_relaxed);
+	}
+
+	bool write_trace(char const* path) {
+		std::lock_guard<std::mutex> lock(registry_mutex);
+		std::FILE * const file = std::fopen(path, "wb");
+		bool first = true;
+
+		if (file == nullptr) return false;
+
+		std::fputs("{\"traceEvents\":[", file);
+
+		for (std::unique_ptr<ThreadEvents> const& thread : threads) {
+			if (thread->name.empty()) continue;
+
+			std::fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+				(first ? "" : ","), thread->id);
+
+			write_escaped(file, thread->name.c_str());
+			std::fputs("}}", file);
+
+			first = false;
+		}
+
+		for (std::unique_ptr<ThreadEvents> const& thread : threads) {
+			thread->ring.drain([&](Event const& event) {
+				std::fprintf(file, "%s\n{\"name\":", (first ? "" : ","));
+				write_escaped(file, event.name);
+				std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+					thread->id,
+					microseconds_since_epoch(event.begin),
+					((event.end - event.begin) / 1000.0));
+
+				first = false;
+			});
+		}
+
+		std::fputs("\n],\"displayTimeUnit\":\"ns\"}\n", file);
+
+		bool const written = (std::ferror(file) == 0);
+
+		return ((std::fclose(file) == 0) && written);
+	}
+}
@@ -0,0 +1,155 @@
+#ifndef GODOT_QUANTIZE_H
+#define GODOT_QUANTIZE_H
+
+#include "godot/core.hpp"
+
+#include <vector>
+
+namespace godot::quantize {
+	using core::real_t;
+
+	/// Appends values of arbitrary bit width to a byte buffer, least significant bit first.
+	class BitWriter final {
+		std::vector<uint8_t> * bytes;
+
+		uint64_t scratch;
+
+		uint32_t scratch_bits;
+
+		public:
+		BitWriter(std::vector<uint8_t>& bytes);
+
+		BitWriter(BitWriter const& that) = delete;
+
+		/// Pads the final partial byte with zero bits and appends it.
+		void flush();
+
+		/// Writes the low `bit_count` bits of `value`, up to 64.
+		void write(uint64_t value, uint32_t bit_count);
+	};
+
+	/// Reads values written by `BitWriter`. Reading past the end yields zero bits and sets `overflowed`,
+	/// so a truncated packet can be rejected once after decoding rather than checked on every read.
+	class BitReader final {
+		std::span<uint8_t const> bytes;
+
+		size_t position;
+
+		bool overflow;
+
+		public:
+		BitReader(std::span<uint8_t const> bytes);
+
+		constexpr bool overflowed() const {
+			return this->overflow;
+		}
+
+		uint64_t read(uint32_t bit_count);
+	};
+
+	/// Smallest-three quaternion encoding: the index of the largest component in two bits, followed by
+	/// the other three components quantized over [-1/sqrt(2), 1/sqrt(2)]. The largest component is
+	/// rebuilt from the unit length on decode.
+	class QuatCodec final {
+		uint32_t component_bits;
+
+		// Dequantized value of every component code, so decoding is a lookup per component.
+		std::vector<real_t> components;
+
+		public:
+		/// `component_bits` is clamped to [9, 15], giving 29 to 47 bits per quaternion. The largest rotation
+		/// error is about 0.5 degrees at 9 bits, 0.06 at 12 and 0.007 at 15.
+		QuatCodec(uint32_t component_bits = 12);
+
+		constexpr uint32_t bits() const {
+			return (2 + (this->component_bits * 3));
+		}
+
+		core::Quat decode(uint64_t code) const;
+
+		void decode(std::span<uint64_t const> codes, std::span<core::Quat> out) const;
+
+		/// Expects a unit quaternion.
+		uint64_t encode(core::Quat const& rotation) const;
+
+		void encode(std::span<core::Quat const> rotations, std::span<uint64_t> out) const;
+	};
+
+	/// Fixed-point encoding of positions inside a box, `axis_bits` per axis. Positions outside the box
+	/// are clamped to it.
+	class Vector3Codec final {
+		core::Vector3 minimum;
+
+		core::Vector3 scale;
+
+		core::Vector3 step;
+
+		uint32_t axis_bits;
+
+		public:
+		/// `axis_bits` is clamped to [1, 21] so a position fits in 63 bits. Axes where `maximum` does not exceed
+		/// `minimum` always encode as zero, and so do NaN coordinates.
+		Vector3Codec(core::Vector3 const& minimum, core::Vector3 const& maximum, uint32_t axis_bits);
+
+		constexpr uint32_t bits() const {
+			return (this->axis_bits * 3);
+		}
+
+		constexpr uint32_t bits_per_axis() const {
+			return this->axis_bits;
+		}
+
+		core::Vector3 decode(uint64_t code) const;
+
+		void decode(std::span<uint64_t const> codes, std::span<core::Vector3> out) const;
+
+		uint64_t encode(core::Vector3 const& position) const;
+
+		void encode(std::span<core::Vector3 const> positions, std::span<uint64_t> out) const;
+	};
+
+	struct EncodedTransform {
+		uint64_t rotation;
+
+		uint64_t origin;
+
+		constexpr bool operator==(EncodedTransform const& that) const {
+			return ((this->rotation == that.rotation) && (this->origin == that.origin));
+		}
+	};
+
+	/// Encodes rigid transforms as a smallest-three rotation and a bounded origin. Scale is not carried:
+	/// decoded bases are pure rotations.
+	class TransformCodec final {
+		QuatCodec rotation;
+
+		Vector3Codec origin;
+
+		public:
+		TransformCodec(QuatCodec const& rotation, Vector3Codec const& origin);
+
+		void decode(std::span<EncodedTransform const> encoded, std::span<core::Transform> out) const;
+
+		/// Reads a packet written by `encode_delta` against the same `baseline`, filling `out` with the
+		/// encoded transforms it describes. Returns `false` if the packet is truncated.
+		bool decode_delta(
+			BitReader& reader,
+			std::span<EncodedTransform const> baseline,
+			std::span<EncodedTransform> out
+		) const;
+
+		void encode(std::span<core::Transform const> transforms, std::span<EncodedTransform> out) const;
+
+		/// Writes `current` relative to `baseline`, the last snapshot the receiver acknowledged. An
+		/// unchanged transform costs one bit. A changed one costs three flag bits, plus the rotation code
+		/// if the rotation changed, plus 25 bits if the origin moved under 128 steps on every axis or one
+		/// more than the origin code otherwise.
+		void encode_delta(
+			std::span<EncodedTransform const> current,
+			std::span<EncodedTransform const> baseline,
+			BitWriter& writer
+		) const;
+	};
+}
+
+#endif
@@ -0,0 +1,63 @@
+#include "godot/quantize.hpp"
+
+#include <algorithm>
+
+namespace godot::quantize {
+	BitWriter::BitWriter(std::vector<uint8_t>& bytes) : bytes(&bytes), scratch(0), scratch_bits(0) { }
+
+	void BitWriter::flush() {
+		if (this->scratch_bits != 0) {
+			this->bytes->push_back(static_cast<uint8_t>(this->scratch));
+
+			this->scratch = 0;
+			this->scratch_bits = 0;
+		}
+	}
+
+	void BitWriter::write(uint64_t const value, uint32_t const bit_count) {
+		// Fewer than eight bits are ever held over, so 32-bit halves always fit in the scratch word.
+		if (bit_count > 32) {
+			this->write(value, 32);
+			this->write((value >> 32), (bit_count - 32));
+
+			return;
+		}
+
+		uint64_t const mask = ((bit_count == 0) ? 0 : (~uint64_t(0) >> (64 - bit_count)));
+
+		this->scratch |= ((value & mask) << this->scratch_bits);
+		this->scratch_bits += bit_count;
+
+		while (this->scratch_bits >= 8) {
+			this->bytes->push_back(static_cast<uint8_t>(this->scratch));
+
+			this->scratch >>= 8;
+			this->scratch_bits -= 8;
+		}
+	}
+
+	BitReader::BitReader(std::span<uint8_t const> const bytes) : bytes(bytes), position(0), overflow(false) { }
+
+	uint64_t BitReader::read(uint32_t const bit_count) {
+		uint64_t value = 0;
+
+		for (uint32_t bit = 0; bit < bit_count; ) {
+			size_t const byte = (this->position >> 3);
+
+			if (byte >= this->bytes.size()) {
+				this->overflow = true;
+
+				return 0;
+			}
+
+			uint32_t const offset = static_cast<uint32_t>(this->position & 7);
+			uint32_t const taken = std::min((8 - offset), (bit_count - bit));
+
+			value |= (static_cast<uint64_t>((this->bytes[byte] >> offset) & ((1u << taken) - 1)) << bit);
+			bit += taken;
+			this->position += taken;
+		}
+
+		return value;
+	}
+}
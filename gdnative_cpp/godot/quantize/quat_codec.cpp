@@ -0,0 +1,74 @@
+#include "godot/quantize.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace godot::quantize {
+	using core::Quat;
+
+	static constexpr real_t component_range = 0.707106781186547524f;
+
+	QuatCodec::QuatCodec(uint32_t const component_bits) :
+		component_bits(std::clamp(component_bits, 9u, 15u)),
+		components((size_t(1) << this->component_bits)) {
+
+		real_t const last = static_cast<real_t>(this->components.size() - 1);
+
+		for (size_t i = 0; i < this->components.size(); i += 1) {
+			this->components[i] = ((((static_cast<real_t>(i) / last) * 2.f) - 1.f) * component_range);
+		}
+	}
+
+	Quat QuatCodec::decode(uint64_t const code) const {
+		uint64_t const mask = (this->components.size() - 1);
+		uint32_t const bits = this->component_bits;
+		real_t const a = this->components[((code >> (bits * 2)) & mask)];
+		real_t const b = this->components[((code >> bits) & mask)];
+		real_t const c = this->components[(code & mask)];
+		real_t const largest = std::sqrt(std::max(0.f, (1.f - (a * a) - (b * b) - (c * c))));
+
+		switch (code >> (bits * 3)) {
+			case 0: return Quat{largest, a, b, c};
+			case 1: return Quat{a, largest, b, c};
+			case 2: return Quat{a, b, largest, c};
+			default: return Quat{a, b, c, largest};
+		}
+	}
+
+	void QuatCodec::decode(std::span<uint64_t const> const codes, std::span<Quat> const out) const {
+		for (size_t i = 0; i < out.size(); i += 1) out[i] = this->decode(codes[i]);
+	}
+
+	uint64_t QuatCodec::encode(Quat const& rotation) const {
+		real_t const components[4] = {rotation.x, rotation.y, rotation.z, rotation.w};
+		uint32_t largest = 0;
+
+		for (uint32_t i = 1; i < 4; i += 1) {
+			if (std::fabs(components[i]) > std::fabs(components[largest])) largest = i;
+		}
+
+		// `q` and `-q` are the same rotation, so the largest component is always sent as positive.
+		real_t const sign = ((components[largest] < 0) ? -1.f : 1.f);
+		real_t const scale = (static_cast<real_t>(this->components.size() - 1) * 0.5f);
+		real_t const limit = static_cast<real_t>(this->components.size() - 1);
+		uint64_t code = largest;
+
+		for (uint32_t i = 0; i < 4; i += 1) {
+			if (i == largest) continue;
+
+			real_t const normalized = (((components[i] * sign) / component_range) + 1.f);
+			real_t const scaled = ((normalized * scale) + 0.5f);
+
+			// NaN passes through `std::clamp`, and converting it to an integer is undefined.
+			code = ((code << this->component_bits) | (std::isnan(scaled) ? 0 : static_cast<uint64_t>(
+				std::clamp(scaled, 0.f, limit)
+			)));
+		}
+
+		return code;
+	}
+
+	void QuatCodec::encode(std::span<Quat const> const rotations, std::span<uint64_t> const out) const {
+		for (size_t i = 0; i < out.size(); i += 1) out[i] = this->encode(rotations[i]);
+	}
+}
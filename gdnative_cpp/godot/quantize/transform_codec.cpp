@@ -0,0 +1,120 @@
+#include "godot/quantize.hpp"
+
+namespace godot::quantize {
+	using core::Transform;
+
+	// Origins that moved less than this many steps on every axis are sent as 8-bit deltas.
+	static constexpr int64_t small_delta = 128;
+
+	TransformCodec::TransformCodec(QuatCodec const& rotation, Vector3Codec const& origin) :
+		rotation(rotation),
+		origin(origin) { }
+
+	void TransformCodec::decode(std::span<EncodedTransform const> const encoded, std::span<Transform> const out) const {
+		for (size_t i = 0; i < out.size(); i += 1) {
+			out[i] = Transform{
+				core::Basis::from_quat(this->rotation.decode(encoded[i].rotation)),
+				this->origin.decode(encoded[i].origin)
+			};
+		}
+	}
+
+	bool TransformCodec::decode_delta(
+		BitReader& reader,
+		std::span<EncodedTransform const> const baseline,
+		std::span<EncodedTransform> const out
+	) const {
+		uint32_t const axis_bits = this->origin.bits_per_axis();
+		uint64_t const axis_mask = ((uint64_t(1) << axis_bits) - 1);
+
+		for (size_t i = 0; i < out.size(); i += 1) {
+			EncodedTransform encoded = baseline[i];
+
+			if (reader.read(1) != 0) {
+				if (reader.read(1) != 0) encoded.rotation = reader.read(this->rotation.bits());
+
+				if (reader.read(1) != 0) {
+					if (reader.read(1) != 0) {
+						uint64_t moved = 0;
+
+						for (uint32_t axis = 0; axis < 3; axis += 1) {
+							uint32_t const shift = (axis_bits * (2 - axis));
+							int64_t const base = static_cast<int64_t>((encoded.origin >> shift) & axis_mask);
+							int64_t const delta = static_cast<int8_t>(reader.read(8));
+
+							moved |= ((static_cast<uint64_t>(base + delta) & axis_mask) << shift);
+						}
+
+						encoded.origin = moved;
+					} else {
+						encoded.origin = reader.read(this->origin.bits());
+					}
+				}
+			}
+
+			out[i] = encoded;
+		}
+
+		return !reader.overflowed();
+	}
+
+	void TransformCodec::encode(std::span<Transform const> const transforms, std::span<EncodedTransform> const out) const {
+		for (size_t i = 0; i < out.size(); i += 1) {
+			out[i] = EncodedTransform{
+				this->rotation.encode(transforms[i].basis.get_rotation_quat()),
+				this->origin.encode(transforms[i].origin)
+			};
+		}
+	}
+
+	void TransformCodec::encode_delta(
+		std::span<EncodedTransform const> const current,
+		std::span<EncodedTransform const> const baseline,
+		BitWriter& writer
+	) const {
+		uint32_t const axis_bits = this->origin.bits_per_axis();
+		uint64_t const axis_mask = ((uint64_t(1) << axis_bits) - 1);
+
+		for (size_t i = 0; i < current.size(); i += 1) {
+			EncodedTransform const& now = current[i];
+			EncodedTransform const& then = baseline[i];
+
+			if (now == then) {
+				writer.write(0, 1);
+
+				continue;
+			}
+
+			writer.write(1, 1);
+			writer.write((now.rotation != then.rotation), 1);
+
+			if (now.rotation != then.rotation) writer.write(now.rotation, this->rotation.bits());
+
+			writer.write((now.origin != then.origin), 1);
+
+			if (now.origin == then.origin) continue;
+
+			int64_t deltas[3];
+			bool small = true;
+
+			for (uint32_t axis = 0; axis < 3; axis += 1) {
+				uint32_t const shift = (axis_bits * (2 - axis));
+
+				deltas[axis] = (
+					static_cast<int64_t>((now.origin >> shift) & axis_mask) -
+					static_cast<int64_t>((then.origin >> shift) & axis_mask)
+				);
+
+				small = (small && (deltas[axis] >= -small_delta) && (deltas[axis] < small_delta));
+			}
+
+			writer.write(small, 1);
+
+			if (small) {
+				for (int64_t const delta : deltas) writer.write(static_cast<uint8_t>(delta), 8);
+			} else {
+				writer.write(now.origin, this->origin.bits());
+			}
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#include "godot/quantize.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace godot::quantize {
+	using core::Vector3;
+
+	Vector3Codec::Vector3Codec(Vector3 const& minimum, Vector3 const& maximum, uint32_t const axis_bits) :
+		minimum(minimum),
+		axis_bits(std::clamp(axis_bits, 1u, 21u)) {
+
+		real_t const steps = static_cast<real_t>((uint64_t(1) << this->axis_bits) - 1);
+		Vector3 const extent = (maximum - minimum);
+
+		// A flat box, such as a ground plane, has no extent on one axis; every position on it encodes as zero.
+		auto const axis_scale = [steps](real_t const axis_extent) {
+			return ((axis_extent > 0) ? (steps / axis_extent) : 0.f);
+		};
+
+		this->scale = Vector3{axis_scale(extent.x), axis_scale(extent.y), axis_scale(extent.z)};
+		this->step = Vector3{(extent.x / steps), (extent.y / steps), (extent.z / steps)};
+	}
+
+	Vector3 Vector3Codec::decode(uint64_t const code) const {
+		uint64_t const mask = ((uint64_t(1) << this->axis_bits) - 1);
+
+		return Vector3{
+			(this->minimum.x + (static_cast<real_t>((code >> (this->axis_bits * 2)) & mask) * this->step.x)),
+			(this->minimum.y + (static_cast<real_t>((code >> this->axis_bits) & mask) * this->step.y)),
+			(this->minimum.z + (static_cast<real_t>(code & mask) * this->step.z))
+		};
+	}
+
+	void Vector3Codec::decode(std::span<uint64_t const> const codes, std::span<Vector3> const out) const {
+		for (size_t i = 0; i < out.size(); i += 1) out[i] = this->decode(codes[i]);
+	}
+
+	uint64_t Vector3Codec::encode(Vector3 const& position) const {
+		real_t const limit = static_cast<real_t>((uint64_t(1) << this->axis_bits) - 1);
+
+		auto const axis = [limit](real_t const offset, real_t const scale) {
+			real_t const scaled = ((offset * scale) + 0.5f);
+
+			// NaN passes through `std::clamp`, and converting it to an integer is undefined.
+			if (std::isnan(scaled)) return uint64_t(0);
+
+			return static_cast<uint64_t>(std::clamp(scaled, 0.f, limit));
+		};
+
+		return (
+			(axis((position.x - this->minimum.x), this->scale.x) << (this->axis_bits * 2)) |
+			(axis((position.y - this->minimum.y), this->scale.y) << this->axis_bits) |
+			axis((position.z - this->minimum.z), this->scale.z)
+		);
+	}
+
+	void Vector3Codec::encode(std::span<Vector3 const> const positions, std::span<uint64_t> const out) const {
+		for (size_t i = 0; i < out.size(); i += 1) out[i] = this->encode(positions[i]);
+	}
+}
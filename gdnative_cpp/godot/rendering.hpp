@@ -0,0 +1,126 @@
+#ifndef GODOT_RENDERING_H
+#define GODOT_RENDERING_H
+
+#include "godot/core.hpp"
+
+namespace godot::rendering {
+	using core::real_t;
+
+	/// Builds the packed per-instance array accepted by `MultiMesh::set_as_bulk_array`, so every instance
+	/// is written with plain stores and the whole set reaches the engine in one call per frame.
+	class MultiMeshBulkWriter final {
+		public:
+		enum TransformFormat {
+			TRANSFORM_2D = 0,
+			TRANSFORM_3D = 1
+		};
+
+		enum ColorFormat {
+			COLOR_NONE = 0,
+			COLOR_8BIT = 1,
+			COLOR_FLOAT = 2
+		};
+
+		enum CustomDataFormat {
+			CUSTOM_DATA_NONE = 0,
+			CUSTOM_DATA_8BIT = 1,
+			CUSTOM_DATA_FLOAT = 2
+		};
+
+		/// Holds the array's write lock. Writes mark their instances dirty on the owning writer. Must be
+		/// released before flushing. Setters return `false` and write nothing when an instance is outside
+		/// the writer's count or the writer has no data of that kind, such as a 3D transform on a
+		/// `TRANSFORM_2D` writer or a color on a `COLOR_NONE` one.
+		class Lock final {
+			MultiMeshBulkWriter * writer;
+
+			core::PoolArrayWrite<real_t> data;
+
+			bool holds(int first_instance, size_t count) const;
+
+			void mark(int instance);
+
+			void write_color(size_t offset, int format, core::Color const& color);
+
+			public:
+			Lock(MultiMeshBulkWriter * writer, core::PoolArrayWrite<real_t>&& data);
+
+			Lock(Lock const& that) = delete;
+
+			bool set_color(int instance, core::Color const& color);
+
+			bool set_custom_data(int instance, core::Color const& custom_data);
+
+			bool set_transform(int instance, core::Transform const& transform);
+
+			bool set_transform_2d(int instance, core::Transform2D const& transform);
+
+			/// Writes consecutive transforms starting at `first_instance`, all of them or none.
+			bool set_transforms(int first_instance, std::span<core::Transform const> transforms);
+		};
+
+		private:
+		core::PoolRealArray array;
+
+		int instance_count;
+
+		TransformFormat transform_format;
+
+		ColorFormat color_format;
+
+		CustomDataFormat custom_data_format;
+
+		int dirty_begin;
+
+		int dirty_end;
+
+		size_t color_offset() const;
+
+		size_t custom_data_offset() const;
+
+		public:
+		MultiMeshBulkWriter(
+			int instance_count,
+			TransformFormat transform_format = TRANSFORM_3D,
+			ColorFormat color_format = COLOR_NONE,
+			CustomDataFormat custom_data_format = CUSTOM_DATA_NONE
+		);
+
+		void clear_dirty();
+
+		/// Instances written since the last flush as a half-open range, empty when nothing changed.
+		constexpr int get_dirty_begin() const {
+			return this->dirty_begin;
+		}
+
+		constexpr int get_dirty_end() const {
+			return this->dirty_end;
+		}
+
+		constexpr core::PoolRealArray const& get_array() const {
+			return this->array;
+		}
+
+		constexpr int get_instance_count() const {
+			return this->instance_count;
+		}
+
+		size_t floats_per_instance() const;
+
+		/// Pushes the array to `multimesh` through `set_as_bulk_array` when anything has been written
+		/// since the last flush. Main thread only.
+		bool flush(core::Object multimesh);
+
+		constexpr bool is_dirty() const {
+			return (this->dirty_begin < this->dirty_end);
+		}
+
+		Lock lock();
+
+		/// Resizes for `instance_count` instances, keeping existing instance data, and marks all of them
+		/// dirty. The multimesh's own instance count must be changed to match before the next flush.
+		void resize(int instance_count);
+	};
+}
+
+#endif
@@ -0,0 +1,208 @@
+#include "godot/rendering.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace godot::rendering {
+	static size_t floats_for(int const format) {
+		switch (format) {
+			case MultiMeshBulkWriter::COLOR_8BIT: return 1;
+			case MultiMeshBulkWriter::COLOR_FLOAT: return 4;
+			default: return 0;
+		}
+	}
+
+	// Written so NaN gives zero; `std::clamp` passes it through and converting it is undefined.
+	static uint8_t to_byte(real_t const channel) {
+		real_t const scaled = (channel * 255.f);
+
+		return static_cast<uint8_t>((scaled > 0) ? ((scaled < 255.f) ? scaled : 255.f) : 0.f);
+	}
+
+	MultiMeshBulkWriter::Lock::Lock(MultiMeshBulkWriter * writer, core::PoolArrayWrite<real_t>&& data) :
+		writer(writer),
+		data(std::move(data)) { }
+
+	void MultiMeshBulkWriter::Lock::mark(int const instance) {
+		if (this->writer->dirty_begin >= this->writer->dirty_end) {
+			this->writer->dirty_begin = instance;
+			this->writer->dirty_end = (instance + 1);
+		} else {
+			this->writer->dirty_begin = std::min(this->writer->dirty_begin, instance);
+			this->writer->dirty_end = std::max(this->writer->dirty_end, (instance + 1));
+		}
+	}
+
+	bool MultiMeshBulkWriter::Lock::holds(int const first_instance, size_t const count) const {
+		return (
+			(first_instance >= 0) &&
+			(static_cast<size_t>(first_instance) <= static_cast<size_t>(this->writer->instance_count)) &&
+			(count <= static_cast<size_t>(this->writer->instance_count - first_instance))
+		);
+	}
+
+	void MultiMeshBulkWriter::Lock::write_color(size_t const offset, int const format, core::Color const& color) {
+		real_t * destination = (this->data.data() + offset);
+
+		if (format == COLOR_FLOAT) {
+			destination[0] = color.r;
+			destination[1] = color.g;
+			destination[2] = color.b;
+			destination[3] = color.a;
+		} else if (format == COLOR_8BIT) {
+			// The engine reads the four bytes of this float in r, g, b, a order.
+			uint8_t const bytes[4] = {to_byte(color.r), to_byte(color.g), to_byte(color.b), to_byte(color.a)};
+
+			std::memcpy(destination, bytes, sizeof(bytes));
+		}
+	}
+
+	bool MultiMeshBulkWriter::Lock::set_color(int const instance, core::Color const& color) {
+		if ((this->writer->color_format == COLOR_NONE) || (!this->holds(instance, 1))) return false;
+
+		this->write_color(
+			((static_cast<size_t>(instance) * this->writer->floats_per_instance()) + this->writer->color_offset()),
+			this->writer->color_format,
+			color
+		);
+
+		this->mark(instance);
+
+		return true;
+	}
+
+	bool MultiMeshBulkWriter::Lock::set_custom_data(int const instance, core::Color const& custom_data) {
+		if ((this->writer->custom_data_format == CUSTOM_DATA_NONE) || (!this->holds(instance, 1))) return false;
+
+		this->write_color(
+			((static_cast<size_t>(instance) * this->writer->floats_per_instance()) + this->writer->custom_data_offset()),
+			this->writer->custom_data_format,
+			custom_data
+		);
+
+		this->mark(instance);
+
+		return true;
+	}
+
+	bool MultiMeshBulkWriter::Lock::set_transform(int const instance, core::Transform const& transform) {
+		return this->set_transforms(instance, std::span<core::Transform const>((&transform), 1));
+	}
+
+	bool MultiMeshBulkWriter::Lock::set_transform_2d(int const instance, core::Transform2D const& transform) {
+		if ((this->writer->transform_format != TRANSFORM_2D) || (!this->holds(instance, 1))) return false;
+
+		real_t * destination = (this->data.data() + (static_cast<size_t>(instance) * this->writer->floats_per_instance()));
+
+		destination[0] = transform.x.x;
+		destination[1] = transform.y.x;
+		destination[2] = 0;
+		destination[3] = transform.origin.x;
+		destination[4] = transform.x.y;
+		destination[5] = transform.y.y;
+		destination[6] = 0;
+		destination[7] = transform.origin.y;
+
+		this->mark(instance);
+
+		return true;
+	}
+
+	bool MultiMeshBulkWriter::Lock::set_transforms(
+		int const first_instance,
+		std::span<core::Transform const> const transforms
+	) {
+		if ((this->writer->transform_format != TRANSFORM_3D) || (!this->holds(first_instance, transforms.size()))) {
+			return false;
+		}
+
+		if (transforms.empty()) return true;
+
+		size_t const stride = this->writer->floats_per_instance();
+		real_t * destination = (this->data.data() + (static_cast<size_t>(first_instance) * stride));
+
+		for (core::Transform const& transform : transforms) {
+			destination[0] = transform.basis.x.x;
+			destination[1] = transform.basis.x.y;
+			destination[2] = transform.basis.x.z;
+			destination[3] = transform.origin.x;
+			destination[4] = transform.basis.y.x;
+			destination[5] = transform.basis.y.y;
+			destination[6] = transform.basis.y.z;
+			destination[7] = transform.origin.y;
+			destination[8] = transform.basis.z.x;
+			destination[9] = transform.basis.z.y;
+			destination[10] = transform.basis.z.z;
+			destination[11] = transform.origin.z;
+			destination += stride;
+		}
+
+		this->mark(first_instance);
+		this->mark(first_instance + static_cast<int>(transforms.size() - 1));
+
+		return true;
+	}
+
+	MultiMeshBulkWriter::MultiMeshBulkWriter(
+		int const instance_count,
+		TransformFormat const transform_format,
+		ColorFormat const color_format,
+		CustomDataFormat const custom_data_format
+	) :
+		instance_count(0),
+		transform_format(transform_format),
+		color_format(color_format),
+		custom_data_format(custom_data_format),
+		dirty_begin(0),
+		dirty_end(0) {
+
+		this->resize(instance_count);
+	}
+
+	void MultiMeshBulkWriter::clear_dirty() {
+		this->dirty_begin = 0;
+		this->dirty_end = 0;
+	}
+
+	size_t MultiMeshBulkWriter::color_offset() const {
+		return ((this->transform_format == TRANSFORM_2D) ? 8 : 12);
+	}
+
+	size_t MultiMeshBulkWriter::custom_data_offset() const {
+		return (this->color_offset() + floats_for(this->color_format));
+	}
+
+	size_t MultiMeshBulkWriter::floats_per_instance() const {
+		return (this->custom_data_offset() + floats_for(this->custom_data_format));
+	}
+
+	bool MultiMeshBulkWriter::flush(core::Object multimesh) {
+		static godot_method_bind * set_as_bulk_array = nullptr;
+
+		if ((!this->is_dirty()) || (!GD_MAIN_THREAD_ONLY())) return false;
+
+		if (!set_as_bulk_array) {
+			set_as_bulk_array = core::api_core->godot_method_bind_get_method("MultiMesh", "set_as_bulk_array");
+		}
+
+		void const* arguments[] = {this->array.handleof()};
+
+		core::api_core->godot_method_bind_ptrcall(set_as_bulk_array, multimesh.handleof(), arguments, nullptr);
+		this->clear_dirty();
+
+		return true;
+	}
+
+	MultiMeshBulkWriter::Lock MultiMeshBulkWriter::lock() {
+		return Lock(this, this->array.write());
+	}
+
+	void MultiMeshBulkWriter::resize(int const instance_count) {
+		this->instance_count = instance_count;
+
+		this->array.resize(static_cast<int>(static_cast<size_t>(instance_count) * this->floats_per_instance()));
+
+		this->dirty_begin = 0;
+		this->dirty_end = instance_count;
+	}
+}
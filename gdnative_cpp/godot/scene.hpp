@@ -0,0 +1,54 @@
+#ifndef GODOT_SCENE_H
+#define GODOT_SCENE_H
+
+#include "godot/core.hpp"
+
+#include <cstdint>
+
+namespace godot::scene {
+	/// Parses `path` into a `NodePath` the first time it is seen and returns that same one from then on,
+	/// so repeated lookups skip string parsing. Main thread only; the paths live until
+	/// `release_interned_paths`.
+	core::NodePath const& intern(char const* path);
+
+	/// Destroys every interned path, for `godot_gdnative_terminate`.
+	void release_interned_paths();
+
+	/// Invalidates every `CachedNodeRef`. Call when the tree changes, such as from a handler of the
+	/// `SceneTree::tree_changed` signal.
+	void notify_tree_changed();
+
+	uint64_t tree_generation();
+
+	/// A node looked up by path once and then reused. The cached node is revalidated through its instance
+	/// ID, with `godot_instance_from_id` on core 1.2 or `godot_is_instance_valid` plus a `get_instance_id`
+	/// call on 1.1, and looked up again only after `notify_tree_changed` or when it was freed. Without
+	/// either revision every `get` looks the node up, since a stale pointer cannot be detected. Main thread
+	/// only.
+	class CachedNodeRef final {
+		core::NodePath const* path;
+
+		godot_object * from;
+
+		godot_object * target;
+
+		int64_t instance_id;
+
+		uint64_t generation;
+
+		bool is_alive() const;
+
+		public:
+		/// `path` must outlive the reference, which interned paths do.
+		CachedNodeRef(core::NodePath const& path);
+
+		CachedNodeRef(char const* path);
+
+		/// The node at the path relative to `from`, or a null object if there is none.
+		core::Object get(godot_object * from);
+
+		void invalidate();
+	};
+}
+
+#endif
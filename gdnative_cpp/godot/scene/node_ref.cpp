@@ -0,0 +1,127 @@
+#include "godot/scene.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace godot::scene {
+	static std::unordered_map<std::string, std::unique_ptr<core::NodePath>> interned_paths = {};
+
+	static std::atomic<uint64_t> generation_counter = 1;
+
+	// `get_node_or_null` is only in 3.2 and later, so older engines fall back to `get_node`, which also
+	// reports an error when the node is missing.
+	static godot_method_bind * get_node_bind() {
+		static godot_method_bind * const bind = []() {
+			godot_method_bind * const or_null = core::api_core->godot_method_bind_get_method(
+				"Node",
+				"get_node_or_null"
+			);
+
+			if (or_null != nullptr) return or_null;
+
+			return core::api_core->godot_method_bind_get_method("Node", "get_node");
+		}();
+
+		return bind;
+	}
+
+	static godot_method_bind * get_instance_id_bind() {
+		static godot_method_bind * const bind = core::api_core->godot_method_bind_get_method(
+			"Object",
+			"get_instance_id"
+		);
+
+		return bind;
+	}
+
+	static int64_t instance_id_of(godot_object * object) {
+		int64_t instance_id = 0;
+
+		core::api_core->godot_method_bind_ptrcall(get_instance_id_bind(), object, nullptr, (&instance_id));
+
+		return instance_id;
+	}
+
+	core::NodePath const& intern(char const* path) {
+		std::unique_ptr<core::NodePath>& interned = interned_paths[path];
+
+		if (!interned) interned = std::make_unique<core::NodePath>(core::String(path));
+
+		return *interned;
+	}
+
+	void release_interned_paths() {
+		interned_paths.clear();
+	}
+
+	void notify_tree_changed() {
+		generation_counter.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint64_t tree_generation() {
+		return generation_counter.load(std::memory_order_relaxed);
+	}
+
+	CachedNodeRef::CachedNodeRef(core::NodePath const& path) :
+		path(&path),
+		from(nullptr),
+		target(nullptr),
+		instance_id(0),
+		generation(0) { }
+
+	CachedNodeRef::CachedNodeRef(char const* path) : CachedNodeRef(intern(path)) { }
+
+	bool CachedNodeRef::is_alive() const {
+		// `godot_instance_from_id` takes a 32-bit ID, so larger ones go through the 1.1 check instead.
+		godot_int const narrow_id = static_cast<godot_int>(this->instance_id);
+
+		if (core::capabilities().core12 && (narrow_id == this->instance_id)) {
+			return (core::api_core12->godot_instance_from_id(narrow_id) == this->target);
+		}
+
+		// A valid pointer may belong to a new object allocated where the node was freed, so its ID has to
+		// match as well.
+		if (core::capabilities().core11 && core::api_core11->godot_is_instance_valid(this->target)) {
+			return (instance_id_of(this->target) == this->instance_id);
+		}
+
+		return false;
+	}
+
+	core::Object CachedNodeRef::get(godot_object * from) {
+		bool const cached = (
+			(this->target != nullptr) &&
+			(this->from == from) &&
+			(this->generation == tree_generation())
+		);
+
+		if (cached && this->is_alive()) return core::Object(this->target);
+
+		this->invalidate();
+
+		if ((from == nullptr) || (!GD_MAIN_THREAD_ONLY())) return core::Object();
+
+		void const* arguments[] = {this->path->handleof()};
+		godot_object * target = nullptr;
+
+		core::api_core->godot_method_bind_ptrcall(get_node_bind(), from, arguments, (&target));
+
+		if (target == nullptr) return core::Object();
+
+		this->instance_id = instance_id_of(target);
+		this->from = from;
+		this->target = target;
+		this->generation = tree_generation();
+
+		return core::Object(target);
+	}
+
+	void CachedNodeRef::invalidate() {
+		this->from = nullptr;
+		this->target = nullptr;
+		this->instance_id = 0;
+		this->generation = 0;
+	}
+}
@@ -0,0 +1,161 @@
+#ifndef GODOT_SERIALIZE_H
+#define GODOT_SERIALIZE_H
+
+#include "godot/core.hpp"
+
+#include <bit>
+#include <vector>
+
+namespace godot::serialize {
+	static_assert(std::endian::native == std::endian::little, "Pool arrays are serialized as raw little-endian blocks");
+
+	/// A stream opens with "GDVB" and this version byte, followed by any number of encoded values.
+	static constexpr uint8_t format_version = 1;
+
+	/// Every value starts with one of these tags. Integers are zigzag LEB128 varints, counts and string
+	/// lengths are LEB128 varints, strings are UTF-8, math types are their raw GDNative structs and pool
+	/// arrays are a count followed by the raw element block. Objects and RIDs have no portable encoding and
+	/// are written as `NIL`.
+	enum class Tag : uint8_t {
+		NIL,
+		BOOL_FALSE,
+		BOOL_TRUE,
+		INT,
+		REAL32,
+		REAL64,
+		STRING,
+		VECTOR2,
+		RECT2,
+		VECTOR3,
+		TRANSFORM2D,
+		PLANE,
+		QUAT,
+		AABB,
+		BASIS,
+		TRANSFORM,
+		COLOR,
+		NODE_PATH,
+		DICTIONARY,
+		ARRAY,
+		POOL_BYTE_ARRAY,
+		POOL_INT_ARRAY,
+		POOL_REAL_ARRAY,
+		POOL_STRING_ARRAY,
+		POOL_VECTOR2_ARRAY,
+		POOL_VECTOR3_ARRAY,
+		POOL_COLOR_ARRAY
+	};
+
+	/// Containers nested deeper than this fail to encode or decode, which also catches self-referencing
+	/// arrays and dictionaries.
+	static constexpr uint32_t max_depth = 256;
+
+	/// Receives a full buffer of encoded bytes. Returning `false` aborts the write.
+	using Sink = bool (*)(void * context, std::span<uint8_t const> bytes);
+
+	/// Fills as much of `into` as it can, returning the number of bytes written and zero at the end of
+	/// the stream.
+	using Source = size_t (*)(void * context, std::span<uint8_t> into);
+
+	/// Encodes values into a caller-owned buffer, handing it to the sink whenever it fills. Pool arrays
+	/// larger than the buffer go to the sink directly from the pool memory. Nothing is allocated while
+	/// writing.
+	class Writer final {
+		std::span<uint8_t> buffer;
+
+		size_t used;
+
+		size_t flushed;
+
+		Sink sink;
+
+		void * context;
+
+		bool started;
+
+		bool drain();
+
+		bool put_bytes(std::span<uint8_t const> bytes);
+
+		bool put_string(godot_string const* value);
+
+		bool put_varint(uint64_t value);
+
+		bool reserve(size_t byte_count);
+
+		core::Error put_value(godot_variant const* value, uint32_t depth);
+
+		public:
+		/// `buffer` must hold at least 16 bytes. Without a sink, the encoding must fit in it and writing
+		/// past it fails with `ERR_OUT_OF_MEMORY`.
+		Writer(std::span<uint8_t> buffer, Sink sink = nullptr, void * context = nullptr);
+
+		Writer(Writer const& that) = delete;
+
+		/// The bytes still held in the buffer, which is everything written when there is no sink.
+		constexpr std::span<uint8_t const> buffered() const {
+			return this->buffer.first(this->used);
+		}
+
+		/// Hands any buffered bytes to the sink.
+		core::Error finish();
+
+		/// Total bytes encoded so far, including those already given to the sink.
+		constexpr size_t size() const {
+			return (this->flushed + this->used);
+		}
+
+		core::Error write(core::Variant const& value);
+	};
+
+	/// Decodes values written by `Writer`, either from memory or from a source that refills a
+	/// caller-owned buffer. Strings that straddle a refill are assembled in a scratch buffer that is
+	/// reused across reads.
+	class Reader final {
+		std::span<uint8_t const> window;
+
+		size_t position;
+
+		std::span<uint8_t> buffer;
+
+		Source source;
+
+		void * context;
+
+		std::vector<uint8_t> scratch;
+
+		bool started;
+
+		bool get_bytes(std::span<uint8_t> into);
+
+		bool get_string(godot_string * value);
+
+		bool get_varint(uint64_t& value);
+
+		bool plausible(uint64_t count, size_t minimum_size) const;
+
+		bool require(size_t byte_count);
+
+		core::Error get_value(godot_variant * value, uint32_t depth);
+
+		public:
+		Reader(std::span<uint8_t const> data);
+
+		Reader(std::span<uint8_t> buffer, Source source, void * context);
+
+		Reader(Reader const& that) = delete;
+
+		/// Replaces `value` with the next value in the stream. On failure `value` is left nil. A stream that
+		/// does not start with the expected header gives `ERR_FILE_UNRECOGNIZED`, one that ends cleanly
+		/// between values gives `ERR_FILE_EOF` and one that is truncated or malformed `ERR_INVALID_DATA`.
+		core::Error read(core::Variant& value);
+	};
+
+	/// Encodes a single value with its header into `out`.
+	core::Error encode(core::Variant const& value, core::PoolByteArray& out);
+
+	/// Decodes the first value of an encoded stream.
+	core::Error decode(std::span<uint8_t const> data, core::Variant& value);
+}
+
+#endif
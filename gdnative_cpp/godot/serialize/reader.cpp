@@ -0,0 +1,523 @@
+#include "godot/serialize.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace godot::serialize {
+	static constexpr uint8_t header[] = {'G', 'D', 'V', 'B', format_version};
+
+	// Most bytes a streamed container reserves ahead of the data that fills it.
+	static constexpr size_t streamed_reservation = (64 * 1024);
+
+	template<typename Type> static std::span<uint8_t> bytes_of(std::span<Type> const elements) {
+		return std::span<uint8_t>(reinterpret_cast<uint8_t *>(elements.data()), elements.size_bytes());
+	}
+
+	// Size to grow a container of `count` elements to once its first `filled` have been read. In memory the
+	// count was already checked against the data left, so it is reserved at once. From a source a corrupt
+	// count only shows when the data runs out, so the container doubles as elements arrive instead, and a
+	// bogus count costs no more than the data actually sent.
+	static uint64_t next_reservation(
+		bool const streamed,
+		uint64_t const count,
+		uint64_t const filled,
+		size_t const size
+	) {
+		if (!streamed) return count;
+
+		uint64_t const first = std::max<uint64_t>(1, (streamed_reservation / size));
+
+		return std::min(count, std::max((filled * 2), (filled + first)));
+	}
+
+	Reader::Reader(std::span<uint8_t const> data) :
+		window(data),
+		position(0),
+		buffer(),
+		source(nullptr),
+		context(nullptr),
+		started(false) { }
+
+	Reader::Reader(std::span<uint8_t> buffer, Source source, void * context) :
+		window(buffer.first(0)),
+		position(0),
+		buffer(buffer),
+		source(source),
+		context(context),
+		started(false) { }
+
+	bool Reader::get_bytes(std::span<uint8_t> into) {
+		while (true) {
+			size_t const count = std::min(into.size(), (this->window.size() - this->position));
+
+			std::memcpy(into.data(), (this->window.data() + this->position), count);
+
+			this->position += count;
+			into = into.subspan(count);
+
+			if (into.empty()) return true;
+
+			if (this->source == nullptr) return false;
+
+			if (into.size() >= this->buffer.size()) {
+				// The window is spent, so large blocks are filled straight from the source.
+				size_t const filled = this->source(this->context, into);
+
+				if (filled == 0) return false;
+
+				into = into.subspan(filled);
+
+				if (into.empty()) return true;
+			} else if (!this->require(into.size())) {
+				return false;
+			}
+		}
+	}
+
+	bool Reader::get_string(godot_string * value) {
+		uint64_t size;
+
+		if ((!this->get_varint(size)) || (!this->plausible(size, 1))) return false;
+
+		if (this->require(size)) {
+			*value = core::api_core->godot_string_chars_to_utf8_with_len(
+				reinterpret_cast<char const*>(this->window.data() + this->position),
+				static_cast<int>(size)
+			);
+
+			this->position += size;
+
+			return true;
+		}
+
+		for (uint64_t filled = 0; filled < size;) {
+			uint64_t const reserved = next_reservation((this->source != nullptr), size, filled, 1);
+
+			this->scratch.resize(reserved);
+
+			if (!this->get_bytes(std::span<uint8_t>(this->scratch).subspan(filled))) return false;
+
+			filled = reserved;
+		}
+
+		*value = core::api_core->godot_string_chars_to_utf8_with_len(
+			reinterpret_cast<char const*>(this->scratch.data()),
+			static_cast<int>(size)
+		);
+
+		return true;
+	}
+
+	bool Reader::get_varint(uint64_t& value) {
+		value = 0;
+
+		for (uint32_t shift = 0; shift < 64; shift += 7) {
+			if (!this->require(1)) return false;
+
+			uint8_t const byte = this->window[this->position];
+
+			this->position += 1;
+			value |= (static_cast<uint64_t>(byte & 0x7F) << shift);
+
+			if ((byte & 0x80) == 0) return true;
+		}
+
+		return false;
+	}
+
+	core::Error Reader::get_value(godot_variant * value, uint32_t depth) {
+		auto const raw = [this](auto& value) -> bool {
+			return this->get_bytes(std::span<uint8_t>(reinterpret_cast<uint8_t *>(&value), sizeof(value)));
+		};
+
+		auto const pool = [this](auto& pool) -> bool {
+			uint64_t count;
+
+			if ((!this->get_varint(count)) || (!this->plausible(count, sizeof(*pool.read().data())))) return false;
+
+			size_t const size = sizeof(*pool.read().data());
+
+			for (uint64_t filled = 0; filled < count;) {
+				uint64_t const reserved = next_reservation((this->source != nullptr), count, filled, size);
+
+				pool.resize(static_cast<int>(reserved));
+
+				if (!this->get_bytes(bytes_of(pool.write().span().subspan(filled)))) return false;
+
+				filled = reserved;
+			}
+
+			return true;
+		};
+
+		// `value` is uninitialized storage, so every path out of here must construct it.
+		auto const invalid = [value]() -> core::Error {
+			core::api_core->godot_variant_new_nil(value);
+
+			return core::Error::ERR_INVALID_DATA;
+		};
+
+		if (!this->require(1)) {
+			core::api_core->godot_variant_new_nil(value);
+
+			return ((depth == 0) ? core::Error::ERR_FILE_EOF : core::Error::ERR_INVALID_DATA);
+		}
+
+		Tag const tag = static_cast<Tag>(this->window[this->position]);
+
+		this->position += 1;
+
+		switch (tag) {
+			case Tag::NIL: {
+				core::api_core->godot_variant_new_nil(value);
+			} return core::Error::OK;
+
+			case Tag::BOOL_FALSE: {
+				core::api_core->godot_variant_new_bool(value, false);
+			} return core::Error::OK;
+
+			case Tag::BOOL_TRUE: {
+				core::api_core->godot_variant_new_bool(value, true);
+			} return core::Error::OK;
+
+			case Tag::INT: {
+				uint64_t zigzag;
+
+				if (!this->get_varint(zigzag)) break;
+
+				core::api_core->godot_variant_new_int(
+					value,
+					static_cast<int64_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1))
+				);
+			} return core::Error::OK;
+
+			case Tag::REAL32: {
+				float real;
+
+				if (!raw(real)) break;
+
+				core::api_core->godot_variant_new_real(value, real);
+			} return core::Error::OK;
+
+			case Tag::REAL64: {
+				double real;
+
+				if (!raw(real)) break;
+
+				core::api_core->godot_variant_new_real(value, real);
+			} return core::Error::OK;
+
+			case Tag::STRING: {
+				godot_string string;
+
+				if (!this->get_string(&string)) break;
+
+				core::api_core->godot_variant_new_string(value, &string);
+				core::api_core->godot_string_destroy(&string);
+			} return core::Error::OK;
+
+			case Tag::VECTOR2: {
+				godot_vector2 vector;
+
+				if (!raw(vector)) break;
+
+				core::api_core->godot_variant_new_vector2(value, &vector);
+			} return core::Error::OK;
+
+			case Tag::RECT2: {
+				godot_rect2 rect;
+
+				if (!raw(rect)) break;
+
+				core::api_core->godot_variant_new_rect2(value, &rect);
+			} return core::Error::OK;
+
+			case Tag::VECTOR3: {
+				godot_vector3 vector;
+
+				if (!raw(vector)) break;
+
+				core::api_core->godot_variant_new_vector3(value, &vector);
+			} return core::Error::OK;
+
+			case Tag::TRANSFORM2D: {
+				godot_transform2d transform;
+
+				if (!raw(transform)) break;
+
+				core::api_core->godot_variant_new_transform2d(value, &transform);
+			} return core::Error::OK;
+
+			case Tag::PLANE: {
+				godot_plane plane;
+
+				if (!raw(plane)) break;
+
+				core::api_core->godot_variant_new_plane(value, &plane);
+			} return core::Error::OK;
+
+			case Tag::QUAT: {
+				godot_quat quat;
+
+				if (!raw(quat)) break;
+
+				core::api_core->godot_variant_new_quat(value, &quat);
+			} return core::Error::OK;
+
+			case Tag::AABB: {
+				godot_aabb aabb;
+
+				if (!raw(aabb)) break;
+
+				core::api_core->godot_variant_new_aabb(value, &aabb);
+			} return core::Error::OK;
+
+			case Tag::BASIS: {
+				godot_basis basis;
+
+				if (!raw(basis)) break;
+
+				core::api_core->godot_variant_new_basis(value, &basis);
+			} return core::Error::OK;
+
+			case Tag::TRANSFORM: {
+				godot_transform transform;
+
+				if (!raw(transform)) break;
+
+				core::api_core->godot_variant_new_transform(value, &transform);
+			} return core::Error::OK;
+
+			case Tag::COLOR: {
+				godot_color color;
+
+				if (!raw(color)) break;
+
+				core::api_core->godot_variant_new_color(value, &color);
+			} return core::Error::OK;
+
+			case Tag::NODE_PATH: {
+				godot_string string;
+				godot_node_path path;
+
+				if (!this->get_string(&string)) break;
+
+				core::api_core->godot_node_path_new(&path, &string);
+				core::api_core->godot_variant_new_node_path(value, &path);
+				core::api_core->godot_node_path_destroy(&path);
+				core::api_core->godot_string_destroy(&string);
+			} return core::Error::OK;
+
+			case Tag::DICTIONARY: {
+				uint64_t count;
+
+				if (depth == max_depth) break;
+
+				if ((!this->get_varint(count)) || (!this->plausible(count, 2))) break;
+
+				core::Dictionary dictionary;
+
+				for (uint64_t i = 0; i < count; i += 1) {
+					godot_variant key, entry;
+
+					if (this->get_value((&key), (depth + 1)) != core::Error::OK) {
+						core::api_core->godot_variant_destroy(&key);
+
+						return invalid();
+					}
+
+					if (this->get_value((&entry), (depth + 1)) != core::Error::OK) {
+						core::api_core->godot_variant_destroy(&key);
+						core::api_core->godot_variant_destroy(&entry);
+
+						return invalid();
+					}
+
+					core::api_core->godot_dictionary_set(dictionary.handleof(), (&key), (&entry));
+					core::api_core->godot_variant_destroy(&key);
+					core::api_core->godot_variant_destroy(&entry);
+				}
+
+				core::api_core->godot_variant_new_dictionary(value, dictionary.handleof());
+			} return core::Error::OK;
+
+			case Tag::ARRAY: {
+				uint64_t count;
+
+				if (depth == max_depth) break;
+
+				if ((!this->get_varint(count)) || (!this->plausible(count, 1))) break;
+
+				core::Array array;
+				uint64_t reserved = 0;
+
+				// Elements decode straight into the array's own slots rather than being copied in.
+				for (uint64_t i = 0; i < count; i += 1) {
+					if (i == reserved) {
+						reserved = next_reservation((this->source != nullptr), count, i, sizeof(godot_variant));
+
+						array.resize(static_cast<int>(reserved));
+					}
+
+					godot_variant * const slot = core::api_core->godot_array_operator_index(
+						array.handleof(),
+						static_cast<godot_int>(i)
+					);
+
+					core::api_core->godot_variant_destroy(slot);
+
+					if (this->get_value(slot, (depth + 1)) != core::Error::OK) return invalid();
+				}
+
+				core::api_core->godot_variant_new_array(value, array.handleof());
+			} return core::Error::OK;
+
+			case Tag::POOL_BYTE_ARRAY: {
+				core::PoolByteArray bytes;
+
+				if (!pool(bytes)) break;
+
+				core::api_core->godot_variant_new_pool_byte_array(value, bytes.handleof());
+			} return core::Error::OK;
+
+			case Tag::POOL_INT_ARRAY: {
+				core::PoolIntArray ints;
+
+				if (!pool(ints)) break;
+
+				core::api_core->godot_variant_new_pool_int_array(value, ints.handleof());
+			} return core::Error::OK;
+
+			case Tag::POOL_REAL_ARRAY: {
+				core::PoolRealArray reals;
+
+				if (!pool(reals)) break;
+
+				core::api_core->godot_variant_new_pool_real_array(value, reals.handleof());
+			} return core::Error::OK;
+
+			case Tag::POOL_STRING_ARRAY: {
+				uint64_t count;
+
+				if ((!this->get_varint(count)) || (!this->plausible(count, 1))) break;
+
+				core::PoolStringArray strings;
+				bool parsed = true;
+
+				for (uint64_t filled = 0; parsed && (filled < count);) {
+					uint64_t const reserved = next_reservation(
+						(this->source != nullptr),
+						count,
+						filled,
+						sizeof(godot_string)
+					);
+
+					strings.resize(static_cast<int>(reserved));
+
+					core::PoolArrayWrite<core::String> const elements = strings.write();
+
+					for (; filled < reserved; filled += 1) {
+						godot_string string;
+
+						if (!this->get_string(&string)) {
+							parsed = false;
+
+							break;
+						}
+
+						core::api_core->godot_string_destroy(elements[filled].handleof());
+
+						*elements[filled].handleof() = string;
+					}
+				}
+
+				if (!parsed) break;
+
+				core::api_core->godot_variant_new_pool_string_array(value, strings.handleof());
+			} return core::Error::OK;
+
+			case Tag::POOL_VECTOR2_ARRAY: {
+				core::PoolVector2Array vectors;
+
+				if (!pool(vectors)) break;
+
+				core::api_core->godot_variant_new_pool_vector2_array(value, vectors.handleof());
+			} return core::Error::OK;
+
+			case Tag::POOL_VECTOR3_ARRAY: {
+				core::PoolVector3Array vectors;
+
+				if (!pool(vectors)) break;
+
+				core::api_core->godot_variant_new_pool_vector3_array(value, vectors.handleof());
+			} return core::Error::OK;
+
+			case Tag::POOL_COLOR_ARRAY: {
+				core::PoolColorArray colors;
+
+				if (!pool(colors)) break;
+
+				core::api_core->godot_variant_new_pool_color_array(value, colors.handleof());
+			} return core::Error::OK;
+		}
+
+		return invalid();
+	}
+
+	// Rejects counts that could not fit in an engine container, and in memory counts larger than the
+	// remaining data could hold, so a corrupt count fails before anything is allocated for it. Streamed
+	// counts are bounded by `next_reservation` instead.
+	bool Reader::plausible(uint64_t count, size_t minimum_size) const {
+		if (count > static_cast<uint64_t>(std::numeric_limits<int>::max())) return false;
+
+		return ((this->source != nullptr) || ((count * minimum_size) <= (this->window.size() - this->position)));
+	}
+
+	core::Error Reader::read(core::Variant& value) {
+		core::api_core->godot_variant_destroy(value.handleof());
+
+		if (!this->started) {
+			uint8_t opening[sizeof(header)] = {};
+
+			if ((!this->get_bytes(opening)) || (std::memcmp(opening, header, sizeof(header)) != 0)) {
+				core::api_core->godot_variant_new_nil(value.handleof());
+
+				return core::Error::ERR_FILE_UNRECOGNIZED;
+			}
+
+			this->started = true;
+		}
+
+		return this->get_value(value.handleof(), 0);
+	}
+
+	bool Reader::require(size_t byte_count) {
+		size_t remaining = (this->window.size() - this->position);
+
+		if (remaining >= byte_count) return true;
+
+		if ((this->source == nullptr) || (byte_count > this->buffer.size())) return false;
+
+		std::memmove(this->buffer.data(), (this->window.data() + this->position), remaining);
+
+		while (remaining < byte_count) {
+			size_t const filled = this->source(this->context, this->buffer.subspan(remaining));
+
+			if (filled == 0) break;
+
+			remaining += filled;
+		}
+
+		this->window = this->buffer.first(remaining);
+		this->position = 0;
+
+		return (remaining >= byte_count);
+	}
+
+	core::Error decode(std::span<uint8_t const> data, core::Variant& value) {
+		Reader reader = Reader(data);
+
+		return reader.read(value);
+	}
+}
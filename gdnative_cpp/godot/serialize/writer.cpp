@@ -0,0 +1,366 @@
+#include "godot/serialize.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace godot::serialize {
+	static constexpr uint8_t header[] = {'G', 'D', 'V', 'B', format_version};
+
+	template<typename Type> static std::span<uint8_t const> bytes_of(std::span<Type const> const elements) {
+		return std::span<uint8_t const>(reinterpret_cast<uint8_t const*>(elements.data()), elements.size_bytes());
+	}
+
+	Writer::Writer(
+		std::span<uint8_t> buffer,
+		Sink sink,
+		void * context
+	) : buffer(buffer), used(0), flushed(0), sink(sink), context(context), started(false) { }
+
+	bool Writer::drain() {
+		if (this->used == 0) return true;
+
+		if ((this->sink == nullptr) || (!this->sink(this->context, this->buffer.first(this->used)))) return false;
+
+		this->flushed += this->used;
+		this->used = 0;
+
+		return true;
+	}
+
+	core::Error Writer::finish() {
+		if ((this->sink != nullptr) && (!this->drain())) return core::Error::ERR_FILE_CANT_WRITE;
+
+		return core::Error::OK;
+	}
+
+	bool Writer::put_bytes(std::span<uint8_t const> bytes) {
+		if ((this->sink != nullptr) && (bytes.size() >= this->buffer.size())) {
+			// Large blocks skip the copy into the buffer entirely.
+			if ((!this->drain()) || (!this->sink(this->context, bytes))) return false;
+
+			this->flushed += bytes.size();
+
+			return true;
+		}
+
+		while (!bytes.empty()) {
+			if ((this->used == this->buffer.size()) && (!this->drain())) return false;
+
+			size_t const count = std::min(bytes.size(), (this->buffer.size() - this->used));
+
+			std::memcpy((this->buffer.data() + this->used), bytes.data(), count);
+
+			this->used += count;
+			bytes = bytes.subspan(count);
+		}
+
+		return true;
+	}
+
+	bool Writer::put_string(godot_string const* value) {
+		wchar_t const* const begin = core::api_core->godot_string_wide_str(value);
+		wchar_t const* const end = (begin + core::api_core->godot_string_length(value));
+		size_t size = 0;
+
+		for (wchar_t const* cursor = begin; cursor != end;) size += core::utf8_size(core::next_code_point(cursor, end));
+
+		if (!this->put_varint(size)) return false;
+
+		for (wchar_t const* cursor = begin; cursor != end;) {
+			if (!this->reserve(4)) return false;
+
+			this->used = static_cast<size_t>(
+				core::put_utf8((this->buffer.data() + this->used), core::next_code_point(cursor, end)) - this->buffer.data()
+			);
+		}
+
+		return true;
+	}
+
+	bool Writer::put_varint(uint64_t value) {
+		if (!this->reserve(10)) return false;
+
+		while (value >= 0x80) {
+			this->buffer[this->used] = static_cast<uint8_t>(value | 0x80);
+			this->used += 1;
+			value >>= 7;
+		}
+
+		this->buffer[this->used] = static_cast<uint8_t>(value);
+		this->used += 1;
+
+		return true;
+	}
+
+	core::Error Writer::put_value(godot_variant const* value, uint32_t depth) {
+		auto const tag = [this](Tag const tag) -> bool {
+			if (!this->reserve(1)) return false;
+
+			this->buffer[this->used] = static_cast<uint8_t>(tag);
+			this->used += 1;
+
+			return true;
+		};
+
+		auto const raw = [this, &tag](Tag const type, auto const& value) -> bool {
+			return (tag(type) && this->put_bytes(std::span<uint8_t const>(
+				reinterpret_cast<uint8_t const*>(&value),
+				sizeof(value)
+			)));
+		};
+
+		auto const pool = [this, &tag](Tag const type, auto const elements) -> bool {
+			return (tag(type) && this->put_varint(elements.size()) && this->put_bytes(bytes_of(elements)));
+		};
+
+		bool written = false;
+
+		switch (static_cast<core::Variant::Type>(core::api_core->godot_variant_get_type(value))) {
+			case core::Variant::TYPE_NIL:
+			case core::Variant::TYPE_RID:
+			case core::Variant::TYPE_OBJECT:
+			case core::Variant::TYPE_MAX: {
+				written = tag(Tag::NIL);
+			} break;
+
+			case core::Variant::TYPE_BOOL: {
+				written = tag(core::api_core->godot_variant_as_bool(value) ? Tag::BOOL_TRUE : Tag::BOOL_FALSE);
+			} break;
+
+			case core::Variant::TYPE_INT: {
+				int64_t const integer = core::api_core->godot_variant_as_int(value);
+
+				// Zigzag keeps small negative numbers as short as small positive ones.
+				written = (tag(Tag::INT) && this->put_varint(
+					(static_cast<uint64_t>(integer) << 1) ^ static_cast<uint64_t>(integer >> 63)
+				));
+			} break;
+
+			case core::Variant::TYPE_REAL: {
+				double const real = core::api_core->godot_variant_as_real(value);
+				float const single = static_cast<float>(real);
+
+				// Engine reals are doubles, but most hold values that came from single-precision math.
+				written = ((static_cast<double>(single) == real) ? raw(Tag::REAL32, single) : raw(Tag::REAL64, real));
+			} break;
+
+			case core::Variant::TYPE_STRING: {
+				core::String const string = core::String(core::api_core->godot_variant_as_string(value));
+
+				written = (tag(Tag::STRING) && this->put_string(string.handleof()));
+			} break;
+
+			case core::Variant::TYPE_VECTOR2: {
+				written = raw(Tag::VECTOR2, core::api_core->godot_variant_as_vector2(value));
+			} break;
+
+			case core::Variant::TYPE_RECT2: {
+				written = raw(Tag::RECT2, core::api_core->godot_variant_as_rect2(value));
+			} break;
+
+			case core::Variant::TYPE_VECTOR3: {
+				written = raw(Tag::VECTOR3, core::api_core->godot_variant_as_vector3(value));
+			} break;
+
+			case core::Variant::TYPE_TRANSFORM2D: {
+				written = raw(Tag::TRANSFORM2D, core::api_core->godot_variant_as_transform2d(value));
+			} break;
+
+			case core::Variant::TYPE_PLANE: {
+				written = raw(Tag::PLANE, core::api_core->godot_variant_as_plane(value));
+			} break;
+
+			case core::Variant::TYPE_QUAT: {
+				written = raw(Tag::QUAT, core::api_core->godot_variant_as_quat(value));
+			} break;
+
+			case core::Variant::TYPE_AABB: {
+				written = raw(Tag::AABB, core::api_core->godot_variant_as_aabb(value));
+			} break;
+
+			case core::Variant::TYPE_BASIS: {
+				written = raw(Tag::BASIS, core::api_core->godot_variant_as_basis(value));
+			} break;
+
+			case core::Variant::TYPE_TRANSFORM: {
+				written = raw(Tag::TRANSFORM, core::api_core->godot_variant_as_transform(value));
+			} break;
+
+			case core::Variant::TYPE_COLOR: {
+				written = raw(Tag::COLOR, core::api_core->godot_variant_as_color(value));
+			} break;
+
+			case core::Variant::TYPE_NODE_PATH: {
+				godot_node_path path = core::api_core->godot_variant_as_node_path(value);
+				core::String const string = core::String(core::api_core->godot_node_path_as_string(&path));
+
+				core::api_core->godot_node_path_destroy(&path);
+
+				written = (tag(Tag::NODE_PATH) && this->put_string(string.handleof()));
+			} break;
+
+			case core::Variant::TYPE_DICTIONARY: {
+				if (depth == max_depth) return core::Error::ERR_CYCLIC_LINK;
+
+				core::Dictionary const dictionary = core::Dictionary(core::api_core->godot_variant_as_dictionary(value));
+
+				if ((!tag(Tag::DICTIONARY)) || (!this->put_varint(static_cast<uint64_t>(dictionary.size())))) break;
+
+				godot_variant const* key = core::api_core->godot_dictionary_next(dictionary.handleof(), nullptr);
+
+				while (key != nullptr) {
+					core::Error error = this->put_value(key, (depth + 1));
+
+					if (error != core::Error::OK) return error;
+
+					error = this->put_value(
+						core::api_core->godot_dictionary_operator_index_const(dictionary.handleof(), key),
+						(depth + 1)
+					);
+
+					if (error != core::Error::OK) return error;
+
+					key = core::api_core->godot_dictionary_next(dictionary.handleof(), key);
+				}
+
+				written = true;
+			} break;
+
+			case core::Variant::TYPE_ARRAY: {
+				if (depth == max_depth) return core::Error::ERR_CYCLIC_LINK;
+
+				core::Array const array = core::Array(core::api_core->godot_variant_as_array(value));
+				int const size = array.size();
+
+				if ((!tag(Tag::ARRAY)) || (!this->put_varint(static_cast<uint64_t>(size)))) break;
+
+				for (int i = 0; i < size; i += 1) {
+					core::Error const error = this->put_value(
+						core::api_core->godot_array_operator_index_const(array.handleof(), i),
+						(depth + 1)
+					);
+
+					if (error != core::Error::OK) return error;
+				}
+
+				written = true;
+			} break;
+
+			case core::Variant::TYPE_POOL_RAW_ARRAY: {
+				written = pool(Tag::POOL_BYTE_ARRAY, core::PoolByteArray(
+					core::api_core->godot_variant_as_pool_byte_array(value)
+				).read().span());
+			} break;
+
+			case core::Variant::TYPE_POOL_INT_ARRAY: {
+				written = pool(Tag::POOL_INT_ARRAY, core::PoolIntArray(
+					core::api_core->godot_variant_as_pool_int_array(value)
+				).read().span());
+			} break;
+
+			case core::Variant::TYPE_POOL_REAL_ARRAY: {
+				written = pool(Tag::POOL_REAL_ARRAY, core::PoolRealArray(
+					core::api_core->godot_variant_as_pool_real_array(value)
+				).read().span());
+			} break;
+
+			case core::Variant::TYPE_POOL_STRING_ARRAY: {
+				core::PoolStringArray const strings = core::PoolStringArray(
+					core::api_core->godot_variant_as_pool_string_array(value)
+				);
+
+				core::PoolArrayRead<core::String> const elements = strings.read();
+
+				if ((!tag(Tag::POOL_STRING_ARRAY)) || (!this->put_varint(elements.size()))) break;
+
+				written = std::all_of(elements.begin(), elements.end(), [this](core::String const& element) {
+					return this->put_string(element.handleof());
+				});
+			} break;
+
+			case core::Variant::TYPE_POOL_VECTOR2_ARRAY: {
+				written = pool(Tag::POOL_VECTOR2_ARRAY, core::PoolVector2Array(
+					core::api_core->godot_variant_as_pool_vector2_array(value)
+				).read().span());
+			} break;
+
+			case core::Variant::TYPE_POOL_VECTOR3_ARRAY: {
+				written = pool(Tag::POOL_VECTOR3_ARRAY, core::PoolVector3Array(
+					core::api_core->godot_variant_as_pool_vector3_array(value)
+				).read().span());
+			} break;
+
+			case core::Variant::TYPE_POOL_COLOR_ARRAY: {
+				written = pool(Tag::POOL_COLOR_ARRAY, core::PoolColorArray(
+					core::api_core->godot_variant_as_pool_color_array(value)
+				).read().span());
+			} break;
+		}
+
+		if (written) return core::Error::OK;
+
+		return ((this->sink == nullptr) ? core::Error::ERR_OUT_OF_MEMORY : core::Error::ERR_FILE_CANT_WRITE);
+	}
+
+	bool Writer::reserve(size_t byte_count) {
+		if ((this->used + byte_count) <= this->buffer.size()) return true;
+
+		return (this->drain() && (byte_count <= this->buffer.size()));
+	}
+
+	core::Error Writer::write(core::Variant const& value) {
+		if (!this->started) {
+			if (!this->put_bytes(header)) {
+				return ((this->sink == nullptr) ? core::Error::ERR_OUT_OF_MEMORY : core::Error::ERR_FILE_CANT_WRITE);
+			}
+
+			this->started = true;
+		}
+
+		return this->put_value(value.handleof(), 0);
+	}
+
+	struct PoolSink {
+		core::PoolByteArray * out;
+
+		size_t size;
+	};
+
+	// Grows the pool geometrically so encoding a large tree costs a logarithmic number of reallocations.
+	static bool append_to_pool(void * context, std::span<uint8_t const> bytes) {
+		PoolSink * const sink = static_cast<PoolSink *>(context);
+		size_t const required = (sink->size + bytes.size());
+
+		if (required > static_cast<size_t>(std::numeric_limits<int>::max())) return false;
+
+		if (required > static_cast<size_t>(sink->out->size())) {
+			sink->out->resize(static_cast<int>(std::min(
+				std::max((static_cast<size_t>(sink->out->size()) * 2), required),
+				static_cast<size_t>(std::numeric_limits<int>::max())
+			)));
+		}
+
+		std::memcpy((sink->out->write().data() + sink->size), bytes.data(), bytes.size());
+
+		sink->size = required;
+
+		return true;
+	}
+
+	core::Error encode(core::Variant const& value, core::PoolByteArray& out) {
+		uint8_t buffer[16384];
+		PoolSink sink = PoolSink{(&out), 0};
+		Writer writer = Writer(buffer, append_to_pool, (&sink));
+
+		out.resize(0);
+
+		core::Error error = writer.write(value);
+
+		if (error == core::Error::OK) error = writer.finish();
+
+		out.resize((error == core::Error::OK) ? static_cast<int>(sink.size) : 0);
+
+		return error;
+	}
+}
@@ -0,0 +1,257 @@
+#ifndef GODOT_SIMD_H
+#define GODOT_SIMD_H
+
+#include "godot/core.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define GODOT_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace godot::simd {
+	/// Four `real_t` lanes. Uses SSE2 where the target has it and plain arrays otherwise, so batch kernels
+	/// are written once against this type and the scalar build stays correct.
+#ifdef GODOT_SIMD_SSE2
+	static_assert(std::is_same_v<core::real_t, float>, "SSE2 lanes require single-precision real_t");
+
+	struct Float4 {
+		__m128 lanes;
+	};
+
+	inline Float4 load(core::real_t const* source) {
+		return Float4{_mm_loadu_ps(source)};
+	}
+
+	inline void store(core::real_t * destination, Float4 const value) {
+		_mm_storeu_ps(destination, value.lanes);
+	}
+
+	inline Float4 splat(core::real_t const value) {
+		return Float4{_mm_set1_ps(value)};
+	}
+
+	inline Float4 set(core::real_t const a, core::real_t const b, core::real_t const c, core::real_t const d) {
+		return Float4{_mm_setr_ps(a, b, c, d)};
+	}
+
+	inline Float4 operator+(Float4 const a, Float4 const b) {
+		return Float4{_mm_add_ps(a.lanes, b.lanes)};
+	}
+
+	inline Float4 operator-(Float4 const a, Float4 const b) {
+		return Float4{_mm_sub_ps(a.lanes, b.lanes)};
+	}
+
+	inline Float4 operator*(Float4 const a, Float4 const b) {
+		return Float4{_mm_mul_ps(a.lanes, b.lanes)};
+	}
+
+	inline Float4 operator/(Float4 const a, Float4 const b) {
+		return Float4{_mm_div_ps(a.lanes, b.lanes)};
+	}
+
+	inline Float4 min(Float4 const a, Float4 const b) {
+		return Float4{_mm_min_ps(a.lanes, b.lanes)};
+	}
+
+	inline Float4 max(Float4 const a, Float4 const b) {
+		return Float4{_mm_max_ps(a.lanes, b.lanes)};
+	}
+
+	inline Float4 abs(Float4 const a) {
+		return Float4{_mm_andnot_ps(_mm_set1_ps(-0.f), a.lanes)};
+	}
+
+	inline Float4 sqrt(Float4 const a) {
+		return Float4{_mm_sqrt_ps(a.lanes)};
+	}
+
+	/// Hardware estimate refined with one Newton-Raphson step, giving roughly 22 bits of precision.
+	inline Float4 rsqrt(Float4 const a) {
+		__m128 const estimate = _mm_rsqrt_ps(a.lanes);
+
+		return Float4{_mm_mul_ps(
+			_mm_mul_ps(_mm_set1_ps(0.5f), estimate),
+			_mm_sub_ps(_mm_set1_ps(3.f), _mm_mul_ps(_mm_mul_ps(a.lanes, estimate), estimate))
+		)};
+	}
+
+	/// Nearest integer with halves rounded away from zero, for lanes within the `int32_t` range.
+	inline Float4 round(Float4 const a) {
+		__m128 const half = _mm_or_ps(_mm_and_ps(a.lanes, _mm_set1_ps(-0.f)), _mm_set1_ps(0.5f));
+
+		return Float4{_mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(a.lanes, half)))};
+	}
+
+	/// All bits set in lanes where `a < b`.
+	inline Float4 less(Float4 const a, Float4 const b) {
+		return Float4{_mm_cmplt_ps(a.lanes, b.lanes)};
+	}
+
+	inline Float4 equal(Float4 const a, Float4 const b) {
+		return Float4{_mm_cmpeq_ps(a.lanes, b.lanes)};
+	}
+
+	/// Picks `a` in lanes where `mask` is set and `b` elsewhere.
+	inline Float4 select(Float4 const mask, Float4 const a, Float4 const b) {
+		return Float4{_mm_or_ps(_mm_and_ps(mask.lanes, a.lanes), _mm_andnot_ps(mask.lanes, b.lanes))};
+	}
+
+	/// Copies the sign of `sign` onto `a`, flipping lanes where `sign` is negative.
+	inline Float4 xor_sign(Float4 const a, Float4 const sign) {
+		return Float4{_mm_xor_ps(a.lanes, _mm_and_ps(sign.lanes, _mm_set1_ps(-0.f)))};
+	}
+#else
+	struct Float4 {
+		core::real_t lanes[4];
+	};
+
+	inline Float4 load(core::real_t const* source) {
+		return Float4{{source[0], source[1], source[2], source[3]}};
+	}
+
+	inline void store(core::real_t * destination, Float4 const value) {
+		for (int i = 0; i < 4; i += 1) destination[i] = value.lanes[i];
+	}
+
+	inline Float4 splat(core::real_t const value) {
+		return Float4{{value, value, value, value}};
+	}
+
+	inline Float4 set(core::real_t const a, core::real_t const b, core::real_t const c, core::real_t const d) {
+		return Float4{{a, b, c, d}};
+	}
+
+	template<typename Operation> inline Float4 lanewise(
+		Float4 const a,
+		Float4 const b,
+		Operation const& operation
+	) {
+		return Float4{{
+			operation(a.lanes[0], b.lanes[0]),
+			operation(a.lanes[1], b.lanes[1]),
+			operation(a.lanes[2], b.lanes[2]),
+			operation(a.lanes[3], b.lanes[3])
+		}};
+	}
+
+	inline Float4 operator+(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) { return (x + y); });
+	}
+
+	inline Float4 operator-(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) { return (x - y); });
+	}
+
+	inline Float4 operator*(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) { return (x * y); });
+	}
+
+	inline Float4 operator/(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) { return (x / y); });
+	}
+
+	inline Float4 min(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) { return ((y < x) ? y : x); });
+	}
+
+	inline Float4 max(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) { return ((x < y) ? y : x); });
+	}
+
+	inline Float4 abs(Float4 const a) {
+		return lanewise(a, a, [](core::real_t x, core::real_t) { return std::fabs(x); });
+	}
+
+	inline Float4 sqrt(Float4 const a) {
+		return lanewise(a, a, [](core::real_t x, core::real_t) { return std::sqrt(x); });
+	}
+
+	inline Float4 rsqrt(Float4 const a) {
+		return lanewise(a, a, [](core::real_t x, core::real_t) { return (1.f / std::sqrt(x)); });
+	}
+
+	inline Float4 round(Float4 const a) {
+		return lanewise(a, a, [](core::real_t x, core::real_t) {
+			return static_cast<core::real_t>(static_cast<int32_t>(x + ((x < 0) ? -0.5f : 0.5f)));
+		});
+	}
+
+	inline Float4 less(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) {
+			return ((x < y) ? core::real_t(1) : core::real_t(0));
+		});
+	}
+
+	inline Float4 equal(Float4 const a, Float4 const b) {
+		return lanewise(a, b, [](core::real_t x, core::real_t y) {
+			return ((x == y) ? core::real_t(1) : core::real_t(0));
+		});
+	}
+
+	inline Float4 select(Float4 const mask, Float4 const a, Float4 const b) {
+		return Float4{{
+			((mask.lanes[0] != 0) ? a.lanes[0] : b.lanes[0]),
+			((mask.lanes[1] != 0) ? a.lanes[1] : b.lanes[1]),
+			((mask.lanes[2] != 0) ? a.lanes[2] : b.lanes[2]),
+			((mask.lanes[3] != 0) ? a.lanes[3] : b.lanes[3])
+		}};
+	}
+
+	inline Float4 xor_sign(Float4 const a, Float4 const sign) {
+		return lanewise(a, sign, [](core::real_t x, core::real_t y) { return (std::signbit(y) ? -x : x); });
+	}
+#endif
+
+	/// `a * b + c`, left unfused so results match the scalar path.
+	inline Float4 multiply_add(Float4 const a, Float4 const b, Float4 const c) {
+		return ((a * b) + c);
+	}
+
+	/// Lanewise `math::fast_sin`, with the same reduction and polynomial.
+	inline Float4 sin(Float4 const angle) {
+		Float4 const multiple = round(angle * splat(1.f / core::PI));
+		Float4 const r = ((angle - (multiple * splat(3.140625f))) - (multiple * splat(9.67653589793e-4f)));
+		Float4 const r2 = (r * r);
+
+		Float4 polynomial = multiply_add(r2, splat(-2.50521084e-8f), splat(2.75573192e-6f));
+
+		polynomial = multiply_add(r2, polynomial, splat(-1.98412698e-4f));
+		polynomial = multiply_add(r2, polynomial, splat(8.33333333e-3f));
+		polynomial = multiply_add(r2, polynomial, splat(-1.66666667e-1f));
+		polynomial = multiply_add(r2, polynomial, splat(1.f));
+
+		Float4 const sine = (r * polynomial);
+		Float4 const half = (multiple * splat(0.5f));
+
+		// Odd multiples of a half turn flip the sign; their halves are not whole.
+		return select(equal(round(half), half), sine, xor_sign(sine, splat(-1.f)));
+	}
+
+	/// Arccosine of lanes in [-1, 1], within 3.1e-7 radians of the exact value. Evaluates the arcsine polynomial
+	/// on [0, 0.5], reaching larger cosines through acos(c) = 2 asin(sqrt((1 - c) / 2)), which stays precise
+	/// near 1 where the octant-reduced `math::fast_atan2` loses relative accuracy.
+	inline Float4 acos(Float4 const cosine) {
+		Float4 const half = splat(0.5f);
+		Float4 const magnitude = abs(cosine);
+		Float4 const large = less(half, magnitude);
+		Float4 const z = select(large, sqrt(max(splat(0), (half - (half * magnitude)))), magnitude);
+		Float4 const z2 = (z * z);
+
+		Float4 polynomial = multiply_add(z2, splat(4.2163199048e-2f), splat(2.4181311049e-2f));
+
+		polynomial = multiply_add(z2, polynomial, splat(4.5470025998e-2f));
+		polynomial = multiply_add(z2, polynomial, splat(7.4953002686e-2f));
+		polynomial = multiply_add(z2, polynomial, splat(1.6666752422e-1f));
+
+		Float4 const arcsine = multiply_add((z2 * z), polynomial, z);
+		Float4 const angle = select(large, (arcsine + arcsine), (splat(core::PI * 0.5f) - arcsine));
+
+		return select(less(cosine, splat(0)), (splat(core::PI) - angle), angle);
+	}
+}
+
+#endif
@@ -0,0 +1,244 @@
+#include "godot/batch.hpp"
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// The color conversion kernels against `Color` and the exact sRGB curves, in every channel order, over sizes
+// that leave every tail length, with out-of-range and NaN channels mixed in.
+
+using namespace godot;
+
+using batch::ChannelOrder;
+using core::Color;
+using core::real_t;
+
+static std::mt19937 random_engine = std::mt19937(32);
+
+static real_t random_between(real_t const low, real_t const high) {
+	return std::uniform_real_distribution<real_t>(low, high)(random_engine);
+}
+
+static std::vector<Color> random_colors(size_t const size, real_t const low, real_t const high) {
+	std::vector<Color> colors = std::vector<Color>(size);
+
+	for (Color& color : colors) {
+		color = Color::of(
+			random_between(low, high),
+			random_between(low, high),
+			random_between(low, high),
+			random_between(low, high)
+		);
+	}
+
+	return colors;
+}
+
+static double exact_to_linear(double const channel) {
+	return ((channel < 0.04045) ? (channel / 12.92) : std::pow(((channel + 0.055) / 1.055), 2.4));
+}
+
+static double exact_to_srgb(double const channel) {
+	return ((channel < 0.0031308) ? (12.92 * channel) : ((1.055 * std::pow(channel, (1 / 2.4))) - 0.055));
+}
+
+static ChannelOrder const orders[] = {
+	ChannelOrder::RGBA,
+	ChannelOrder::ARGB,
+	ChannelOrder::ABGR,
+	ChannelOrder::BGRA,
+};
+
+// The packed integer `Color` would produce for the same bytes, or `BGRA` bytes read as `RGBA`.
+static uint32_t packed_of(Color const& color, ChannelOrder const order) {
+	switch (order) {
+		case ChannelOrder::ARGB: return color.to_argb32();
+		case ChannelOrder::ABGR: return color.to_abgr32();
+		case ChannelOrder::BGRA: return Color::of(color.b, color.g, color.r, color.a).to_rgba32();
+		default: return color.to_rgba32();
+	}
+}
+
+static uint32_t packed_at(std::vector<uint8_t> const& bytes, size_t const index) {
+	uint8_t const* at = (&bytes[(index * 4)]);
+
+	return ((uint32_t(at[0]) << 24) | (uint32_t(at[1]) << 16) | (uint32_t(at[2]) << 8) | uint32_t(at[3]));
+}
+
+static size_t const sizes[] = {1, 2, 3, 4, 5, 7, 8, 13, 66, 1001};
+
+static void test_blend_and_interpolate() {
+	for (size_t const size : sizes) {
+		std::vector<Color> const under = random_colors(size, 0, 1);
+		std::vector<Color> over = random_colors(size, 0, 1);
+		std::vector<Color> blended = std::vector<Color>(size);
+		std::vector<Color> interpolated = std::vector<Color>(size);
+
+		// Fully transparent pairs, whose blend is transparent black rather than a division by zero.
+		for (size_t i = 2; i < size; i += 5) over[i].a = 0;
+
+		std::vector<Color> transparent = under;
+
+		for (size_t i = 2; i < size; i += 5) transparent[i].a = 0;
+
+		batch::blend(transparent, over, blended);
+		batch::linear_interpolate(under, over, 0.3f, interpolated);
+
+		for (size_t i = 0; i < size; i += 1) {
+			GD_CHECK(blended[i] == transparent[i].blend(over[i]));
+			GD_CHECK(interpolated[i] == under[i].linear_interpolate(over[i], 0.3f));
+		}
+	}
+}
+
+static void test_pack_and_unpack() {
+	real_t const nan = std::numeric_limits<real_t>::quiet_NaN();
+
+	for (size_t const size : sizes) {
+		std::vector<Color> const colors = random_colors(size, 0, 1);
+		std::vector<Color> wild = random_colors(size, -2, 3);
+
+		for (size_t i = 1; i < size; i += 3) wild[i].g = nan;
+
+		for (ChannelOrder const order : orders) {
+			std::vector<uint8_t> bytes = std::vector<uint8_t>(size * 4);
+			std::vector<uint8_t> wild_bytes = std::vector<uint8_t>(size * 4);
+			std::vector<Color> unpacked = std::vector<Color>(size);
+
+			batch::pack_rgba8(colors, order, bytes);
+			batch::pack_rgba8(wild, order, wild_bytes);
+			batch::unpack_rgba8(bytes, order, unpacked);
+
+			for (size_t i = 0; i < size; i += 1) {
+				uint32_t const packed = packed_of(colors[i], order);
+
+				// Saturated, with NaN on zero, where `Color` would wrap.
+				Color const clamped = Color::of(
+					std::clamp(wild[i].r, 0.f, 1.f),
+					(std::isnan(wild[i].g) ? 0 : std::clamp(wild[i].g, 0.f, 1.f)),
+					std::clamp(wild[i].b, 0.f, 1.f),
+					std::clamp(wild[i].a, 0.f, 1.f)
+				);
+
+				GD_CHECK(packed_at(bytes, i) == packed);
+				GD_CHECK(packed_at(wild_bytes, i) == packed_of(clamped, order));
+				GD_CHECK(unpacked[i] == Color::from_rgba(colors[i].to_rgba32()));
+			}
+		}
+	}
+
+	// Pool arrays, and spans too short for every color, which are left alone past the last whole one.
+	std::vector<Color> const colors = random_colors(9, 0, 1);
+	core::PoolColorArray pool;
+
+	pool.resize(static_cast<int>(colors.size()));
+	std::copy(colors.begin(), colors.end(), pool.write().span().begin());
+
+	core::PoolByteArray const pool_bytes = batch::pack_rgba8(pool, ChannelOrder::RGBA);
+
+	GD_CHECK(pool_bytes.size() == 36);
+	GD_CHECK(batch::unpack_rgba8(pool_bytes, ChannelOrder::RGBA).size() == 9);
+
+	std::vector<uint8_t> bytes = std::vector<uint8_t>(23, 7);
+	std::vector<Color> unpacked = std::vector<Color>(9, Color::of(2, 2, 2, 2));
+
+	batch::pack_rgba8(colors, ChannelOrder::RGBA, bytes);
+	batch::unpack_rgba8(bytes, ChannelOrder::RGBA, unpacked);
+
+	GD_CHECK(packed_at(bytes, 4) == colors[4].to_rgba32());
+	GD_CHECK((bytes[20] == 7) && (bytes[22] == 7));
+	GD_CHECK(unpacked[4] == Color::from_rgba(colors[4].to_rgba32()));
+	GD_CHECK(unpacked[5] == Color::of(2, 2, 2, 2));
+}
+
+static void test_srgb() {
+	double worst_linear = 0;
+	double worst_srgb = 0;
+	double worst_decode = 0;
+	int worst_step = 0;
+
+	for (size_t const size : sizes) {
+		std::vector<Color> colors = random_colors(size, 0, 1);
+
+		// The ends of both curves, the linear segment, and a few values outside [0, 1].
+		colors[0] = Color::of(0, 1, 0.002f, 0.5f);
+
+		if (size > 3) colors[3] = Color::of(-0.25f, 1.5f, 0.04f, 2);
+
+		std::vector<Color> linear = std::vector<Color>(size);
+		std::vector<Color> encoded = std::vector<Color>(size);
+
+		batch::to_linear(colors, linear);
+		batch::to_srgb(colors, encoded);
+
+		for (size_t i = 0; i < size; i += 1) {
+			real_t const* from = (&colors[i].r);
+
+			for (size_t c = 0; c < 3; c += 1) {
+				worst_linear = std::max(worst_linear, std::fabs((&linear[i].r)[c] - exact_to_linear(from[c])));
+				worst_srgb = std::max(worst_srgb, std::fabs((&encoded[i].r)[c] - exact_to_srgb(from[c])));
+			}
+
+			GD_CHECK(linear[i].a == colors[i].a);
+			GD_CHECK(encoded[i].a == colors[i].a);
+		}
+
+		for (ChannelOrder const order : orders) {
+			std::vector<uint8_t> bytes = std::vector<uint8_t>(size * 4);
+			std::vector<Color> decoded = std::vector<Color>(size);
+			std::vector<uint8_t> exact = std::vector<uint8_t>(size * 4);
+			std::vector<Color> exact_colors = colors;
+
+			for (Color& color : exact_colors) {
+				for (size_t c = 0; c < 3; c += 1) {
+					(&color.r)[c] = static_cast<real_t>(exact_to_srgb(std::clamp((&color.r)[c], 0.f, 1.f)));
+				}
+			}
+
+			batch::pack_srgb8(colors, order, bytes);
+			batch::pack_rgba8(exact_colors, order, exact);
+			batch::unpack_srgb8(bytes, order, decoded);
+
+			for (size_t i = 0; i < bytes.size(); i += 1) {
+				worst_step = std::max(worst_step, std::abs(bytes[i] - exact[i]));
+			}
+
+			std::vector<Color> bytes_as_colors = std::vector<Color>(size);
+
+			batch::unpack_rgba8(bytes, order, bytes_as_colors);
+
+			for (size_t i = 0; i < size; i += 1) {
+				for (size_t c = 0; c < 3; c += 1) {
+					double const expected = exact_to_linear((&bytes_as_colors[i].r)[c]);
+
+					worst_decode = std::max(worst_decode, std::fabs((&decoded[i].r)[c] - expected));
+				}
+
+				GD_CHECK(decoded[i].a == bytes_as_colors[i].a);
+			}
+		}
+	}
+
+	// The documented bounds, plus the float rounding of the exact curves outside the tables.
+	GD_CHECK(worst_linear <= 6e-7);
+	GD_CHECK(worst_srgb <= 5e-6);
+	GD_CHECK(worst_step <= 1);
+	GD_CHECK(worst_decode <= 1e-6);
+}
+
+int main() {
+	mock::install();
+
+	test_blend_and_interpolate();
+	test_pack_and_unpack();
+	test_srgb();
+
+	GD_CHECK(mock::live_buffers() == 0);
+
+	return test::finish();
+}
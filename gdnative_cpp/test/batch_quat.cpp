@@ -0,0 +1,258 @@
+#include "godot/batch.hpp"
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// The quaternion kernels against `Quat` applied per element, over sizes that leave every tail length, with
+// near-parallel and opposite inputs mixed in, and with views of different lengths.
+
+using namespace godot;
+
+using core::Quat;
+using core::real_t;
+
+static std::mt19937 random_engine = std::mt19937(28);
+
+static Quat random_rotation() {
+	std::normal_distribution<real_t> component = std::normal_distribution<real_t>(0, 1);
+
+	return Quat::of(
+		component(random_engine),
+		component(random_engine),
+		component(random_engine),
+		component(random_engine)
+	).normalized();
+}
+
+// Structure-of-arrays storage, with the lanes kept in vectors of their own so a test can shorten one.
+struct Lanes {
+	std::vector<real_t> x, y, z, w;
+
+	static Lanes of(size_t const size, real_t const fill) {
+		std::vector<real_t> const lane = std::vector<real_t>(size, fill);
+
+		return Lanes{lane, lane, lane, lane};
+	}
+
+	static Lanes of(std::vector<Quat> const& quats) {
+		Lanes lanes = of(quats.size(), 0);
+
+		batch::gather(quats, lanes.span());
+
+		return lanes;
+	}
+
+	batch::QuatSpan span() {
+		return batch::QuatSpan{this->x, this->y, this->z, this->w};
+	}
+
+	std::vector<Quat> quats() const {
+		std::vector<Quat> quats = std::vector<Quat>(this->x.size());
+
+		batch::scatter(batch::QuatConstSpan{this->x, this->y, this->z, this->w}, quats);
+
+		return quats;
+	}
+};
+
+// Pairs with every fourth `b` close to `a`, and every seventh close to its opposite, so whole blocks and
+// tails both mix the spherical and linear branches.
+static void make_pairs(size_t const size, std::vector<Quat>& a, std::vector<Quat>& b) {
+	std::normal_distribution<real_t> nudge = std::normal_distribution<real_t>(0, 1e-4f);
+
+	a.resize(size);
+	b.resize(size);
+
+	for (size_t i = 0; i < size; i += 1) {
+		a[i] = random_rotation();
+
+		if ((i % 4) == 1) {
+			b[i] = Quat::of((a[i].x + nudge(random_engine)), a[i].y, a[i].z, a[i].w).normalized();
+		} else if ((i % 7) == 3) {
+			b[i] = Quat::of(-a[i].x, -a[i].y, (nudge(random_engine) - a[i].z), -a[i].w).normalized();
+		} else {
+			b[i] = random_rotation();
+		}
+	}
+}
+
+static real_t component_error(Quat const& a, Quat const& b) {
+	return std::max({std::fabs(a.x - b.x), std::fabs(a.y - b.y), std::fabs(a.z - b.z), std::fabs(a.w - b.w)});
+}
+
+// Angle of the rotation between two quaternions, for either sign of `b`. Going through the chord in double
+// keeps it accurate for small angles, where an arccosine of the dot product would be dominated by rounding.
+static double radians_between(Quat const& a, Quat const& b) {
+	double const from[4] = {a.x, a.y, a.z, a.w};
+	double const to[4] = {b.x, b.y, b.z, b.w};
+	double from_length = 0, to_length = 0, dot = 0;
+
+	for (int i = 0; i < 4; i += 1) {
+		from_length += (from[i] * from[i]);
+		to_length += (to[i] * to[i]);
+		dot += (from[i] * to[i]);
+	}
+
+	double const sign = ((dot < 0) ? -1 : 1);
+	double chord = 0;
+
+	for (int i = 0; i < 4; i += 1) {
+		double const difference = ((from[i] / std::sqrt(from_length)) - ((sign * to[i]) / std::sqrt(to_length)));
+
+		chord += (difference * difference);
+	}
+
+	return (4 * std::asin(std::sqrt(chord) / 2));
+}
+
+static Quat nlerp_of(Quat const& a, Quat const& b, real_t const t) {
+	Quat const to = ((a.dot(b) < 0) ? (b * -1) : b);
+
+	return (a + ((to - a) * t)).normalized();
+}
+
+static size_t const sizes[] = {1, 2, 3, 4, 5, 7, 8, 13, 67, 1001};
+
+static real_t const weights[] = {0, 0.1f, 0.37f, 0.5f, 0.9f, 1};
+
+static void test_slerp() {
+	real_t worst = 0;
+
+	for (size_t const size : sizes) {
+		std::vector<Quat> a, b;
+
+		make_pairs(size, a, b);
+
+		Lanes from = Lanes::of(a);
+		Lanes to = Lanes::of(b);
+
+		for (real_t const t : weights) {
+			Lanes out = Lanes::of(size, 0);
+
+			batch::slerp(from.span(), to.span(), t, out.span());
+
+			std::vector<Quat> const result = out.quats();
+
+			for (size_t i = 0; i < size; i += 1) {
+				worst = std::max(worst, component_error(result[i], a[i].slerp(b[i], t)));
+			}
+		}
+	}
+
+	GD_CHECK(worst <= 4e-7f);
+}
+
+static void test_nlerp() {
+	real_t worst = 0;
+	double worst_corrected = 0;
+
+	for (size_t const size : sizes) {
+		std::vector<Quat> a, b;
+
+		make_pairs(size, a, b);
+
+		Lanes from = Lanes::of(a);
+		Lanes to = Lanes::of(b);
+
+		for (real_t const t : weights) {
+			Lanes out = Lanes::of(size, 0);
+			Lanes corrected = Lanes::of(size, 0);
+
+			batch::nlerp(from.span(), to.span(), t, out.span());
+			batch::nlerp_corrected(from.span(), to.span(), t, corrected.span());
+
+			std::vector<Quat> const result = out.quats();
+			std::vector<Quat> const corrected_result = corrected.quats();
+
+			for (size_t i = 0; i < size; i += 1) {
+				worst = std::max(worst, component_error(result[i], nlerp_of(a[i], b[i], t)));
+				worst_corrected = std::max(worst_corrected, radians_between(corrected_result[i], a[i].slerp(b[i], t)));
+			}
+		}
+	}
+
+	// The reciprocal square root is refined to about float precision, not correctly rounded.
+	GD_CHECK(worst <= 1e-6f);
+	GD_CHECK(worst_corrected <= 8e-4);
+}
+
+static void test_cubic_slerp() {
+	real_t worst = 0;
+
+	for (size_t const size : sizes) {
+		std::vector<Quat> a, b, pre_a, post_b;
+
+		make_pairs(size, a, b);
+		make_pairs(size, pre_a, post_b);
+
+		Lanes from = Lanes::of(a);
+		Lanes to = Lanes::of(b);
+		Lanes before = Lanes::of(pre_a);
+		Lanes after = Lanes::of(post_b);
+
+		for (real_t const t : weights) {
+			Lanes out = Lanes::of(size, 0);
+
+			batch::cubic_slerp(from.span(), to.span(), before.span(), after.span(), t, out.span());
+
+			std::vector<Quat> const result = out.quats();
+
+			for (size_t i = 0; i < size; i += 1) {
+				worst = std::max(worst, component_error(result[i], a[i].cubic_slerp(b[i], pre_a[i], post_b[i], t)));
+			}
+		}
+	}
+
+	GD_CHECK(worst <= 3e-4f);
+}
+
+// Kernels stop at the shortest lane of any view and leave the rest of the output as it was.
+static void test_mismatched_views() {
+	std::vector<Quat> a, b;
+
+	make_pairs(9, a, b);
+
+	Lanes from = Lanes::of(a);
+	Lanes to = Lanes::of(b);
+	Lanes out = Lanes::of(11, 5);
+
+	to.w.resize(6);
+
+	batch::slerp(from.span(), to.span(), 0.5f, out.span());
+	batch::nlerp(from.span(), to.span(), 0.5f, out.span());
+	batch::nlerp_corrected(from.span(), to.span(), 0.5f, out.span());
+	batch::cubic_slerp(from.span(), to.span(), from.span(), to.span(), 0.5f, out.span());
+
+	std::vector<Quat> const result = out.quats();
+
+	for (size_t i = 0; i < result.size(); i += 1) GD_CHECK((i < 6) == (result[i] != Quat::of(5, 5, 5, 5)));
+
+	std::vector<Quat> short_out = std::vector<Quat>(3);
+
+	batch::scatter(from.span(), short_out);
+
+	GD_CHECK(std::equal(short_out.begin(), short_out.end(), a.begin()));
+
+	Lanes long_out = Lanes::of(20, 5);
+
+	batch::gather(a, long_out.span());
+
+	GD_CHECK(long_out.x[8] == a[8].x);
+	GD_CHECK(long_out.x[9] == 5);
+}
+
+int main() {
+	mock::install();
+
+	test_slerp();
+	test_nlerp();
+	test_cubic_slerp();
+	test_mismatched_views();
+
+	return test::finish();
+}
@@ -0,0 +1,228 @@
+#include "godot/batch.hpp"
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// The HSV and recolor kernels against the `Color` methods they batch, over sizes that leave every tail length
+// and hues outside the fast range, and `map_colors` against tables and palettes, including NaN and short spans.
+
+using namespace godot;
+
+using core::Color;
+using core::real_t;
+
+static std::mt19937 random_engine = std::mt19937(33);
+
+static real_t random_between(real_t const low, real_t const high) {
+	return std::uniform_real_distribution<real_t>(low, high)(random_engine);
+}
+
+static std::vector<real_t> random_values(size_t const size, real_t const low, real_t const high) {
+	std::vector<real_t> values = std::vector<real_t>(size);
+
+	for (real_t& value : values) value = random_between(low, high);
+
+	return values;
+}
+
+static std::vector<Color> random_colors(size_t const size, real_t const low, real_t const high) {
+	std::vector<Color> colors = std::vector<Color>(size);
+
+	for (Color& color : colors) {
+		color = Color::of(
+			random_between(low, high),
+			random_between(low, high),
+			random_between(low, high),
+			random_between(low, high)
+		);
+	}
+
+	return colors;
+}
+
+static core::PoolColorArray pool_of(std::vector<Color> const& colors) {
+	core::PoolColorArray pool;
+
+	pool.resize(static_cast<int>(colors.size()));
+	std::copy(colors.begin(), colors.end(), pool.write().span().begin());
+
+	return pool;
+}
+
+static core::PoolRealArray pool_of(std::vector<real_t> const& values) {
+	core::PoolRealArray pool;
+
+	pool.resize(static_cast<int>(values.size()));
+	std::copy(values.begin(), values.end(), pool.write().span().begin());
+
+	return pool;
+}
+
+static size_t const sizes[] = {1, 2, 3, 4, 5, 7, 8, 13, 66, 1001};
+
+static void test_from_hsv() {
+	for (size_t const size : sizes) {
+		std::vector<real_t> h = random_values(size, 0, 1);
+		std::vector<real_t> s = random_values(size, 0, 1);
+		std::vector<real_t> const v = random_values(size, 0, 1);
+
+		// Hues past one and below zero, which take the wrapping path for their whole block, and grays.
+		for (size_t i = 1; i < size; i += 6) h[i] = random_between(1, 3);
+
+		for (size_t i = 4; i < size; i += 9) h[i] = random_between(-2, 0);
+
+		for (size_t i = 2; i < size; i += 5) s[i] = 0;
+
+		std::vector<Color> out = std::vector<Color>(size);
+
+		batch::from_hsv(h, s, v, 0.75f, out);
+
+		for (size_t i = 0; i < size; i += 1) GD_CHECK(out[i] == Color::from_hsv(h[i], s[i], v[i], 0.75f));
+	}
+
+	// Pool arrays of different lengths convert up to the shortest, as do spans.
+	std::vector<real_t> const h = random_values(9, 0, 1);
+	std::vector<real_t> const s = random_values(7, 0, 1);
+	std::vector<real_t> const v = random_values(8, 0, 1);
+	core::PoolColorArray const pool = batch::from_hsv(pool_of(h), pool_of(s), pool_of(v), 1);
+
+	GD_CHECK(pool.size() == 7);
+	GD_CHECK(pool.read()[6] == Color::from_hsv(h[6], s[6], v[6], 1));
+
+	std::vector<Color> out = std::vector<Color>(10, Color::of(2, 2, 2, 2));
+
+	batch::from_hsv(h, s, v, 1, out);
+
+	GD_CHECK(out[6] == Color::from_hsv(h[6], s[6], v[6], 1));
+	GD_CHECK(out[7] == Color::of(2, 2, 2, 2));
+}
+
+static void test_recolor() {
+	for (size_t const size : sizes) {
+		std::vector<Color> colors = random_colors(size, -1, 2);
+
+		// Channels too large for the double-precision `fmod` shortcut.
+		for (size_t i = 3; i < size; i += 8) colors[i].g = 3e9f;
+
+		std::vector<Color> darkened = std::vector<Color>(size);
+		std::vector<Color> lightened = std::vector<Color>(size);
+		std::vector<Color> contrasted = std::vector<Color>(size);
+		std::vector<Color> inverted = std::vector<Color>(size);
+
+		batch::darkened(colors, 0.3f, darkened);
+		batch::lightened(colors, 0.6f, lightened);
+		batch::contrasted(colors, contrasted);
+		batch::inverted(colors, inverted);
+
+		for (size_t i = 0; i < size; i += 1) {
+			GD_CHECK(darkened[i] == colors[i].darkened(0.3f));
+			GD_CHECK(lightened[i] == colors[i].lightened(0.6f));
+			GD_CHECK(contrasted[i] == colors[i].contrasted());
+			GD_CHECK(inverted[i] == colors[i].inverted());
+		}
+	}
+
+	std::vector<Color> const colors = random_colors(5, 0, 1);
+	core::PoolColorArray const pool = pool_of(colors);
+	core::PoolColorArray const darkened = batch::darkened(pool, 0.5f);
+	core::PoolColorArray const lightened = batch::lightened(pool, 0.5f);
+	core::PoolColorArray const contrasted = batch::contrasted(pool);
+	core::PoolColorArray const inverted = batch::inverted(pool);
+
+	GD_CHECK(inverted.size() == 5);
+	GD_CHECK(darkened.read()[4] == colors[4].darkened(0.5f));
+	GD_CHECK(lightened.read()[4] == colors[4].lightened(0.5f));
+	GD_CHECK(contrasted.read()[4] == colors[4].contrasted());
+	GD_CHECK(inverted.read()[4] == colors[4].inverted());
+
+	std::vector<Color> out = std::vector<Color>(3, Color::of(2, 2, 2, 2));
+
+	batch::inverted(std::span<Color const>(colors).first(2), out);
+
+	GD_CHECK(out[1] == colors[1].inverted());
+	GD_CHECK(out[2] == Color::of(2, 2, 2, 2));
+}
+
+static constexpr batch::GradientStop heat_stops[] = {
+	batch::GradientStop::of(0.25f, Color{0, 0, 1, 1}),
+	batch::GradientStop::of(0.75f, Color{1, 0, 0, 1}),
+};
+
+static constexpr batch::ColorTable<5> heat = batch::ColorTable<5>::of_gradient(heat_stops);
+
+static_assert(heat.colors[2].r == 0.5f, "Gradient tables are sampled at compile time");
+
+static void test_map_colors() {
+	real_t const nan = std::numeric_limits<real_t>::quiet_NaN();
+
+	// Flat before the first stop and after the last one.
+	GD_CHECK(heat.colors[0] == Color::of(0, 0, 1, 1));
+	GD_CHECK(heat.colors[1] == Color::of(0, 0, 1, 1));
+	GD_CHECK(heat.colors[3] == Color::of(1, 0, 0, 1));
+	GD_CHECK(heat.colors[4] == Color::of(1, 0, 0, 1));
+
+	for (size_t const size : sizes) {
+		std::vector<real_t> values = random_values(size, -5, 15);
+
+		for (size_t i = 1; i < size; i += 7) values[i] = nan;
+
+		std::vector<Color> out = std::vector<Color>(size);
+
+		batch::map_colors(values, 0, 10, heat.span(), out);
+
+		for (size_t i = 0; i < size; i += 1) {
+			real_t const position = (std::isnan(values[i]) ? 0 : std::clamp((values[i] * 0.4f), 0.f, 4.f));
+
+			GD_CHECK(out[i] == heat.colors[static_cast<size_t>(position + 0.5f)]);
+		}
+	}
+
+	core::PoolColorArray const mapped = batch::map_colors(pool_of(std::vector<real_t>{-1, 5, 11}), 0, 10, heat.span());
+
+	GD_CHECK(mapped.size() == 3);
+	GD_CHECK(mapped.read()[0] == heat.colors[0]);
+	GD_CHECK(mapped.read()[1] == heat.colors[2]);
+	GD_CHECK(mapped.read()[2] == heat.colors[4]);
+
+	// Indices past the palette give transparent black, and outputs past the indices are left alone.
+	std::vector<Color> const palette = random_colors(3, 0, 1);
+	std::vector<uint8_t> const indices = {0, 2, 3, 255, 1};
+	std::vector<Color> out = std::vector<Color>(6, Color::of(2, 2, 2, 2));
+
+	batch::map_colors(indices, palette, out);
+
+	GD_CHECK(out[0] == palette[0]);
+	GD_CHECK(out[1] == palette[2]);
+	GD_CHECK(out[2] == Color::of(0, 0, 0, 0));
+	GD_CHECK(out[3] == Color::of(0, 0, 0, 0));
+	GD_CHECK(out[4] == palette[1]);
+	GD_CHECK(out[5] == Color::of(2, 2, 2, 2));
+
+	core::PoolByteArray bytes;
+
+	bytes.resize(static_cast<int>(indices.size()));
+	std::copy(indices.begin(), indices.end(), bytes.write().span().begin());
+
+	core::PoolColorArray const looked_up = batch::map_colors(bytes, palette);
+
+	GD_CHECK(looked_up.size() == 5);
+	GD_CHECK(looked_up.read()[4] == palette[1]);
+}
+
+int main() {
+	mock::install();
+
+	test_from_hsv();
+	test_recolor();
+	test_map_colors();
+
+	GD_CHECK(mock::live_buffers() == 0);
+
+	return test::finish();
+}
@@ -0,0 +1,188 @@
+#include "godot/batch.hpp"
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+// `SoA` storage: lanes in declaration order on cache-line boundaries, growth and resizing that keep every
+// element, the element proxies, conversions to and from spans and pool arrays, and moves.
+
+using namespace godot;
+
+using core::Quat;
+using core::Transform;
+using core::Vector3;
+using core::real_t;
+
+static std::mt19937 random_engine = std::mt19937(50);
+
+static real_t random_between(real_t const low, real_t const high) {
+	return std::uniform_real_distribution<real_t>(low, high)(random_engine);
+}
+
+static Vector3 random_vector() {
+	return Vector3::of(random_between(-10, 10), random_between(-10, 10), random_between(-10, 10));
+}
+
+static bool same(Transform const& a, Transform const& b) {
+	return ((a.basis.x == b.basis.x) && (a.basis.y == b.basis.y) && (a.basis.z == b.basis.z) && (a.origin == b.origin));
+}
+
+template<typename Type> static bool lanes_aligned(batch::SoA<Type> const& soa) {
+	for (size_t field = 0; field < batch::SoA<Type>::lane_count; field += 1) {
+		if ((reinterpret_cast<uintptr_t>(soa.lane(field).data()) % 64) != 0) return false;
+	}
+
+	return true;
+}
+
+static void test_layout() {
+	std::vector<Transform> transforms = std::vector<Transform>(37);
+
+	for (Transform& transform : transforms) {
+		transform = Transform::of(core::Basis::of(random_vector(), random_vector(), random_vector()), random_vector());
+	}
+
+	batch::SoA<Transform> const soa = batch::SoA<Transform>::of(transforms);
+
+	GD_CHECK(batch::SoA<Transform>::lane_count == 12);
+	GD_CHECK(soa.size() == transforms.size());
+	GD_CHECK((soa.capacity() % 16) == 0);
+	GD_CHECK(lanes_aligned(soa));
+
+	for (size_t i = 0; i < transforms.size(); i += 1) {
+		GD_CHECK(same(soa[i], transforms[i]));
+		GD_CHECK(soa.lane(1)[i] == transforms[i].basis.x.y);
+		GD_CHECK(soa.lane(9)[i] == transforms[i].origin.x);
+		GD_CHECK(soa.lane(11)[i] == transforms[i].origin.z);
+	}
+
+	// Scattering stops at whichever side is shorter.
+	std::vector<Transform> short_out = std::vector<Transform>(5);
+	std::vector<Transform> long_out = std::vector<Transform>(40, Transform::zero());
+
+	soa.scatter(short_out);
+	soa.scatter(long_out);
+
+	GD_CHECK(same(short_out[4], transforms[4]));
+	GD_CHECK(same(long_out[36], transforms[36]));
+	GD_CHECK(same(long_out[37], Transform::zero()));
+}
+
+static void test_growth() {
+	batch::SoA<Vector3> soa;
+	std::vector<Vector3> pushed;
+
+	GD_CHECK(soa.size() == 0);
+	GD_CHECK(soa.capacity() == 0);
+
+	// Enough pushes for several reallocations, each of which must carry every lane across.
+	for (size_t i = 0; i < 300; i += 1) {
+		pushed.push_back(random_vector());
+		soa.push_back(pushed.back());
+	}
+
+	GD_CHECK(soa.size() == 300);
+	GD_CHECK(soa.capacity() >= 300);
+	GD_CHECK(lanes_aligned(soa));
+
+	for (size_t i = 0; i < pushed.size(); i += 1) GD_CHECK(soa.get(i) == pushed[i]);
+
+	// Shrinking keeps the front, and growing again zeroes what was dropped.
+	soa.resize(10);
+	soa.resize(20);
+
+	GD_CHECK(soa.get(9) == pushed[9]);
+	GD_CHECK(soa.get(10) == Vector3::zero());
+	GD_CHECK(soa.get(19) == Vector3::zero());
+
+	size_t const capacity = soa.capacity();
+
+	soa.reserve(1);
+	soa.clear();
+
+	GD_CHECK(soa.size() == 0);
+	GD_CHECK(soa.capacity() == capacity);
+
+	// Element proxies read and write through to the lanes.
+	soa.resize(3);
+	soa[1] = Vector3::of(1, 2, 3);
+
+	Vector3 const read = soa[1];
+
+	GD_CHECK(read == Vector3::of(1, 2, 3));
+	GD_CHECK(soa.lane(2)[1] == 3);
+	GD_CHECK(soa.get(0) == Vector3::zero());
+}
+
+static void test_pool_and_moves() {
+	core::PoolVector3Array pool;
+
+	pool.resize(21);
+
+	for (Vector3& vector : pool.write().span()) vector = random_vector();
+
+	batch::SoA<Vector3> soa = batch::SoA<Vector3>::of_pool(pool);
+	core::PoolVector3Array copied;
+
+	soa.to_pool(copied);
+
+	GD_CHECK(copied.size() == 21);
+
+	for (size_t i = 0; i < 21; i += 1) GD_CHECK(copied.read()[i] == pool.read()[i]);
+
+	batch::SoA<Vector3> moved = std::move(soa);
+
+	GD_CHECK(moved.size() == 21);
+	GD_CHECK(moved.get(20) == pool.read()[20]);
+	GD_CHECK(soa.size() == 0);
+	GD_CHECK(soa.capacity() == 0);
+
+	// A moved-from container is empty but still usable.
+	soa.push_back(Vector3::of(4, 5, 6));
+
+	GD_CHECK(soa.get(0) == Vector3::of(4, 5, 6));
+
+	soa = std::move(moved);
+
+	GD_CHECK(soa.size() == 21);
+	GD_CHECK(moved.size() == 0);
+	GD_CHECK(soa.get(0) == pool.read()[0]);
+}
+
+static void test_quat_lanes() {
+	std::normal_distribution<real_t> component = std::normal_distribution<real_t>(0, 1);
+	batch::SoA<Quat> a, b, out;
+
+	for (size_t i = 0; i < 11; i += 1) {
+		a.push_back(Quat::of(component(random_engine), component(random_engine), 0.5f, 1).normalized());
+		b.push_back(Quat::of(0.5f, component(random_engine), component(random_engine), 1).normalized());
+	}
+
+	out.resize(a.size());
+	batch::slerp(std::as_const(a).quat_lanes(), std::as_const(b).quat_lanes(), 0.25f, out.quat_lanes());
+
+	for (size_t i = 0; i < out.size(); i += 1) {
+		Quat const expected = a.get(i).slerp(b.get(i), 0.25f);
+		Quat const result = out.get(i);
+
+		GD_CHECK((result - expected).length() <= 1e-6f);
+	}
+}
+
+int main() {
+	mock::install();
+
+	test_layout();
+	test_growth();
+	test_pool_and_moves();
+	test_quat_lanes();
+
+	GD_CHECK(mock::live_buffers() == 0);
+
+	return test::finish();
+}
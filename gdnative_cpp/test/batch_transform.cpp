@@ -0,0 +1,277 @@
+#include "godot/batch.hpp"
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// The transform kernels against `Transform` and `Basis` applied per element, over sizes that leave every
+// tail length, and the clean stops and skips they make on short spans and bad indices.
+
+using namespace godot;
+
+using core::Basis;
+using core::Transform;
+using core::Vector3;
+using core::real_t;
+
+static std::mt19937 random_engine = std::mt19937(30);
+
+static real_t random_between(real_t const low, real_t const high) {
+	return std::uniform_real_distribution<real_t>(low, high)(random_engine);
+}
+
+static Vector3 random_vector(real_t const extent) {
+	return Vector3::of(
+		random_between(-extent, extent),
+		random_between(-extent, extent),
+		random_between(-extent, extent)
+	);
+}
+
+// Rotated and scaled by at most 2 either way, so every basis is well conditioned.
+static Transform random_transform() {
+	std::normal_distribution<real_t> component = std::normal_distribution<real_t>(0, 1);
+
+	core::Quat const rotation = core::Quat::of(
+		component(random_engine),
+		component(random_engine),
+		component(random_engine),
+		component(random_engine)
+	).normalized();
+
+	Basis basis = Basis::from_quat(rotation);
+
+	basis.x = (basis.x * random_between(0.5f, 2));
+	basis.y = (basis.y * random_between(0.5f, 2));
+	basis.z = (basis.z * random_between(0.5f, 2));
+
+	return Transform::of(basis, random_vector(10));
+}
+
+static std::vector<Transform> random_transforms(size_t const size) {
+	std::vector<Transform> transforms = std::vector<Transform>(size);
+
+	for (Transform& transform : transforms) transform = random_transform();
+
+	return transforms;
+}
+
+// Largest component difference, relative to the expected component where that is above one.
+static real_t relative_error(real_t const* result, real_t const* expected, size_t const count) {
+	real_t worst = 0;
+
+	for (size_t i = 0; i < count; i += 1) {
+		worst = std::max(worst, (std::fabs(result[i] - expected[i]) / std::max(real_t(1), std::fabs(expected[i]))));
+	}
+
+	return worst;
+}
+
+static real_t relative_error(Transform const& result, Transform const& expected) {
+	return relative_error((&result.basis.x.x), (&expected.basis.x.x), 12);
+}
+
+static real_t relative_error(Vector3 const& result, Vector3 const& expected) {
+	return relative_error((&result.x), (&expected.x), 3);
+}
+
+static bool same(Transform const& a, Transform const& b) {
+	return ((a.basis.x == b.basis.x) && (a.basis.y == b.basis.y) && (a.basis.z == b.basis.z) && (a.origin == b.origin));
+}
+
+static bool is_zero(Basis const& basis) {
+	return ((basis.x == Vector3::zero()) && (basis.y == Vector3::zero()) && (basis.z == Vector3::zero()));
+}
+
+static Vector3 transformed(Transform const& transform, Vector3 const& point) {
+	return (transform.basis.xform(point) + transform.origin);
+}
+
+static size_t const sizes[] = {1, 2, 3, 4, 5, 6, 7, 9, 66, 1001};
+
+static void test_multiply_and_inverse() {
+	real_t worst_product = 0;
+	real_t worst_inverse = 0;
+	real_t worst_point = 0;
+
+	for (size_t const size : sizes) {
+		std::vector<Transform> const a = random_transforms(size);
+		std::vector<Transform> const b = random_transforms(size);
+		std::vector<Vector3> points = std::vector<Vector3>(size);
+		std::vector<Transform> product = std::vector<Transform>(size);
+		std::vector<Transform> inverse = std::vector<Transform>(size);
+		std::vector<Vector3> moved = std::vector<Vector3>(size);
+
+		for (Vector3& point : points) point = random_vector(10);
+
+		batch::multiply(a, b, product);
+		batch::affine_inverse(a, inverse);
+		batch::xform(a[0], points, moved);
+
+		for (size_t i = 0; i < size; i += 1) {
+			worst_product = std::max(worst_product, relative_error(product[i], (a[i] * b[i])));
+			worst_inverse = std::max(worst_inverse, relative_error(inverse[i], a[i].affine_inverse()));
+			worst_point = std::max(worst_point, relative_error(moved[i], transformed(a[0], points[i])));
+		}
+	}
+
+	// Within a few float roundings of the engine's own order of operations.
+	GD_CHECK(worst_product <= 1e-6f);
+	GD_CHECK(worst_inverse <= 1e-5f);
+	GD_CHECK(worst_point <= 1e-6f);
+
+	// A singular basis inverts to a zero basis in the middle of a block as well as alone.
+	std::vector<Transform> singular = random_transforms(6);
+
+	singular[2].basis.z = singular[2].basis.x;
+	singular[5].basis = Basis::zero();
+
+	std::vector<Transform> inverted = std::vector<Transform>(6);
+
+	batch::affine_inverse(singular, inverted);
+
+	GD_CHECK(is_zero(inverted[2].basis));
+	GD_CHECK(is_zero(inverted[5].basis));
+	GD_CHECK(relative_error(inverted[3], singular[3].affine_inverse()) <= 1e-5f);
+}
+
+static void test_propagate_hierarchy() {
+	size_t const size = 103;
+	std::vector<Transform> const locals = random_transforms(size);
+	std::vector<godot_int> parents = std::vector<godot_int>(size);
+
+	for (size_t i = 0; i < size; i += 1) {
+		if ((i % 17) == 0) {
+			parents[i] = -1;
+		} else if ((i % 23) == 5) {
+			// Not before its child, so treated as a root.
+			parents[i] = static_cast<godot_int>(i + ((i % 2) * 3));
+		} else {
+			parents[i] = static_cast<godot_int>(std::uniform_int_distribution<size_t>(0, (i - 1))(random_engine));
+		}
+	}
+
+	std::vector<Transform> globals = std::vector<Transform>(size);
+	std::vector<Transform> expected = std::vector<Transform>(size);
+
+	batch::propagate_hierarchy(parents, locals, globals);
+
+	for (size_t i = 0; i < size; i += 1) {
+		godot_int const parent = parents[i];
+		bool const root = ((parent < 0) || (static_cast<size_t>(parent) >= i));
+
+		expected[i] = (root ? locals[i] : (expected[static_cast<size_t>(parent)] * locals[i]));
+
+		if (root) {
+			GD_CHECK(same(globals[i], locals[i]));
+		} else {
+			GD_CHECK(relative_error(globals[i], expected[i]) <= 1e-4f);
+		}
+	}
+
+	// Globals past the end of `parents` are left alone.
+	std::vector<Transform> untouched = std::vector<Transform>(size, Transform::zero());
+
+	batch::propagate_hierarchy(std::span<godot_int const>(parents).first(10), locals, untouched);
+
+	GD_CHECK(!same(untouched[9], Transform::zero()));
+	GD_CHECK(same(untouched[10], Transform::zero()));
+}
+
+static void test_skin() {
+	std::vector<Transform> const bones = random_transforms(12);
+	real_t worst_position = 0;
+	real_t worst_normal = 0;
+
+	for (size_t const size : sizes) {
+		std::vector<Vector3> vertices = std::vector<Vector3>(size);
+		std::vector<Vector3> normals = std::vector<Vector3>(size);
+		std::vector<godot_int> indices = std::vector<godot_int>(size * 4);
+		std::vector<real_t> weights = std::vector<real_t>(size * 4);
+
+		for (size_t i = 0; i < size; i += 1) {
+			vertices[i] = random_vector(5);
+			normals[i] = random_vector(1).normalized();
+
+			real_t total = 0;
+
+			for (size_t k = 0; k < 4; k += 1) {
+				indices[((i * 4) + k)] = std::uniform_int_distribution<godot_int>(0, 11)(random_engine);
+				weights[((i * 4) + k)] = random_between(0.1f, 1);
+				total += weights[((i * 4) + k)];
+			}
+
+			for (size_t k = 0; k < 4; k += 1) weights[((i * 4) + k)] /= total;
+
+			// Out-of-range and negative indices contribute nothing, whatever their weight.
+			if ((i % 5) == 2) indices[(i * 4)] = 12;
+
+			if ((i % 7) == 3) indices[((i * 4) + 3)] = -1;
+		}
+
+		std::vector<Vector3> positions = std::vector<Vector3>(size);
+		std::vector<Vector3> skinned_normals = std::vector<Vector3>(size);
+
+		batch::skin(bones, vertices, indices, weights, positions);
+		batch::skin_normals(bones, normals, indices, weights, skinned_normals);
+
+		for (size_t i = 0; i < size; i += 1) {
+			Vector3 position = Vector3::zero();
+			Basis basis = Basis::zero();
+
+			for (size_t k = 0; k < 4; k += 1) {
+				godot_int const bone = indices[((i * 4) + k)];
+				real_t const weight = weights[((i * 4) + k)];
+
+				if ((bone < 0) || (bone >= 12)) continue;
+
+				position = (position + (transformed(bones[static_cast<size_t>(bone)], vertices[i]) * weight));
+				basis.x = (basis.x + (bones[static_cast<size_t>(bone)].basis.x * weight));
+				basis.y = (basis.y + (bones[static_cast<size_t>(bone)].basis.y * weight));
+				basis.z = (basis.z + (bones[static_cast<size_t>(bone)].basis.z * weight));
+			}
+
+			Vector3 const normal = basis.xform(normals[i]).normalized();
+
+			worst_position = std::max(worst_position, relative_error(positions[i], position));
+			worst_normal = std::max(worst_normal, relative_error(skinned_normals[i], normal));
+		}
+	}
+
+	GD_CHECK(worst_position <= 1e-5f);
+	GD_CHECK(worst_normal <= 1e-5f);
+
+	// Vertices without a full set of four weights are not skinned.
+	std::vector<Vector3> const vertices = std::vector<Vector3>(3, Vector3::of(1, 2, 3));
+	std::vector<godot_int> const indices = std::vector<godot_int>(12, 0);
+	std::vector<real_t> const weights = std::vector<real_t>(11, 0.25f);
+	std::vector<Vector3> out = std::vector<Vector3>(5, Vector3::of(9, 9, 9));
+
+	batch::skin(bones, vertices, indices, weights, out);
+
+	GD_CHECK(relative_error(out[1], transformed(bones[0], vertices[1])) <= 1e-5f);
+	GD_CHECK(out[2] == Vector3::of(9, 9, 9));
+	GD_CHECK(out[4] == Vector3::of(9, 9, 9));
+
+	// A vertex whose every bone is skipped lands on the origin, and its normal on zero.
+	std::vector<godot_int> const missing = std::vector<godot_int>(4, -1);
+	std::vector<Vector3> normal = std::vector<Vector3>(1, Vector3::of(9, 9, 9));
+
+	batch::skin_normals(bones, std::span<Vector3 const>(vertices).first(1), missing, weights, normal);
+
+	GD_CHECK(normal[0] == Vector3::zero());
+}
+
+int main() {
+	mock::install();
+
+	test_multiply_and_inverse();
+	test_propagate_hierarchy();
+	test_skin();
+
+	return test::finish();
+}
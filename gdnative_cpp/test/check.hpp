@@ -0,0 +1,29 @@
+#ifndef GODOT_TEST_CHECK_H
+#define GODOT_TEST_CHECK_H
+
+#include <cstdio>
+
+namespace godot::test {
+	inline int failure_count = 0;
+
+	inline void check(bool const passed, char const* expression, char const* file, int const line) {
+		if (passed) return;
+
+		failure_count += 1;
+
+		std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+	}
+
+	/// Exit status for `main`, nonzero if any check failed.
+	inline int finish() {
+		if (failure_count != 0) std::fprintf(stderr, "%d checks failed\n", failure_count);
+
+		return ((failure_count == 0) ? 0 : 1);
+	}
+}
+
+/// Reports `expression` with its location when it is false and carries on, so a single run lists every
+/// failing case.
+#define GD_CHECK(expression) godot::test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#endif
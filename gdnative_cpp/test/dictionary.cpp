@@ -0,0 +1,87 @@
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+// How far `Dictionary::duplicate` copies on engines without `godot_dictionary_duplicate`, where the wrapper
+// walks the dictionary itself.
+
+using namespace godot;
+
+static void append(core::Array& array, core::Variant const& value) {
+	core::api_core->godot_array_append(array.handleof(), value.handleof());
+}
+
+static void set(core::Dictionary& dictionary, core::Variant const& key, core::Variant const& value) {
+	core::api_core->godot_dictionary_set(dictionary.handleof(), key.handleof(), value.handleof());
+}
+
+static core::Variant value_of(core::Dictionary const& dictionary, core::Variant const& key) {
+	return core::Variant(core::api_core->godot_dictionary_get(dictionary.handleof(), key.handleof()));
+}
+
+static core::Array array_of(core::Variant const& value) {
+	return core::Array(core::api_core->godot_variant_as_array(value.handleof()));
+}
+
+static core::Dictionary dictionary_of(core::Variant const& value) {
+	return core::Dictionary(core::api_core->godot_variant_as_dictionary(value.handleof()));
+}
+
+static void test_dictionary_duplicate() {
+	core::Variant const list_key = core::Variant(core::String("list"));
+	core::Variant const child_key = core::Variant(core::String("child"));
+	core::Variant const name_key = core::Variant(int64_t(5));
+	core::Variant const entry_key = core::Variant(core::String("x"));
+	core::Dictionary original;
+	core::Dictionary child;
+	core::Dictionary listed;
+	core::Array list;
+
+	set(child, entry_key, core::Variant(int64_t(1)));
+	set(listed, entry_key, core::Variant(int64_t(2)));
+	append(list, core::Variant(int64_t(1)));
+	append(list, core::Variant(listed));
+	set(original, list_key, core::Variant(list));
+	set(original, child_key, core::Variant(child));
+	set(original, name_key, core::Variant(core::String("name")));
+
+	core::Dictionary const shallow = original.duplicate(core::Dictionary::DUPLICATE_NONE);
+	core::Dictionary const deep = original.duplicate(core::Dictionary::DUPLICATE_DEEP);
+
+	GD_CHECK(shallow.size() == 3);
+	GD_CHECK(deep.size() == 3);
+
+	// Changes to the containers the original holds show through a shallow copy but not a deep one, at
+	// every level.
+	append(list, core::Variant(int64_t(3)));
+	set(child, core::Variant(core::String("y")), core::Variant());
+	set(listed, core::Variant(core::String("y")), core::Variant());
+
+	GD_CHECK(array_of(value_of(shallow, list_key)).size() == 3);
+	GD_CHECK(array_of(value_of(deep, list_key)).size() == 2);
+	GD_CHECK(dictionary_of(value_of(shallow, child_key)).size() == 2);
+	GD_CHECK(dictionary_of(value_of(deep, child_key)).size() == 1);
+
+	core::Array const deep_list = array_of(value_of(deep, list_key));
+	core::Variant const deep_listed = core::Variant(core::api_core->godot_array_get(deep_list.handleof(), 1));
+
+	GD_CHECK(dictionary_of(deep_listed).size() == 1);
+
+	// The copies are new dictionaries either way.
+	set(original, core::Variant(core::String("added")), core::Variant());
+
+	GD_CHECK(original.size() == 4);
+	GD_CHECK(shallow.size() == 3);
+	GD_CHECK(deep.size() == 3);
+	GD_CHECK(value_of(deep, name_key).type_of() == core::Variant::TYPE_STRING);
+}
+
+int main() {
+	mock::install();
+
+	test_dictionary_duplicate();
+
+	GD_CHECK(mock::live_buffers() == 0);
+
+	return test::finish();
+}
@@ -0,0 +1,133 @@
+#include "godot/jobs.hpp"
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+#include <atomic>
+#include <vector>
+
+// `parallel_for` on pools of one and several workers, covering every index once whatever the grain, over
+// spans of pool arrays and nested inside itself, and task graphs that must respect every edge on each run.
+
+using namespace godot;
+
+using core::real_t;
+
+static void test_parallel_for(jobs::ThreadPool& pool) {
+	size_t const grains[] = {0, 1, 7, 64, 5000};
+	jobs::Range const ranges[] = {jobs::Range::of(0, 0), jobs::Range::of(5, 6), jobs::Range::of(3, 1000)};
+
+	for (jobs::Range const range : ranges) {
+		for (size_t const grain : grains) {
+			std::vector<std::atomic<int>> hits = std::vector<std::atomic<int>>(range.end + 1);
+			jobs::JobCounter counter = jobs::JobCounter("test parallel_for");
+
+			pool.parallel_for(range, grain, [&hits](jobs::Range const chunk) {
+				for (size_t i = chunk.begin; i < chunk.end; i += 1) hits[i].fetch_add(1, std::memory_order_relaxed);
+			}, (&counter));
+
+			for (size_t i = 0; i < hits.size(); i += 1) {
+				GD_CHECK(hits[i].load() == (((i >= range.begin) && (i < range.end)) ? 1 : 0));
+			}
+
+			size_t const step = ((grain == 0) ? 1 : grain);
+			size_t const chunks = ((range.size() + step - 1) / step);
+
+			GD_CHECK(counter.runs.load() == ((range.size() == 0) ? 0 : 1));
+			GD_CHECK(counter.tasks.load() == chunks);
+		}
+	}
+}
+
+static void test_spans_and_nesting(jobs::ThreadPool& pool) {
+	core::PoolRealArray values;
+
+	values.resize(1003);
+
+	{
+		core::PoolArrayWrite<real_t> write = values.write();
+
+		for (size_t i = 0; i < write.span().size(); i += 1) write.span()[i] = real_t(i);
+
+		pool.parallel_for(write.span(), 16, [](std::span<real_t> const chunk) {
+			for (real_t& value : chunk) value *= 2;
+		});
+	}
+
+	core::PoolArrayRead<real_t> const read = values.read();
+
+	for (size_t i = 0; i < read.span().size(); i += 1) GD_CHECK(read.span()[i] == real_t(i * 2));
+
+	// Workers waiting on an inner loop run other tasks instead of blocking the pool.
+	std::atomic<size_t> total = 0;
+
+	pool.parallel_for(jobs::Range::of(0, 32), 1, [&pool, &total](jobs::Range const outer) {
+		pool.parallel_for(jobs::Range::of(0, 100), 3, [&total, outer](jobs::Range const inner) {
+			total.fetch_add((inner.size() * (outer.begin + 1)), std::memory_order_relaxed);
+		});
+	});
+
+	GD_CHECK(total.load() == (100 * ((32 * 33) / 2)));
+}
+
+static void test_task_graph(jobs::ThreadPool& pool) {
+	jobs::TaskGraph graph;
+	std::atomic<size_t> clock = 0;
+	std::vector<size_t> finished = std::vector<size_t>(6);
+
+	auto const node = [&](size_t const index) {
+		return graph.add([&clock, &finished, index]() {
+			finished[index] = clock.fetch_add(1, std::memory_order_acq_rel);
+		});
+	};
+
+	// A diamond, a chain hanging off its end, and a node with no edges at all.
+	jobs::TaskGraph::NodeId const top = node(0);
+	jobs::TaskGraph::NodeId const left = node(1);
+	jobs::TaskGraph::NodeId const right = node(2);
+	jobs::TaskGraph::NodeId const bottom = node(3);
+	jobs::TaskGraph::NodeId const tail = node(4);
+
+	node(5);
+	graph.precede(top, left);
+	graph.precede(top, right);
+	graph.precede(left, bottom);
+	graph.precede(right, bottom);
+	graph.precede(bottom, tail);
+
+	jobs::JobCounter counter = jobs::JobCounter("test graph");
+
+	for (int run = 0; run < 20; run += 1) {
+		graph.run(pool, (&counter));
+
+		GD_CHECK(finished[top] < finished[left]);
+		GD_CHECK(finished[top] < finished[right]);
+		GD_CHECK(finished[left] < finished[bottom]);
+		GD_CHECK(finished[right] < finished[bottom]);
+		GD_CHECK(finished[bottom] < finished[tail]);
+	}
+
+	GD_CHECK(graph.size() == 6);
+	GD_CHECK(clock.load() == (6 * 20));
+	GD_CHECK(counter.runs.load() == 20);
+	GD_CHECK(counter.tasks.load() == (6 * 20));
+
+	jobs::TaskGraph empty;
+
+	empty.run(pool);
+}
+
+int main() {
+	mock::install();
+
+	jobs::ThreadPool one_worker = jobs::ThreadPool(1);
+	jobs::ThreadPool workers = jobs::ThreadPool(3);
+
+	for (jobs::ThreadPool * pool : {(&one_worker), (&workers)}) {
+		test_parallel_for(*pool);
+		test_spans_and_nesting(*pool);
+		test_task_graph(*pool);
+	}
+
+	return test::finish();
+}
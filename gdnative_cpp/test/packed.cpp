@@ -0,0 +1,156 @@
+#include "godot/mock.hpp"
+#include "godot/packed.hpp"
+
+#include "test/check.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Chunk files written by `ChunkWriter` and read back through the mapping, and the header and index damage
+// `ChunkReader::open` must refuse before any span can point outside the file.
+
+using namespace godot;
+
+using core::real_t;
+
+static std::filesystem::path const directory = std::filesystem::temp_directory_path();
+
+static std::string const path = (directory / "gdnative_cpp_test.gdpk").string();
+
+static std::string const damaged_path = (directory / "gdnative_cpp_test_damaged.gdpk").string();
+
+static std::vector<uint8_t> contents_of(std::string const& file_path) {
+	std::ifstream file = std::ifstream(file_path, std::ios::binary);
+
+	return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static core::Error open_damaged(std::vector<uint8_t> const& bytes) {
+	std::ofstream(damaged_path, std::ios::binary).write(
+		reinterpret_cast<char const*>(bytes.data()),
+		static_cast<std::streamsize>(bytes.size())
+	);
+
+	packed::ChunkReader reader;
+
+	return reader.open(damaged_path.c_str());
+}
+
+static void test_round_trip() {
+	std::vector<core::Vector3> samples = std::vector<core::Vector3>(1000);
+	std::vector<real_t> heights = std::vector<real_t>(777);
+	std::vector<core::Color> const light = std::vector<core::Color>(5, core::Color::of(1, 2, 3, 4));
+	std::vector<uint8_t> const raw = std::vector<uint8_t>(13, 7);
+
+	for (size_t i = 0; i < samples.size(); i += 1) samples[i] = core::Vector3::of(real_t(i), 1, 2);
+
+	for (size_t i = 0; i < heights.size(); i += 1) heights[i] = (real_t(i) * 0.5f);
+
+	packed::ChunkWriter writer;
+
+	GD_CHECK(writer.add<core::Vector3>("nav/samples", samples));
+	GD_CHECK(writer.add<real_t>("terrain/height", heights));
+	GD_CHECK(writer.add<core::Color>("light", light));
+	GD_CHECK(writer.add<uint8_t>("a_bytes", raw));
+	GD_CHECK(writer.add<uint8_t>(std::string(39, 'y'), raw));
+	GD_CHECK(!writer.add<uint8_t>("light", raw));
+	GD_CHECK(!writer.add<uint8_t>("", raw));
+	GD_CHECK(!writer.add<uint8_t>(std::string(40, 'x'), raw));
+	GD_CHECK(writer.save(path.c_str()) == core::Error::OK);
+
+	packed::ChunkReader reader;
+
+	GD_CHECK(reader.open(path.c_str()) == core::Error::OK);
+	GD_CHECK(reader.chunks().size() == 5);
+
+	for (size_t i = 0; i < reader.chunks().size(); i += 1) {
+		packed::ChunkEntry const& entry = reader.chunks()[i];
+
+		GD_CHECK((entry.offset % packed::chunk_alignment) == 0);
+		GD_CHECK((i == 0) || (reader.chunks()[i - 1].name_of() < entry.name_of()));
+	}
+
+	std::span<core::Vector3 const> const read_samples = reader.span<core::Vector3>("nav/samples");
+
+	GD_CHECK(read_samples.size() == samples.size());
+	GD_CHECK(std::memcmp(read_samples.data(), samples.data(), read_samples.size_bytes()) == 0);
+	GD_CHECK(reader.span<real_t>("nav/samples").empty());
+	GD_CHECK(reader.span<real_t>("missing").empty());
+	GD_CHECK(reader.find("missing") == nullptr);
+	GD_CHECK(reader.raw("a_bytes").size() == raw.size());
+	GD_CHECK(reader.span<uint8_t>(std::string(39, 'y')).size() == raw.size());
+
+	core::PoolRealArray copied_heights;
+
+	GD_CHECK(reader.copy("terrain/height", copied_heights));
+	GD_CHECK(copied_heights.size() == static_cast<int>(heights.size()));
+	GD_CHECK(std::memcmp(copied_heights.read().data(), heights.data(), (heights.size() * sizeof(real_t))) == 0);
+
+	core::PoolColorArray wrong_type;
+
+	GD_CHECK(!reader.copy("terrain/height", wrong_type));
+
+	reader.prefetch("nav/samples");
+	reader.close();
+
+	GD_CHECK(reader.chunks().empty());
+}
+
+static void test_damaged() {
+	std::vector<uint8_t> const bytes = contents_of(path);
+	packed::ChunkFileHeader header;
+
+	std::memcpy((&header), bytes.data(), sizeof(header));
+
+	size_t const first_entry = static_cast<size_t>(header.index_offset);
+
+	std::vector<uint8_t> damaged = bytes;
+
+	damaged[0] = 'X';
+	GD_CHECK(open_damaged(damaged) == core::Error::ERR_FILE_UNRECOGNIZED);
+
+	damaged = bytes;
+	damaged[offsetof(packed::ChunkFileHeader, version)] += 1;
+	GD_CHECK(open_damaged(damaged) == core::Error::ERR_FILE_UNRECOGNIZED);
+
+	std::vector<uint8_t> const too_short = std::vector<uint8_t>(bytes.begin(), (bytes.begin() + 10));
+	std::vector<uint8_t> const truncated = std::vector<uint8_t>(bytes.begin(), (bytes.end() - 1));
+
+	GD_CHECK(open_damaged(too_short) == core::Error::ERR_FILE_UNRECOGNIZED);
+	GD_CHECK(open_damaged(truncated) == core::Error::ERR_FILE_CORRUPT);
+
+	damaged = bytes;
+	damaged[first_entry + offsetof(packed::ChunkEntry, offset)] ^= 1;
+	GD_CHECK(open_damaged(damaged) == core::Error::ERR_FILE_CORRUPT);
+
+	damaged = bytes;
+	damaged[first_entry + offsetof(packed::ChunkEntry, type)] = 9;
+	GD_CHECK(open_damaged(damaged) == core::Error::ERR_FILE_CORRUPT);
+
+	damaged = bytes;
+	damaged[first_entry + offsetof(packed::ChunkEntry, size) + 7] = 0x40;
+	GD_CHECK(open_damaged(damaged) == core::Error::ERR_FILE_CORRUPT);
+
+	packed::ChunkReader reader;
+
+	GD_CHECK(reader.open("/nonexistent/gdnative_cpp_test.gdpk") != core::Error::OK);
+}
+
+int main() {
+	mock::install();
+
+	test_round_trip();
+	test_damaged();
+
+	std::filesystem::remove(path);
+	std::filesystem::remove(damaged_path);
+
+	GD_CHECK(mock::live_buffers() == 0);
+
+	return test::finish();
+}
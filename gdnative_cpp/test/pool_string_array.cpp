@@ -0,0 +1,90 @@
+#include "godot/mock.hpp"
+
+#include "test/check.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// UTF-8 conversion of string pools against the engine's own parsing, including code points outside the
+// basic plane and surrogates.
+
+using namespace godot;
+
+static void test_pool_string_utf8() {
+	std::vector<std::string> const strings = {
+		"",
+		"ascii",
+		"h\xC3\xA9llo w\xC3\xB6rld",
+		"\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E",
+		"emoji \xF0\x9F\x98\x80 and clef \xF0\x9D\x84\x9E",
+		"\xF4\x8F\xBF\xBF"
+	};
+
+	core::PoolStringArray const array = core::PoolStringArray::of(strings);
+
+	GD_CHECK(array.size() == static_cast<int>(strings.size()));
+	GD_CHECK(array.to_utf8() == strings);
+
+	std::vector<std::string_view> const views = std::vector<std::string_view>(strings.begin(), strings.end());
+	std::vector<std::string> converted = {"stale", "entries", "beyond", "the", "new", "size", "are", "dropped"};
+
+	core::PoolStringArray::of(views).to_utf8(converted);
+
+	GD_CHECK(converted == strings);
+
+	// Each element must hold the same text the engine parses from the same bytes, so code points outside
+	// the basic plane become one wide character, or a surrogate pair where `wchar_t` is 16 bits.
+	core::PoolArrayRead<core::String> const elements = array.read();
+
+	for (size_t i = 0; i < strings.size(); i += 1) {
+		core::String const parsed = core::String(strings[i].c_str());
+
+		GD_CHECK(core::api_core->godot_string_operator_equal(elements[i].handleof(), parsed.handleof()));
+	}
+
+	wchar_t const* const emoji = core::api_core->godot_string_wide_str(elements[4].handleof());
+
+	if constexpr (sizeof(wchar_t) == 2) {
+		GD_CHECK((emoji[6] == 0xD83D) && (emoji[7] == 0xDE00));
+	} else {
+		GD_CHECK(emoji[6] == 0x1F600);
+	}
+
+	// Engine strings can hold units that are not valid code points; those come out as U+FFFD. A high
+	// surrogate followed by a low one is a pair only where `wchar_t` is 16 bits.
+	wchar_t const units[] = {
+		L'a',
+		static_cast<wchar_t>(0xD83D),
+		static_cast<wchar_t>(0xDE00),
+		L'b',
+		static_cast<wchar_t>(0xDC00),
+		static_cast<wchar_t>(0xD800),
+		0
+	};
+
+	core::PoolStringArray unpaired;
+
+	unpaired.resize(1);
+	{
+		core::PoolArrayWrite<core::String> const write = unpaired.write();
+
+		core::api_core->godot_string_destroy(write[0].handleof());
+		core::api_core->godot_string_new_with_wide_string(write[0].handleof(), units, 6);
+	}
+
+	std::string const replacement = "\xEF\xBF\xBD";
+	std::string const pair = ((sizeof(wchar_t) == 2) ? "\xF0\x9F\x98\x80" : (replacement + replacement));
+
+	GD_CHECK(unpaired.to_utf8() == std::vector<std::string>{("a" + pair + "b" + replacement + replacement)});
+}
+
+int main() {
+	mock::install();
+
+	test_pool_string_utf8();
+
+	GD_CHECK(mock::live_buffers() == 0);
+
+	return test::finish();
+}
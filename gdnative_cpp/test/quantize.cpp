@@ -0,0 +1,259 @@
+#include "godot/mock.hpp"
+#include "godot/quantize.hpp"
+
+#include "test/check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Bit streams, the three codecs against their documented error bounds, and delta packets between
+// snapshots, including truncated ones.
+
+using namespace godot;
+
+using core::real_t;
+
+static std::mt19937 random_engine = std::mt19937(38);
+
+static core::Quat random_rotation() {
+	std::normal_distribution<real_t> component = std::normal_distribution<real_t>(0, 1);
+
+	return core::Quat::of(
+		component(random_engine),
+		component(random_engine),
+		component(random_engine),
+		component(random_engine)
+	).normalized();
+}
+
+static core::Vector3 random_position(real_t const extent) {
+	std::uniform_real_distribution<real_t> axis = std::uniform_real_distribution<real_t>(-extent, extent);
+
+	return core::Vector3::of(axis(random_engine), axis(random_engine), axis(random_engine));
+}
+
+// Angle of the rotation between two quaternions, for either sign of `b`. Normalizing in double and going
+// through the chord keeps it accurate for the small angles measured here, where an arccosine of the dot
+// product would be dominated by float rounding.
+static double degrees_between(core::Quat const& a, core::Quat const& b) {
+	double const from[4] = {a.x, a.y, a.z, a.w};
+	double const to[4] = {b.x, b.y, b.z, b.w};
+	double from_length = 0, to_length = 0, dot = 0;
+
+	for (int i = 0; i < 4; i += 1) {
+		from_length += (from[i] * from[i]);
+		to_length += (to[i] * to[i]);
+		dot += (from[i] * to[i]);
+	}
+
+	double const sign = ((dot < 0) ? -1 : 1);
+	double chord = 0;
+
+	for (int i = 0; i < 4; i += 1) {
+		double const difference = ((from[i] / std::sqrt(from_length)) - ((sign * to[i]) / std::sqrt(to_length)));
+
+		chord += (difference * difference);
+	}
+
+	return ((4 * std::asin(std::sqrt(chord) / 2)) * (180 / 3.14159265358979323846));
+}
+
+static void test_bit_stream() {
+	std::vector<uint8_t> bytes;
+	quantize::BitWriter writer = quantize::BitWriter(bytes);
+
+	writer.write(1, 1);
+	writer.write(0x5A, 7);
+	writer.write(0x123456789, 33);
+	writer.write(std::numeric_limits<uint64_t>::max(), 64);
+	writer.write(0, 0);
+	writer.write(2, 3);
+	writer.flush();
+
+	// 108 bits, padded to whole bytes.
+	GD_CHECK(bytes.size() == 14);
+
+	quantize::BitReader reader = quantize::BitReader(bytes);
+
+	GD_CHECK(reader.read(1) == 1);
+	GD_CHECK(reader.read(7) == 0x5A);
+	GD_CHECK(reader.read(33) == 0x123456789);
+	GD_CHECK(reader.read(64) == std::numeric_limits<uint64_t>::max());
+	GD_CHECK(reader.read(3) == 2);
+	GD_CHECK(!reader.overflowed());
+	GD_CHECK(reader.read(4) == 0);
+	GD_CHECK(!reader.overflowed());
+	GD_CHECK(reader.read(8) == 0);
+	GD_CHECK(reader.overflowed());
+}
+
+static void test_quat_codec() {
+	struct Case {
+		uint32_t component_bits;
+
+		double worst_degrees;
+	};
+
+	// The documented worst cases with a little margin.
+	for (Case const& test : {Case{9, 0.52}, Case{12, 0.065}, Case{15, 0.0082}}) {
+		quantize::QuatCodec const codec = quantize::QuatCodec(test.component_bits);
+		double worst = 0;
+
+		GD_CHECK(codec.bits() == (2 + (3 * test.component_bits)));
+
+		for (int i = 0; i < 20000; i += 1) {
+			core::Quat const rotation = random_rotation();
+			uint64_t const code = codec.encode(rotation);
+
+			GD_CHECK((code >> codec.bits()) == 0);
+
+			worst = std::max(worst, degrees_between(rotation, codec.decode(code)));
+		}
+
+		GD_CHECK(worst < test.worst_degrees);
+	}
+
+	quantize::QuatCodec const codec = quantize::QuatCodec(12);
+	std::vector<core::Quat> rotations = std::vector<core::Quat>(33);
+	std::vector<uint64_t> codes = std::vector<uint64_t>(rotations.size());
+	std::vector<core::Quat> decoded = std::vector<core::Quat>(rotations.size());
+
+	for (core::Quat& rotation : rotations) rotation = random_rotation();
+
+	codec.encode(rotations, codes);
+	codec.decode(codes, decoded);
+
+	for (size_t i = 0; i < rotations.size(); i += 1) {
+		GD_CHECK(codes[i] == codec.encode(rotations[i]));
+		GD_CHECK(degrees_between(rotations[i], decoded[i]) < 0.065);
+	}
+
+	// Out-of-range bit counts are clamped, and NaN input must still give a code within the width.
+	GD_CHECK(quantize::QuatCodec(1).bits() == 29);
+	GD_CHECK(quantize::QuatCodec(30).bits() == 47);
+
+	real_t const nan = std::numeric_limits<real_t>::quiet_NaN();
+
+	GD_CHECK((codec.encode(core::Quat::of(nan, 0, 0, 1)) >> codec.bits()) == 0);
+}
+
+static void test_vector3_codec() {
+	core::Vector3 const minimum = core::Vector3::of(-100, -50, 0);
+	core::Vector3 const maximum = core::Vector3::of(100, 50, 10);
+	quantize::Vector3Codec const codec = quantize::Vector3Codec(minimum, maximum, 16);
+	real_t const steps = real_t((1 << 16) - 1);
+	core::Vector3 const step = core::Vector3::of((200 / steps), (100 / steps), (10 / steps));
+
+	GD_CHECK(codec.bits() == 48);
+
+	for (int i = 0; i < 20000; i += 1) {
+		core::Vector3 position = random_position(50);
+
+		position.z = ((position.z + 50) * 0.1f);
+
+		core::Vector3 const decoded = codec.decode(codec.encode(position));
+
+		GD_CHECK(std::fabs(decoded.x - position.x) <= (step.x * 0.51f));
+		GD_CHECK(std::fabs(decoded.y - position.y) <= (step.y * 0.51f));
+		GD_CHECK(std::fabs(decoded.z - position.z) <= (step.z * 0.51f));
+	}
+
+	// Outside the box clamps to its faces.
+	core::Vector3 const clamped = codec.decode(codec.encode(core::Vector3::of(-1000, 1000, 5)));
+
+	GD_CHECK(clamped.x == minimum.x);
+	GD_CHECK(std::fabs(clamped.y - maximum.y) <= step.y);
+
+	// A flat axis and NaN coordinates encode as zero, which decodes to the minimum.
+	quantize::Vector3Codec const flat = quantize::Vector3Codec(minimum, core::Vector3::of(100, -50, 10), 12);
+	core::Vector3 const on_plane = flat.decode(flat.encode(core::Vector3::of(20, -50, 5)));
+
+	GD_CHECK(on_plane.y == minimum.y);
+	GD_CHECK(std::isfinite(on_plane.x) && std::isfinite(on_plane.z));
+	GD_CHECK(std::fabs(on_plane.x - 20) <= (200.f / 4095));
+
+	real_t const nan = std::numeric_limits<real_t>::quiet_NaN();
+
+	GD_CHECK(codec.encode(core::Vector3::of(nan, nan, nan)) == 0);
+}
+
+static void test_transform_codec() {
+	quantize::Vector3Codec const origin = quantize::Vector3Codec(
+		core::Vector3::of(-100, -100, -100),
+		core::Vector3::of(100, 100, 100),
+		18
+	);
+
+	quantize::TransformCodec const codec = quantize::TransformCodec(quantize::QuatCodec(12), origin);
+	size_t const count = 1000;
+	std::vector<core::Transform> transforms = std::vector<core::Transform>(count);
+
+	for (core::Transform& transform : transforms) {
+		transform = core::Transform::of(core::Basis::from_quat(random_rotation()), random_position(100));
+	}
+
+	std::vector<quantize::EncodedTransform> baseline = std::vector<quantize::EncodedTransform>(count);
+	std::vector<core::Transform> decoded = std::vector<core::Transform>(count);
+
+	codec.encode(transforms, baseline);
+	codec.decode(baseline, decoded);
+
+	for (size_t i = 0; i < count; i += 1) {
+		core::Quat const rotation = transforms[i].basis.get_rotation_quat();
+
+		GD_CHECK(degrees_between(rotation, decoded[i].basis.get_rotation_quat()) < 0.065);
+		GD_CHECK((transforms[i].origin - decoded[i].origin).length() < 0.001f);
+	}
+
+	// An unchanged snapshot costs one bit per transform.
+	std::vector<uint8_t> bytes;
+	quantize::BitWriter unchanged_writer = quantize::BitWriter(bytes);
+
+	codec.encode_delta(baseline, baseline, unchanged_writer);
+	unchanged_writer.flush();
+
+	GD_CHECK(bytes.size() == (count / 8));
+
+	// Small moves, large moves, new rotations and both together must all come back exactly.
+	for (size_t i = 0; i < count; i += 1) {
+		if ((i % 3) == 0) transforms[i].origin = (transforms[i].origin + core::Vector3::of(0.01f, -0.02f, 0.005f));
+
+		if ((i % 5) == 0) transforms[i].origin = (transforms[i].origin + core::Vector3::of(50, 0, -50));
+
+		if ((i % 7) == 0) transforms[i].basis = core::Basis::from_quat(random_rotation());
+	}
+
+	std::vector<quantize::EncodedTransform> current = std::vector<quantize::EncodedTransform>(count);
+	std::vector<quantize::EncodedTransform> received = std::vector<quantize::EncodedTransform>(count);
+
+	codec.encode(transforms, current);
+	bytes.clear();
+
+	quantize::BitWriter writer = quantize::BitWriter(bytes);
+
+	codec.encode_delta(current, baseline, writer);
+	writer.flush();
+
+	quantize::BitReader reader = quantize::BitReader(bytes);
+
+	GD_CHECK(codec.decode_delta(reader, baseline, received));
+	GD_CHECK(received == current);
+
+	quantize::BitReader truncated = quantize::BitReader(std::span<uint8_t const>(bytes).first(bytes.size() / 2));
+
+	GD_CHECK(!codec.decode_delta(truncated, baseline, received));
+}
+
+int main() {
+	mock::install();
+
+	test_bit_stream();
+	test_quat_codec();
+	test_vector3_codec();
+	test_transform_codec();
+
+	return test::finish();
+}
@@ -0,0 +1,282 @@
+#include "godot/mock.hpp"
+#include "godot/serialize.hpp"
+
+#include "test/check.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Round trips through the serializer against the mock, both in memory and streamed through buffers smaller
+// than the values, and the errors it reports for foreign, truncated and hostile input.
+
+using namespace godot;
+
+struct Stream {
+	std::vector<uint8_t> bytes;
+
+	size_t position;
+};
+
+static bool append_to_stream(void * context, std::span<uint8_t const> const bytes) {
+	Stream * const stream = static_cast<Stream *>(context);
+
+	stream->bytes.insert(stream->bytes.end(), bytes.begin(), bytes.end());
+
+	return true;
+}
+
+static size_t read_from_stream(void * context, std::span<uint8_t> const into) {
+	Stream * const stream = static_cast<Stream *>(context);
+	size_t const count = std::min(into.size(), (stream->bytes.size() - stream->position));
+
+	std::memcpy(into.data(), (stream->bytes.data() + stream->position), count);
+
+	stream->position += count;
+
+	return count;
+}
+
+// Decoded values are compared with the originals through their encodings, which cover every field.
+static std::vector<uint8_t> encoding_of(core::Variant const& value) {
+	core::PoolByteArray bytes;
+
+	GD_CHECK(serialize::encode(value, bytes) == core::Error::OK);
+
+	core::PoolArrayRead<uint8_t> const read = bytes.read();
+
+	return std::vector<uint8_t>(read.begin(), read.end());
+}
+
+static core::Variant bool_variant(bool const value) {
+	godot_variant raw;
+
+	core::api_core->godot_variant_new_bool((&raw), value);
+
+	return core::Variant(raw);
+}
+
+static core::Variant real_variant(double const value) {
+	godot_variant raw;
+
+	core::api_core->godot_variant_new_real((&raw), value);
+
+	return core::Variant(raw);
+}
+
+static void append(core::Array& array, core::Variant const& value) {
+	core::api_core->godot_array_append(array.handleof(), value.handleof());
+}
+
+static void set(core::Dictionary& dictionary, core::Variant const& key, core::Variant const& value) {
+	core::api_core->godot_dictionary_set(dictionary.handleof(), key.handleof(), value.handleof());
+}
+
+static int array_size_of(core::Variant const& value) {
+	core::Array const array = core::Array(core::api_core->godot_variant_as_array(value.handleof()));
+
+	return array.size();
+}
+
+// One of every encodable type, with a pool array larger than the stream buffers and nested containers.
+static core::Variant sample() {
+	core::Array array;
+
+	append(array, core::Variant());
+	append(array, bool_variant(true));
+	append(array, bool_variant(false));
+
+	for (int64_t const value : {
+		int64_t(0),
+		int64_t(-1),
+		int64_t(63),
+		int64_t(-64),
+		std::numeric_limits<int64_t>::min(),
+		std::numeric_limits<int64_t>::max()
+	}) {
+		append(array, core::Variant(value));
+	}
+
+	append(array, real_variant(0.5));
+	append(array, real_variant(0.1));
+	append(array, core::Variant(core::String("h\xC3\xA9llo w\xC3\xB6rld \xF0\x9F\x98\x80")));
+	append(array, core::Variant(core::Vector2::of(1, -2)));
+	append(array, core::Variant(core::Vector3::of(1, -2, 3)));
+	append(array, core::Variant(core::Quat::of(0, 0, 0, 1)));
+	append(array, core::Variant(core::Color::of(0.1f, 0.2f, 0.3f, 0.4f)));
+
+	append(array, core::Variant(core::Transform::of(
+		core::Basis::of(core::Vector3::of(0, 1, 0), core::Vector3::of(-1, 0, 0), core::Vector3::of(0, 0, 1)),
+		core::Vector3::of(4, 5, 6)
+	)));
+
+	append(array, core::Variant(core::NodePath(core::String("root/child:property"))));
+
+	core::Array inner;
+
+	append(inner, core::Variant(int64_t(7)));
+	append(inner, core::Variant(core::String("")));
+
+	core::Dictionary dictionary;
+
+	set(dictionary, core::Variant(core::String("name")), core::Variant(core::String("value")));
+	set(dictionary, core::Variant(int64_t(3)), core::Variant(inner));
+	set(dictionary, core::Variant(core::Vector2::of(1, 1)), core::Variant());
+	append(array, core::Variant(dictionary));
+
+	core::PoolByteArray bytes;
+
+	bytes.resize(3);
+	{
+		core::PoolArrayWrite<uint8_t> const write = bytes.write();
+
+		write[0] = 0;
+		write[1] = 128;
+		write[2] = 255;
+	}
+	append(array, core::Variant(bytes));
+
+	core::PoolIntArray ints;
+
+	ints.resize(1000);
+	{
+		core::PoolArrayWrite<godot_int> const write = ints.write();
+
+		for (size_t i = 0; i < write.size(); i += 1) write[i] = (static_cast<godot_int>(i) * -7919);
+	}
+	append(array, core::Variant(ints));
+
+	std::vector<std::string> const strings = {"", "a", "\xE6\x97\xA5\xE6\x9C\xAC", std::string(300, 'x')};
+
+	append(array, core::Variant(core::PoolStringArray::of(strings)));
+
+	core::PoolColorArray colors;
+
+	colors.resize(10000);
+	{
+		core::PoolArrayWrite<core::Color> const write = colors.write();
+
+		for (size_t i = 0; i < write.size(); i += 1) write[i] = core::Color::of(float(i), 0.5f, -1, 1);
+	}
+	append(array, core::Variant(colors));
+	append(array, core::Variant(core::PoolVector3Array()));
+
+	return core::Variant(array);
+}
+
+static void test_in_memory() {
+	core::Variant const value = sample();
+	std::vector<uint8_t> const bytes = encoding_of(value);
+	core::Variant decoded;
+
+	GD_CHECK(serialize::decode(bytes, decoded) == core::Error::OK);
+	GD_CHECK(decoded.type_of() == core::Variant::TYPE_ARRAY);
+	GD_CHECK(array_size_of(decoded) == array_size_of(value));
+	GD_CHECK(encoding_of(decoded) == bytes);
+}
+
+static void test_streamed() {
+	core::Variant const value = sample();
+	core::Variant const last = core::Variant(int64_t(-12345));
+	Stream stream = Stream{{}, 0};
+	uint8_t write_buffer[64];
+	serialize::Writer writer = serialize::Writer(write_buffer, append_to_stream, (&stream));
+
+	for (int i = 0; i < 3; i += 1) GD_CHECK(writer.write(value) == core::Error::OK);
+
+	GD_CHECK(writer.write(last) == core::Error::OK);
+	GD_CHECK(writer.finish() == core::Error::OK);
+	GD_CHECK(writer.size() == stream.bytes.size());
+
+	std::vector<uint8_t> const expected = encoding_of(value);
+	uint8_t read_buffer[32];
+	serialize::Reader reader = serialize::Reader(read_buffer, read_from_stream, (&stream));
+	core::Variant decoded;
+
+	for (int i = 0; i < 3; i += 1) {
+		GD_CHECK(reader.read(decoded) == core::Error::OK);
+		GD_CHECK(encoding_of(decoded) == expected);
+	}
+
+	GD_CHECK(reader.read(decoded) == core::Error::OK);
+	GD_CHECK(encoding_of(decoded) == encoding_of(last));
+	GD_CHECK(reader.read(decoded) == core::Error::ERR_FILE_EOF);
+	GD_CHECK(decoded.type_of() == core::Variant::TYPE_NIL);
+}
+
+static void test_unbuffered_overflow() {
+	uint8_t buffer[64];
+	serialize::Writer writer = serialize::Writer(buffer);
+
+	GD_CHECK(writer.write(sample()) == core::Error::ERR_OUT_OF_MEMORY);
+}
+
+static void test_cycle() {
+	core::Array array;
+
+	append(array, core::Variant(array));
+
+	core::PoolByteArray bytes;
+
+	GD_CHECK(serialize::encode(core::Variant(array), bytes) == core::Error::ERR_CYCLIC_LINK);
+	GD_CHECK(bytes.size() == 0);
+
+	// Break the cycle so the leak check below holds.
+	array.clear();
+}
+
+static void test_malformed() {
+	core::Variant decoded;
+	std::vector<uint8_t> const foreign = {'N', 'O', 'P', 'E', serialize::format_version, 0};
+
+	GD_CHECK(serialize::decode(foreign, decoded) == core::Error::ERR_FILE_UNRECOGNIZED);
+
+	std::vector<uint8_t> const bytes = encoding_of(sample());
+
+	for (size_t const size : {size_t(6), size_t(100), (bytes.size() / 2), (bytes.size() - 1)}) {
+		core::Variant truncated = core::Variant(int64_t(1));
+
+		GD_CHECK(serialize::decode(std::span(bytes).first(size), truncated) == core::Error::ERR_INVALID_DATA);
+		GD_CHECK(truncated.type_of() == core::Variant::TYPE_NIL);
+	}
+
+	// Counts far beyond the data must fail on the missing bytes rather than allocate up front, in memory and
+	// when streamed.
+	for (serialize::Tag const tag : {
+		serialize::Tag::STRING,
+		serialize::Tag::ARRAY,
+		serialize::Tag::DICTIONARY,
+		serialize::Tag::POOL_STRING_ARRAY,
+		serialize::Tag::POOL_COLOR_ARRAY
+	}) {
+		std::vector<uint8_t> hostile = {'G', 'D', 'V', 'B', serialize::format_version, static_cast<uint8_t>(tag)};
+
+		hostile.insert(hostile.end(), {0xFF, 0xFF, 0xFF, 0xFF, 0x07});
+		hostile.resize((hostile.size() + 100), 0);
+
+		GD_CHECK(serialize::decode(hostile, decoded) == core::Error::ERR_INVALID_DATA);
+
+		Stream stream = Stream{hostile, 0};
+		uint8_t buffer[32];
+		serialize::Reader reader = serialize::Reader(buffer, read_from_stream, (&stream));
+
+		GD_CHECK(reader.read(decoded) == core::Error::ERR_INVALID_DATA);
+	}
+}
+
+int main() {
+	mock::install();
+
+	test_in_memory();
+	test_streamed();
+	test_unbuffered_overflow();
+	test_cycle();
+	test_malformed();
+
+	GD_CHECK(mock::live_buffers() == 0);
+
+	return test::finish();
+}